@@ -179,20 +179,47 @@ static std::string true_heading(const TrueHeading value) {
     }
 }
 
+static std::string channel(const AISPacketMessage::Channel value) {
+    switch (value) {
+        case AISPacketMessage::Channel::AIS1:
+            return " (87B)";
+        case AISPacketMessage::Channel::AIS2:
+            return " (88B)";
+        default:
+            return "";
+    }
+}
+
 } /* namespace format */
 } /* namespace ais */
 
-void AISLogger::on_packet(const ais::Packet& packet) {
-    // TODO: Unstuff here, not in baseband!
-    std::string entry;
-    entry.reserve((packet.length() + 3) / 4);
+void AISLogger::on_packet(const ais::Packet& packet, const PacketMetadata& metadata) {
+    if (binary_log) {
+        // Bit length followed by the packet bits, MSB first.
+        std::array<uint8_t, 2 + 128> payload{};
+        const size_t bits = std::min<size_t>(packet.length(), (payload.size() - 2) * 8);
+        payload[0] = bits & 0xff;
+        payload[1] = bits >> 8;
+        for (size_t i = 0; i < bits; i += 8) {
+            const size_t n = std::min<size_t>(8, bits - i);
+            payload[2 + i / 8] = packet.read(i, n) << (8 - n);
+        }
+
+        binary_log->write_record(binlog::RecordType::AIS, packet.received_at(),
+                                 receiver_model.target_frequency(), payload.data(), 2 + (bits + 7) / 8,
+                                 0, metadata);
+    } else {
+        // TODO: Unstuff here, not in baseband!
+        std::string entry;
+        entry.reserve((packet.length() + 3) / 4);
 
-    for (size_t i = 0; i < packet.length(); i += 4) {
-        const auto nibble = packet.read(i, 4);
-        entry += (nibble >= 10) ? ('W' + nibble) : ('0' + nibble);
-    }
+        for (size_t i = 0; i < packet.length(); i += 4) {
+            const auto nibble = packet.read(i, 4);
+            entry += (nibble >= 10) ? ('W' + nibble) : ('0' + nibble);
+        }
 
-    log_file.write_entry(packet.received_at(), entry);
+        log_file.write_entry(packet.received_at(), entry);
+    }
 
     if (pmem::beep_on_packets()) {
         baseband::request_audio_beep(1000, 24000, 60);
@@ -389,7 +416,7 @@ void AISRecentEntryDetailView::paint(Painter& painter) {
     field_rect = draw_field(painter, field_rect, s, "SoG ", ais::format::speed_over_ground(entry_.last_position.speed_over_ground));
     field_rect = draw_field(painter, field_rect, s, "CoG ", ais::format::course_over_ground(entry_.last_position.course_over_ground));
     field_rect = draw_field(painter, field_rect, s, "Head", ais::format::true_heading(entry_.last_position.true_heading));
-    field_rect = draw_field(painter, field_rect, s, "Rx #", to_string_dec_uint(entry_.received_count));
+    field_rect = draw_field(painter, field_rect, s, "Rx #", to_string_dec_uint(entry_.received_count) + ais::format::channel(entry_.last_channel));
 }
 
 void AISRecentEntryDetailView::set_entry(const AISRecentEntry& entry) {
@@ -420,6 +447,7 @@ AISAppView::AISAppView(NavigationView& nav)
 
     options_channel.on_change = [this](size_t, OptionsField::value_t v) {
         receiver_model.set_target_frequency(v);
+        baseband::set_ais_config(v == dual_channel_frequency);
     };
     options_channel.set_by_value(receiver_model.target_frequency());
 
@@ -474,13 +502,22 @@ void AISAppView::set_parent_rect(const Rect new_parent_rect) {
     recent_entry_detail_view.set_parent_rect(content_rect);
 }
 
-void AISAppView::on_packet(const ais::Packet& packet) {
+void AISAppView::on_packet(const ais::Packet& packet, AISPacketMessage::Channel channel, const PacketMetadata& metadata) {
     if (logger) {
-        logger->on_packet(packet);
+        logger->on_packet(packet, metadata);
     }
     got_new_packet = true;
     auto& entry = ::on_packet(recent, packet.source_id());
     entry.update(packet);
+
+    // In single channel mode the channel is whatever we're tuned to
+    if (channel == AISPacketMessage::Channel::Tuned) {
+        if (receiver_model.target_frequency() == 161975000)
+            channel = AISPacketMessage::Channel::AIS1;
+        else if (receiver_model.target_frequency() == 162025000)
+            channel = AISPacketMessage::Channel::AIS2;
+    }
+    entry.last_channel = channel;
     recent_entries_view.set_dirty();
 
     // TODO: Crude hack, should be a more formal listener arrangement...
@@ -32,6 +32,7 @@
 
 #include "event_m0.hpp"
 
+#include "binary_log.hpp"
 #include "log_file.hpp"
 #include "app_settings.hpp"
 #include "radio_state.hpp"
@@ -72,6 +73,7 @@ struct AISRecentEntry {
     AISPosition last_position;
     size_t received_count;
     int8_t navigational_status;
+    AISPacketMessage::Channel last_channel;
 
     AISRecentEntry()
         : AISRecentEntry{0} {
@@ -85,7 +87,8 @@ struct AISRecentEntry {
           destination{},
           last_position{},
           received_count{0},
-          navigational_status{-1} {
+          navigational_status{-1},
+          last_channel{AISPacketMessage::Channel::Tuned} {
     }
 
     Key key() const {
@@ -100,13 +103,17 @@ using AISRecentEntries = RecentEntries<AISRecentEntry>;
 class AISLogger {
    public:
     Optional<File::Error> append(const std::filesystem::path& filename) {
+        binary_log = BinaryLogFile::open_if_enabled(filename);
+        if (binary_log)
+            return {};
         return log_file.append(filename);
     }
 
-    void on_packet(const ais::Packet& packet);
+    void on_packet(const ais::Packet& packet, const PacketMetadata& metadata);
 
    private:
     LogFile log_file{};
+    std::unique_ptr<BinaryLogFile> binary_log{};
 };
 
 namespace ui {
@@ -188,6 +195,9 @@ class AISAppView : public View {
 
     static constexpr auto header_height = 1 * 16;
 
+    /* Between 87B and 88B, the baseband decodes both at once. */
+    static constexpr uint32_t dual_channel_frequency = 162000000;
+
     Text label_channel{
         {UI_POS_X(0), UI_POS_Y(0), 2 * 8, 1 * 16},
         "Ch"};
@@ -198,6 +208,7 @@ class AISAppView : public View {
         {
             {"87B", 161975000},
             {"88B", 162025000},
+            {"A+B", dual_channel_frequency},
         }};
 
     RFAmpField field_rf_amp{
@@ -229,11 +240,11 @@ class AISAppView : public View {
             const auto message = static_cast<const AISPacketMessage*>(p);
             const ais::Packet packet{message->packet};
             if (packet.is_valid()) {
-                this->on_packet(packet);
+                this->on_packet(packet, message->channel, message->metadata);
             }
         }};
 
-    void on_packet(const ais::Packet& packet);
+    void on_packet(const ais::Packet& packet, AISPacketMessage::Channel channel, const PacketMetadata& metadata);
     void on_show_list();
     void on_show_detail(const AISRecentEntry& entry);
     void on_tick_second();
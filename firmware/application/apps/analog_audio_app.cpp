@@ -546,8 +546,11 @@ void AnalogAudioView::update_modulation(ReceiverModel::Mode modulation) {
     }
 }
 
-void AnalogAudioView::handle_coded_squelch(uint32_t value) {
-    text_ctcss.set(tone_key_string_by_value(value, text_ctcss.parent_rect().width() / 8));
+void AnalogAudioView::handle_coded_squelch(const CodedSquelchMessage& message) {
+    if (message.type == CodedSquelchMessage::Type::DCS)
+        text_ctcss.set(dcs_code_string(message.value, message.inverted));
+    else
+        text_ctcss.set(tone_key_string_by_value(message.value, text_ctcss.parent_rect().width() / 8));
 }
 
 void AnalogAudioView::on_freqchg(int64_t freq) {
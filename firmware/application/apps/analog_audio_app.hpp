@@ -314,7 +314,7 @@ class AnalogAudioView : public View {
 
     void update_modulation(ReceiverModel::Mode modulation);
 
-    void handle_coded_squelch(uint32_t value);
+    void handle_coded_squelch(const CodedSquelchMessage& message);
 
     void on_freqchg(int64_t freq);
 
@@ -322,7 +322,7 @@ class AnalogAudioView : public View {
         Message::ID::CodedSquelch,
         [this](const Message* p) {
             const auto message = *reinterpret_cast<const CodedSquelchMessage*>(p);
-            this->handle_coded_squelch(message.value);
+            this->handle_coded_squelch(message);
         }};
 
     MessageHandlerRegistration message_handler_freqchg{
@@ -55,11 +55,12 @@ CaptureAppView::CaptureAppView(NavigationView& nav)
         this->field_frequency.set_step(v);
     };
 
-    option_format.set_selected_index(file_format);
     option_format.on_change = [this](size_t, uint32_t file_type) {
         file_format = file_type;
         record_view.set_file_type((RecordView::FileType)file_type);
     };
+    // file_format holds the FileType value, not the option index
+    option_format.set_by_value(file_format);
 
     check_trim.set_value(trim);
     check_trim.on_select = [this](Checkbox&, bool v) {
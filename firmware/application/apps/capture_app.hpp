@@ -100,7 +100,9 @@ class CaptureAppView : public View {
         {18 * 8, 1 * 16},
         3,
         {{"C16", RecordView::FileType::RawS16},
-         {"C8", RecordView::FileType::RawS8}}};
+         {"C8", RecordView::FileType::RawS8},
+         {"C6", RecordView::FileType::BFP6},
+         {"C4", RecordView::FileType::BFP4}}};
 
     Checkbox check_trim{
         {23 * 8, 1 * 16},
@@ -33,7 +33,19 @@ using namespace portapack;
 using namespace pocsag;
 namespace pmem = portapack::persistent_memory;
 
-void POCSAGLogger::log_raw_data(const pocsag::POCSAGPacket& packet, const uint32_t frequency) {
+void POCSAGLogger::log_raw_data(const pocsag::POCSAGPacket& packet, const uint32_t frequency, const PacketMetadata& metadata) {
+    if (binary_log) {
+        // Bitrate followed by the 16 codewords, all u32.
+        std::array<uint32_t, 1 + 16> payload{};
+        payload[0] = packet.bitrate();
+        for (size_t c = 0; c < 16; c++)
+            payload[1 + c] = packet[c];
+
+        binary_log->write_record(binlog::RecordType::POCSAGRaw, packet.timestamp(),
+                                 frequency, payload.data(), sizeof(payload), 0, metadata);
+        return;
+    }
+
     std::string entry = "Raw: F:" + to_string_dec_uint(frequency) + "Hz " +
                         to_string_dec_uint(packet.bitrate()) + " Codewords:";
 
@@ -44,7 +56,14 @@ void POCSAGLogger::log_raw_data(const pocsag::POCSAGPacket& packet, const uint32
     log_file.write_entry(packet.timestamp(), entry);
 }
 
-void POCSAGLogger::log_decoded(Timestamp timestamp, const std::string& text) {
+void POCSAGLogger::log_decoded(Timestamp timestamp, const std::string& text, const PacketMetadata& metadata) {
+    if (binary_log) {
+        binary_log->write_record(binlog::RecordType::POCSAGText, timestamp,
+                                 receiver_model.target_frequency(), text.data(), text.size(),
+                                 0, metadata);
+        return;
+    }
+
     log_file.write_entry(timestamp, text);
 }
 
@@ -202,7 +221,7 @@ bool POCSAGAppView::ignore_address(uint32_t address) const {
     }
 }
 
-void POCSAGAppView::handle_decoded(Timestamp timestamp, const std::string& prefix) {
+void POCSAGAppView::handle_decoded(Timestamp timestamp, const std::string& prefix, const PacketMetadata& metadata) {
     bool bad_data = pocsag_state.errors >= 3;
 
     // Too many errors for reliable decode.
@@ -236,7 +255,8 @@ void POCSAGAppView::handle_decoded(Timestamp timestamp, const std::string& prefi
                 logger.log_decoded(
                     timestamp,
                     to_string_dec_uint(pocsag_state.address) +
-                        " F" + to_string_dec_uint(pocsag_state.function));
+                        " F" + to_string_dec_uint(pocsag_state.function),
+                    metadata);
             }
         }
 
@@ -256,7 +276,8 @@ void POCSAGAppView::handle_decoded(Timestamp timestamp, const std::string& prefi
                 timestamp,
                 to_string_dec_uint(pocsag_state.address) +
                     " F" + to_string_dec_uint(pocsag_state.function) +
-                    " " + pocsag_state.output);
+                    " " + pocsag_state.output,
+                metadata);
         }
     }
 }
@@ -290,7 +311,7 @@ void POCSAGAppView::on_packet(const POCSAGPacketMessage* message) {
     text_packet_count.set(to_string_dec_uint(packet_count));
 
     if (logging_raw())
-        logger.log_raw_data(message->packet, receiver_model.target_frequency());
+        logger.log_raw_data(message->packet, receiver_model.target_frequency(), message->metadata);
 
     if (message->packet.flag() != NORMAL) {
         console.writeln("\n" STR_COLOR_RED + prefix + " CRC ERROR: " + pocsag::flag_str(message->packet.flag()));
@@ -303,10 +324,10 @@ void POCSAGAppView::on_packet(const POCSAGPacketMessage* message) {
 
         // Handle multiple messages (if any).
         while (pocsag_decode_batch(message->packet, pocsag_state))
-            handle_decoded(message->packet.timestamp(), prefix);
+            handle_decoded(message->packet.timestamp(), prefix, message->metadata);
 
         // Handle the remainder.
-        handle_decoded(message->packet.timestamp(), prefix);
+        handle_decoded(message->packet.timestamp(), prefix, message->metadata);
     }
 
     // Set status icon color to indicate state machine state.
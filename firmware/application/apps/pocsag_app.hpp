@@ -29,6 +29,7 @@
 #include "ui_rssi.hpp"
 
 #include "app_settings.hpp"
+#include "binary_log.hpp"
 #include "log_file.hpp"
 #include "pocsag.hpp"
 #include "pocsag_packet.hpp"
@@ -39,14 +40,18 @@
 class POCSAGLogger {
    public:
     Optional<File::Error> append(const std::filesystem::path& filename) {
+        binary_log = BinaryLogFile::open_if_enabled(filename);
+        if (binary_log)
+            return {};
         return log_file.append(filename);
     }
 
-    void log_raw_data(const pocsag::POCSAGPacket& packet, const uint32_t frequency);
-    void log_decoded(Timestamp timestamp, const std::string& text);
+    void log_raw_data(const pocsag::POCSAGPacket& packet, const uint32_t frequency, const PacketMetadata& metadata);
+    void log_decoded(Timestamp timestamp, const std::string& text, const PacketMetadata& metadata);
 
    private:
     LogFile log_file{};
+    std::unique_ptr<BinaryLogFile> binary_log{};
 };
 
 namespace ui {
@@ -236,7 +241,7 @@ class POCSAGAppView : public View {
 
     void refresh_ui();
     bool ignore_address(uint32_t address) const;
-    void handle_decoded(Timestamp timestamp, const std::string& prefix);
+    void handle_decoded(Timestamp timestamp, const std::string& prefix, const PacketMetadata& metadata);
     void on_packet(const POCSAGPacketMessage* message);
     void on_stats(const POCSAGStatsMessage* stats);
 
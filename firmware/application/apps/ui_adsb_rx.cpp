@@ -110,6 +110,32 @@ void RecentEntriesTable<AircraftRecentEntries>::draw(
 /* ADSBLogger ********************************************/
 
 void ADSBLogger::log(const ADSBLogEntry& log_entry) {
+    if (binary_log) {
+        binlog::ADSBRecord record{};
+        std::copy_n(log_entry.raw.begin(), log_entry.raw_length, record.raw);
+        record.raw_length = log_entry.raw_length;
+        record.valid = (log_entry.pos.pos_valid ? binlog::ADSBRecord::Position : 0) |
+                       (log_entry.pos.alt_valid ? binlog::ADSBRecord::Altitude : 0) |
+                       (log_entry.vel.valid ? binlog::ADSBRecord::Velocity : 0);
+        record.altitude = log_entry.pos.altitude;
+        record.latitude = log_entry.pos.latitude;
+        record.longitude = log_entry.pos.longitude;
+        record.squawk = log_entry.sqwk;
+        record.heading = log_entry.vel.heading;
+        record.speed = log_entry.vel.speed;
+        record.v_rate = log_entry.vel.v_rate;
+        record.speed_type = log_entry.vel.type;
+        record.vel_type = log_entry.vel_type;
+        record.sil = log_entry.sil;
+        log_entry.callsign.copy(record.callsign, sizeof(record.callsign));
+        record.icao = log_entry.icao_address;
+
+        binary_log->write_record(binlog::RecordType::ADSB, rtc_time::now(),
+                                 receiver_model.target_frequency(), &record, sizeof(record),
+                                 0, log_entry.metadata);
+        return;
+    }
+
     std::string log_line;
     log_line.reserve(100);
 
@@ -496,14 +522,18 @@ void ADSBRxView::on_frame(const ADSBFrameMessage* message) {
     ADSBLogEntry log_entry;
     uint8_t* raw_data = frame.get_raw_data();
 
-    if (df & 0x10)  // 112 bits
-        log_entry.raw_data = to_string_hex_array(raw_data, 14);
-    else {  // 56 bits
-        log_entry.raw_data = to_string_hex_array(raw_data, 7);
-        log_entry.raw_data.append(14, ' ');
+    log_entry.raw_length = (df & 0x10) ? 14 : 7;  // 112 or 56 bits
+    std::copy_n(raw_data, log_entry.raw_length, log_entry.raw.begin());
+
+    if (!logger->is_binary()) {
+        log_entry.raw_data = to_string_hex_array(raw_data, log_entry.raw_length);
+        if (log_entry.raw_length == 7)
+            log_entry.raw_data.append(14, ' ');
     }
 
     log_entry.icao = entry.icao_str;
+    log_entry.icao_address = entry.key();
+    log_entry.metadata = message->metadata;
 
     // 17: // Extended squitter
     // 18: // Extended squitter/non-transponder
@@ -31,6 +31,7 @@
 #include "crc.hpp"
 #include "database.hpp"
 #include "file.hpp"
+#include "binary_log.hpp"
 #include "log_file.hpp"
 #include "message.hpp"
 #include "radio_state.hpp"
@@ -173,14 +174,18 @@ using AircraftRecentEntries = RecentEntries<AircraftRecentEntry>;
 
 /* Holds data for logging. */
 struct ADSBLogEntry {
-    std::string raw_data{};
+    std::string raw_data{};  // Only formatted for text logs.
+    std::array<uint8_t, 14> raw{};
+    uint8_t raw_length{};
     std::string icao{};
+    uint32_t icao_address{};
     std::string callsign{};
     adsb_pos pos{};
     adsb_vel vel{};
     uint8_t vel_type{};
     uint8_t sil{};
     uint16_t sqwk{};
+    PacketMetadata metadata{};
 };
 
 // TODO: Make logging optional.
@@ -188,12 +193,17 @@ struct ADSBLogEntry {
 class ADSBLogger {
    public:
     Optional<File::Error> append(const std::filesystem::path& filename) {
+        binary_log = BinaryLogFile::open_if_enabled(filename);
+        if (binary_log)
+            return {};
         return log_file.append(filename);
     }
+    bool is_binary() const { return binary_log != nullptr; }
     void log(const ADSBLogEntry& log_entry);
 
    private:
     LogFile log_file{};
+    std::unique_ptr<BinaryLogFile> binary_log{};
 };
 
 /* Shows detailed information about an aircraft. */
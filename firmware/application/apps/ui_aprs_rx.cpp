@@ -31,7 +31,14 @@
 
 using namespace portapack;
 
-void APRSLogger::log_raw_data(const std::string& data) {
+void APRSLogger::log_raw_data(const std::string& data, const PacketMetadata& metadata) {
+    if (binary_log) {
+        binary_log->write_record(binlog::RecordType::APRS, rtc_time::now(),
+                                 receiver_model.target_frequency(), data.data(), data.size(),
+                                 0, metadata);
+        return;
+    }
+
     log_file.write_entry(data);
 }
 
@@ -165,7 +172,7 @@ void APRSRxView::on_packet(const APRSPacketMessage* message) {
     str_console += stream_text;
 
     if (logger) {
-        logger->log_raw_data(stream_text);
+        logger->log_raw_data(stream_text, message->metadata);
     }
 
     // if(reset_console){ //having more than one console causes issues when switching tabs where one is disabled, and the other enabled breaking the scoll setup.
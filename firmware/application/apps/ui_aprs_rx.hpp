@@ -34,6 +34,7 @@
 #include "recent_entries.hpp"
 #include "ui_tabview.hpp"
 
+#include "binary_log.hpp"
 #include "log_file.hpp"
 #include "utility.hpp"
 #include "file_path.hpp"
@@ -41,13 +42,17 @@
 class APRSLogger {
    public:
     Optional<File::Error> append(const std::filesystem::path& filename) {
+        binary_log = BinaryLogFile::open_if_enabled(filename);
+        if (binary_log)
+            return {};
         return log_file.append(filename);
     }
 
-    void log_raw_data(const std::string& data);
+    void log_raw_data(const std::string& data, const PacketMetadata& metadata = {});
 
    private:
     LogFile log_file{};
+    std::unique_ptr<BinaryLogFile> binary_log{};
 };
 
 namespace ui {
@@ -41,6 +41,7 @@
 
 #include "portapack.hpp"
 #include "portapack_persistent_memory.hpp"
+#include "portapack_shared_memory.hpp"
 using namespace portapack;
 
 #include "irq_controls.hpp"
@@ -419,6 +420,7 @@ void DebugMenuView::on_populate() {
     }
     add_items({
         {"Buttons Test", ui::Theme::getInstance()->fg_darkcyan->foreground, &bitmap_icon_controls, [this]() { nav_.push<DebugControlsView>(); }},
+        {"M4 Profile", ui::Theme::getInstance()->fg_darkcyan->foreground, &bitmap_icon_memory, [this]() { nav_.push<DebugM4ProfileView>(); }},
         {"M0 Stack Dump", ui::Theme::getInstance()->fg_darkcyan->foreground, &bitmap_icon_memory, [this]() { stack_dump(); }},
         {"Memory Dump", ui::Theme::getInstance()->fg_darkcyan->foreground, &bitmap_icon_memory, [this]() { nav_.push<DebugMemoryDumpView>(); }},
         {"Peripherals", ui::Theme::getInstance()->fg_darkcyan->foreground, &bitmap_icon_peripherals, [this]() { nav_.push<DebugPeripheralsMenuView>(); }},
@@ -439,6 +441,58 @@ void DebugMenuView::on_populate() {
     };
 }
 
+/* DebugM4ProfileView ****************************************************/
+
+DebugM4ProfileView::DebugM4ProfileView(NavigationView& nav) {
+    add_children({&labels,
+                  &text_missed,
+                  &button_reset,
+                  &button_done});
+
+    for (size_t i = 0; i < text_stages.size(); i++) {
+        text_stages[i].set_parent_rect({0, static_cast<Coord>((4 + i) * 16), screen_width, 16});
+        add_child(&text_stages[i]);
+    }
+
+    button_reset.on_select = [this](Button&) {
+        shared_memory.request_m4_profile_reset = 1;
+    };
+    button_done.on_select = [&nav](Button&) { nav.pop(); };
+
+    signal_token_tick_second = rtc_time::signal_tick_second += [this]() {
+        update();
+    };
+    update();
+}
+
+DebugM4ProfileView::~DebugM4ProfileView() {
+    rtc_time::signal_tick_second -= signal_token_tick_second;
+}
+
+void DebugM4ProfileView::focus() {
+    button_done.focus();
+}
+
+void DebugM4ProfileView::update() {
+    for (size_t i = 0; i < text_stages.size(); i++) {
+        const auto& stats = shared_memory.m4_profile.stages[i];
+        if (stats.count == 0) {
+            text_stages[i].set("");
+            continue;
+        }
+
+        std::string name{baseband::profile::stage_names[i]};
+        name.resize(10, ' ');
+        text_stages[i].set(
+            name +
+            to_string_dec_uint(stats.min / 1000, 5) +
+            to_string_dec_uint(baseband::profile::mean(stats) / 1000, 5) +
+            to_string_dec_uint(baseband::profile::percentile(stats, 99) / 1000, 5) +
+            to_string_dec_uint(stats.max / 1000, 5));
+    }
+    text_missed.set("M4 miss: " + to_string_dec_uint(shared_memory.m4_buffer_missed));
+}
+
 /* DebugMemoryDumpView *********************************************************/
 
 DebugMemoryDumpView::DebugMemoryDumpView(NavigationView& nav) {
@@ -34,6 +34,8 @@
 #include "portapack.hpp"
 #include "memory_map.hpp"
 #include "irq_controls.hpp"
+#include "rtc_time.hpp"
+#include "baseband_profile.hpp"
 
 #include <functional>
 #include <utility>
@@ -373,6 +375,39 @@ private:
         };
 };*/
 
+class DebugM4ProfileView : public View {
+   public:
+    DebugM4ProfileView(NavigationView& nav);
+    ~DebugM4ProfileView();
+
+    void focus() override;
+
+    std::string title() const override { return "M4 Profile"; };
+
+   private:
+    Labels labels{
+        {{0, 1 * 16}, "Stage       min mean  p99  max", Theme::getInstance()->fg_light->foreground},
+        {{0, 2 * 16}, "kcycles/block", Theme::getInstance()->fg_light->foreground},
+    };
+
+    std::array<Text, baseband::profile::stage_count> text_stages{};
+
+    Text text_missed{
+        {0, 12 * 16, screen_width, 16},
+    };
+
+    Button button_reset{
+        {16, 14 * 16, 96, 24},
+        "Reset"};
+    Button button_done{
+        {128, 14 * 16, 96, 24},
+        "Done"};
+
+    SignalToken signal_token_tick_second{};
+
+    void update();
+};
+
 class DebugPeripheralsMenuView : public BtnGridView {
    public:
     DebugPeripheralsMenuView(NavigationView& nav);
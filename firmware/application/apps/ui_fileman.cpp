@@ -84,7 +84,7 @@ fs::path get_partner_file(fs::path path) {
         return {};
     auto ext = path.extension();
 
-    if (is_cxx_capture_file(path))
+    if (is_cxx_capture_file(path) || capture_file_bfp_bits(path))
         path.replace_extension(txt_ext);
     else if (path_iequal(ext, txt_ext)) {
         path.replace_extension(c8_ext);
@@ -677,7 +677,7 @@ bool FileManagerView::handle_file_open() {
             nav_.push<TextEditorView>(path);
         }
         return true;
-    } else if (is_cxx_capture_file(path) || path_iequal(ppl_ext, ext)) {
+    } else if (is_cxx_capture_file(path) || capture_file_bfp_bits(path) || path_iequal(ppl_ext, ext)) {
         // TODO: Enough memory to push?
         nav_.push<PlaylistView>(path);
         return true;
@@ -81,6 +81,8 @@ class FileManBaseView : public View {
         {u".BMP", &bitmap_icon_file_image, ui::Color::green()},
         {u".C8", &bitmap_icon_file_iq, ui::Color::dark_cyan()},
         {u".C16", &bitmap_icon_file_iq, ui::Color::dark_cyan()},
+        {u".C6", &bitmap_icon_file_iq, ui::Color::dark_cyan()},
+        {u".C4", &bitmap_icon_file_iq, ui::Color::dark_cyan()},
         {u".WAV", &bitmap_icon_file_wav, ui::Color::dark_magenta()},
         {u".PPL", &bitmap_icon_file_iq, ui::Color::white()},                  // Playlist/Replay
         {u".REM", &bitmap_icon_remote, ui::Color::orange()},                  // Remote
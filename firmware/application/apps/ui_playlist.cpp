@@ -268,6 +268,10 @@ void PlaylistView::send_current_track() {
         return;
     }
 
+    // C8 files are streamed as-is, the baseband interpolator handles them natively.
+    const bool c8_samples = reader->convert_c8_to_c16;
+    reader->convert_c8_to_c16 = false;
+
     // Update the sample rate in proc_replay baseband.
     baseband::set_sample_rate(current()->metadata.sample_rate,
                               get_oversample_rate(current()->metadata.sample_rate));
@@ -290,7 +294,8 @@ void PlaylistView::send_current_track() {
         [](uint32_t return_code) {
             ReplayThreadDoneMessage message{return_code};
             EventDispatcher::send_message(message);
-        });
+        },
+        c8_samples);
 
     // Now it's sending, update the UI.
     update_ui();
@@ -327,8 +332,13 @@ void PlaylistView::update_ui() {
         text_filename.set(current()->path.filename().string());
         text_sample_rate.set(unit_auto_scale(current()->metadata.sample_rate, 3, (current()->metadata.sample_rate > 1000000) ? 2 : 0) + "Hz");
 
-        uint8_t sample_size = capture_file_sample_size(current()->path);
-        auto duration = ms_duration(current()->file_size, current()->metadata.sample_rate, sample_size);
+        // Size of the stream as replayed, in C16
+        uint64_t c16_size = 0;
+        if (auto bits = capture_file_bfp_bits(current()->path))
+            c16_size = file_convert::bfp_sample_count(current()->file_size, bits) * sizeof(complex16_t);
+        else if (auto sample_size = capture_file_sample_size(current()->path))
+            c16_size = current()->file_size * sizeof(complex16_t) / sample_size;
+        auto duration = ms_duration(c16_size, current()->metadata.sample_rate, sizeof(complex16_t));
         text_duration.set(to_string_time_ms(duration));
         field_frequency.set_value(current()->metadata.center_frequency);
 
@@ -336,10 +346,11 @@ void PlaylistView::update_ui() {
             to_string_dec_uint(current_index_ + 1) + "/" +
             to_string_dec_uint(playlist_db_.size()) + " " +
             playlist_path_.filename().string());
+        text_stream.set("");
 
         progressbar_track.set_max(playlist_db_.size() - 1);
         progressbar_track.set_value(current_index_);
-        progressbar_transmit.set_max(current()->file_size * sizeof(complex16_t) / sample_size);
+        progressbar_transmit.set_max(c16_size);
     }
 
     button_play.set_bitmap(is_active() ? &bitmap_stop : &bitmap_play);
@@ -347,6 +358,13 @@ void PlaylistView::update_ui() {
 
 void PlaylistView::on_tx_progress(uint32_t progress) {
     progressbar_transmit.set_value(progress);
+
+    // SD card stalls; the baseband sends silence for the missing samples.
+    if (replay_thread_) {
+        const auto& state = replay_thread_->state();
+        if (state.underruns || state.overruns)
+            text_stream.set("U" + to_string_dec_uint(state.underruns) + " O" + to_string_dec_uint(state.overruns));
+    }
 }
 
 void PlaylistView::handle_replay_thread_done(uint32_t return_code) {
@@ -379,6 +397,7 @@ PlaylistView::PlaylistView(
         &check_loop,
         &button_play,
         &text_track,
+        &text_stream,
         &button_prev,
         &button_add,
         &button_delete,
@@ -462,7 +481,7 @@ PlaylistView::PlaylistView(
     auto ext = path.extension();
     if (path_iequal(ext, ppl_ext))
         on_file_changed(path);
-    else if (is_cxx_capture_file(path))
+    else if (is_cxx_capture_file(path) || capture_file_bfp_bits(path))
         add_entry(fs::path{path});
 }
 
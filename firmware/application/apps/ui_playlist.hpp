@@ -145,7 +145,11 @@ class PlaylistView : public View {
         Theme::getInstance()->fg_green->background};
 
     Text text_track{
-        {UI_POS_X(0), 3 * 16, screen_width, 16}};
+        {UI_POS_X(0), 3 * 16, UI_POS_WIDTH_REMAINING(12), 16}};
+
+    // Stream underruns/overruns of the current track.
+    Text text_stream{
+        {UI_POS_X_RIGHT(12), 3 * 16, UI_POS_WIDTH(12), 16}};
 
     NewButton button_prev{
         {2 * 8, 4 * 16, 4 * 8, 2 * 16},
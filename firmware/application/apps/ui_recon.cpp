@@ -283,6 +283,9 @@ void ReconView::handle_retune() {
     if (last_freq != freq) {
         last_freq = freq;
         receiver_model.set_target_frequency(freq);  // Retune
+        coded_squelch_state = CodedSquelchState::Unknown;
+        coded_squelch_repeat = 0;
+        coded_squelch_wait = 0;
     }
     if (frequency_list.size() > 0) {
         if (last_entry.modulation != current_entry().modulation && is_valid(current_entry().modulation)) {
@@ -860,8 +863,26 @@ void ReconView::on_statistics_update(const ChannelStatistics& statistics) {
             }
             if (db > squelch)  // MATCHING LEVEL
             {
-                freq_lock++;
-                timer += time_interval;  // give some more time for next lock
+                if (current_has_ctcss()) {
+                    // Tone qualified: the detected tone decides, the level only keeps us waiting for it
+                    if (coded_squelch_state == CodedSquelchState::Match) {
+                        freq_lock = recon_lock_nb_match;
+                    } else if (coded_squelch_state == CodedSquelchState::Mismatch) {
+                        freq_lock = 0;
+                        timer = 0;
+                    } else {
+                        coded_squelch_wait += time_interval;
+                        if (coded_squelch_wait < coded_squelch_timeout) {
+                            timer += time_interval;
+                        } else {
+                            freq_lock = 0;
+                            timer = 0;
+                        }
+                    }
+                } else {
+                    freq_lock++;
+                    timer += time_interval;  // give some more time for next lock
+                }
             } else {
                 // continuous, direct cut it if not consecutive match after 1 first match
                 if (recon_match_mode == RECON_MATCH_CONTINUOUS) {
@@ -1273,11 +1294,41 @@ size_t ReconView::change_mode(freqman_index_t new_mod) {
     return freqman_entry_get_step_value(def_step);
 }
 
-void ReconView::handle_coded_squelch(const uint32_t value) {
-    if (field_mode.selected_index() == NFM_MODULATION)
-        text_ctcss.set(tone_key_string_by_value(value, text_ctcss.parent_rect().width() / 8));
-    else
+bool ReconView::current_has_ctcss() {
+    if (frequency_list.empty() || !current_is_valid() || field_mode.selected_index() != NFM_MODULATION)
+        return false;
+    const auto tone = current_entry().tone;
+    // Only the sub-audio CTCSS tones can be checked by the NFM baseband
+    return is_valid(tone) && tone > 0 && tone < tone_keys.size() && tone_keys[tone].second < 300 * 100;
+}
+
+void ReconView::handle_coded_squelch(const CodedSquelchMessage& message) {
+    if (field_mode.selected_index() != NFM_MODULATION) {
         text_ctcss.set("        ");
+        return;
+    }
+
+    if (message.type == CodedSquelchMessage::Type::DCS)
+        text_ctcss.set(dcs_code_string(message.value, message.inverted));
+    else
+        text_ctcss.set(tone_key_string_by_value(message.value, text_ctcss.parent_rect().width() / 8));
+
+    // Same code twice in a row before deciding
+    const uint32_t value = (message.type == CodedSquelchMessage::Type::DCS) ? (message.value | 0x80000000) : message.value;
+    if (value != coded_squelch_last_value) {
+        coded_squelch_last_value = value;
+        coded_squelch_repeat = 0;
+    }
+    if (coded_squelch_repeat < coded_squelch_min_repeat)
+        coded_squelch_repeat++;
+    if (coded_squelch_repeat < coded_squelch_min_repeat)
+        return;
+
+    if (current_has_ctcss() && message.type == CodedSquelchMessage::Type::CTCSS &&
+        tone_key_index_by_value(message.value) == current_entry().tone)
+        coded_squelch_state = CodedSquelchState::Match;
+    else
+        coded_squelch_state = CodedSquelchState::Mismatch;
 }
 
 void ReconView::handle_remove_current_item() {
@@ -1396,6 +1447,10 @@ void ReconView::start_repeat() {
         repeat_file_error(rawfile, "Can't open file to send to thread");
         return;
     }
+
+    // C8 files are streamed as-is, the baseband interpolator handles them natively.
+    const bool c8_samples = reader->convert_c8_to_c16;
+    reader->convert_c8_to_c16 = false;
     // wait for TX if needed (hackish, direct screen update since the UI will be blocked)
     if (persistent_memory::recon_repeat_delay() > 0) {
         uint8_t delay = persistent_memory::recon_repeat_delay();
@@ -1429,7 +1484,8 @@ void ReconView::start_repeat() {
         [](uint32_t return_code) {
             ReplayThreadDoneMessage message{return_code};
             EventDispatcher::send_message(message);
-        });
+        },
+        c8_samples);
 }
 
 void ReconView::stop_repeat(const bool do_loop) {
@@ -102,7 +102,8 @@ class ReconView : public View {
     void colorize_waits();
     void recon_redraw();
     void handle_retune();
-    void handle_coded_squelch(const uint32_t value);
+    void handle_coded_squelch(const CodedSquelchMessage& message);
+    bool current_has_ctcss();
     void handle_remove_current_item();
     void load_persisted_settings();
     bool recon_save_freq(const std::filesystem::path& path, size_t index, bool warn_if_exists);
@@ -160,6 +161,18 @@ class ReconView : public View {
     freqman_entry last_entry{};
     bool entry_has_changed{false};
     uint32_t freq_lock{0};
+    // Tone qualified locking, reset on every retune
+    enum class CodedSquelchState : uint8_t {
+        Unknown,
+        Match,
+        Mismatch,
+    };
+    CodedSquelchState coded_squelch_state{CodedSquelchState::Unknown};
+    uint32_t coded_squelch_last_value{0};
+    uint8_t coded_squelch_repeat{0};
+    int32_t coded_squelch_wait{0};
+    static constexpr uint8_t coded_squelch_min_repeat = 2;  // first result after a retune may still hold old audio
+    static constexpr int32_t coded_squelch_timeout = 500;   // ms to wait for a tone before moving on
     int64_t minfreq{0};
     int64_t maxfreq{0};
     bool has_looped{false};
@@ -402,7 +415,7 @@ class ReconView : public View {
         Message::ID::CodedSquelch,
         [this](const Message* const p) {
             const auto message = *reinterpret_cast<const CodedSquelchMessage*>(p);
-            handle_coded_squelch(message.value);
+            handle_coded_squelch(message);
         }};
 
     MessageHandlerRegistration message_handler_stats{
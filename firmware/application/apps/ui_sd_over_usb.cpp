@@ -22,6 +22,7 @@
 
 #include "ui_sd_over_usb.hpp"
 #include "portapack_shared_memory.hpp"
+#include "sd_card.hpp"
 
 namespace ui {
 
@@ -42,6 +43,7 @@ SdOverUsbView::SdOverUsbView(NavigationView& nav)
             Theme::getInstance()->bg_darkest->foreground,
             Theme::getInstance()->bg_darkest->background);
 
+        sd_card::flush();
         sdcDisconnect(&SDCD1);
         sdcStop(&SDCD1);
 
@@ -418,10 +418,12 @@ SetSDCardView::SetSDCardView(NavigationView& nav) {
                   &checkbox_sdcard_speed,
                   &button_test_sdcard_high_speed,
                   &text_sdcard_test_status,
+                  &checkbox_binary_logs,
                   &button_save,
                   &button_cancel});
 
     checkbox_sdcard_speed.set_value(pmem::config_sdcard_high_speed_io());
+    checkbox_binary_logs.set_value(pmem::binary_decoder_logs());
 
     button_test_sdcard_high_speed.on_select = [&nav, this](Button&) {
         pmem::set_config_sdcard_high_speed_io(true, false);
@@ -430,6 +432,7 @@ SetSDCardView::SetSDCardView(NavigationView& nav) {
 
     button_save.on_select = [&nav, this](Button&) {
         pmem::set_config_sdcard_high_speed_io(checkbox_sdcard_speed.value(), true);
+        pmem::set_binary_decoder_logs(checkbox_binary_logs.value());
         send_system_refresh();
         nav.pop();
     };
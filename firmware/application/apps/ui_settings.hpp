@@ -407,6 +407,11 @@ class SetSDCardView : public View {
         {UI_POS_X_CENTER(28), 198, UI_POS_WIDTH(28), UI_POS_HEIGHT(1)},
         ""};
 
+    Checkbox checkbox_binary_logs{
+        {UI_POS_X_CENTER(26), 222},
+        19,
+        "binary decoder logs"};
+
     Button button_save{
         {UI_POS_X_CENTER(12) - UI_POS_WIDTH(8), UI_POS_Y_BOTTOM(4), UI_POS_WIDTH(12), UI_POS_HEIGHT(2)},
         "Save"};
@@ -331,6 +331,26 @@ void set_spectrum(const size_t sampling_rate, const size_t trigger) {
     send_message(&message);
 }
 
+void set_channel_activity(const uint32_t config_id, const int32_t* const offsets, const size_t count, const uint32_t channel_bandwidth, const int32_t threshold_db) {
+    ChannelActivityConfigMessage message{
+        config_id, channel_bandwidth, threshold_db};
+    message.channel_count = std::min(count, message.offsets.size());
+    std::copy(offsets, offsets + message.channel_count, message.offsets.begin());
+    send_message(&message);
+}
+
+void set_ais_config(const bool dual_channel) {
+    const AISConfigureMessage message{dual_channel};
+    send_message(&message);
+}
+
+void set_nfm_channelizer(const uint32_t sampling_rate, const uint32_t deviation, const int32_t squelch_db, const int32_t monitor_channel) {
+    const NFMChannelizerConfigureMessage message{
+        sampling_rate, deviation, squelch_db, monitor_channel};
+    send_message(&message);
+    audio::set_rate(audio::Rate::Hz_24000);
+}
+
 void set_wefax_config(uint8_t lpm = 120, uint8_t ioc = 0) {
     const WeFaxRxConfigureMessage message{lpm, ioc};
     send_message(&message);
@@ -98,6 +98,9 @@ void set_adsb();
 void set_jammer(const bool run, const jammer::JammerType type, const uint32_t speed);
 void set_rds_data(const uint16_t message_length);
 void set_spectrum(const size_t sampling_rate, const size_t trigger);
+void set_channel_activity(const uint32_t config_id, const int32_t* const offsets, const size_t count, const uint32_t channel_bandwidth, const int32_t threshold_db);
+void set_ais_config(const bool dual_channel);
+void set_nfm_channelizer(const uint32_t sampling_rate, const uint32_t deviation, const int32_t squelch_db, const int32_t monitor_channel);
 void set_siggen_tone(const uint32_t tone);
 void set_siggen_config(const uint32_t bw, const uint32_t shape, const uint32_t duration);
 void set_spectrum_painter_config(const uint16_t width, const uint16_t height, bool update, int32_t bw);
@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2026
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "binary_log.hpp"
+
+#include <algorithm>
+
+#include "portapack_persistent_memory.hpp"
+#include "rtc_time.hpp"
+
+namespace pmem = portapack::persistent_memory;
+
+namespace {
+
+uint32_t now_seconds() {
+    return rtc_time::rtcToUnixUTC(rtc_time::now());
+}
+
+} /* namespace */
+
+BinaryLogFile::BinaryLogFile()
+    : last_flush{now_seconds()} {
+    signal_token_tick_second = rtc_time::signal_tick_second += [this]() {
+        on_tick_second();
+    };
+}
+
+BinaryLogFile::~BinaryLogFile() {
+    rtc_time::signal_tick_second -= signal_token_tick_second;
+    flush();
+}
+
+void BinaryLogFile::on_tick_second() {
+    if (!buffer.empty() && (now_seconds() - last_flush >= flush_interval))
+        flush();
+}
+
+std::unique_ptr<BinaryLogFile> BinaryLogFile::open_if_enabled(const std::filesystem::path& filename) {
+    if (!pmem::binary_decoder_logs())
+        return {};
+
+    auto log = std::make_unique<BinaryLogFile>();
+    auto path = filename;
+    if (log->append(path.replace_extension(u".BLG")))
+        return {};
+
+    return log;
+}
+
+Optional<File::Error> BinaryLogFile::append(const std::filesystem::path& filename) {
+    auto result = ensure_directory(filename.parent_path());
+    if (result.code())
+        return {result};
+
+    auto error = file.append(filename);
+    if (error)
+        return error;
+
+    if (file.size() == 0) {
+        const binlog::FileHeader header{
+            {'P', 'P', 'B', 'L'},
+            binlog::format_version,
+            sizeof(binlog::RecordHeader)};
+        buffer.push(&header, sizeof(header));
+    }
+
+    return {};
+}
+
+void BinaryLogFile::write_record(
+    binlog::RecordType type,
+    const lpc43xx::rtc::RTC& timestamp,
+    uint32_t frequency,
+    const void* payload,
+    size_t length,
+    uint8_t subtype,
+    const PacketMetadata& metadata) {
+    const uint32_t seconds = rtc_time::rtcToUnixUTC(timestamp);
+    const binlog::RecordHeader header{
+        type, subtype, 0, seconds, frequency,
+        metadata.rssi, metadata.snr, 0,
+        metadata.sample_index, metadata.frequency_offset, 0};
+
+    // Oversized text is truncated rather than dropped.
+    length = std::min(length, buffer.max_payload);
+
+    if (!buffer.push(header, payload, length)) {
+        flush();
+        buffer.push(header, payload, length);
+    }
+
+    if (now_seconds() - last_flush >= flush_interval)
+        flush();
+}
+
+Optional<File::Error> BinaryLogFile::flush() {
+    if (buffer.empty())
+        return {};
+
+    auto result = file.write(buffer.data(), buffer.size());
+    buffer.clear();
+    if (result.is_error())
+        return {result.error()};
+
+    last_flush = now_seconds();
+    return file.sync();
+}
@@ -0,0 +1,183 @@
+/*
+ * Copyright (C) 2026
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __BINARY_LOG_H__
+#define __BINARY_LOG_H__
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+#include "file.hpp"
+#include "lpc43xx_cpp.hpp"
+#include "packet_metadata.hpp"
+#include "signal.hpp"
+
+/* Compact binary decoder log (.BLG). A file header is followed by records,
+ * each a fixed RecordHeader and a type-specific payload, all little endian.
+ * tools/decoder_log_export.py turns these files into CSV or JSON. */
+namespace binlog {
+
+constexpr uint16_t format_version = 2;
+constexpr int8_t rssi_unknown = PacketMetadata::db_unknown;
+
+enum class RecordType : uint8_t {
+    Text = 0,
+    ADSB = 1,
+    AIS = 2,
+    POCSAGRaw = 3,
+    POCSAGText = 4,
+    ERT = 5,
+    TPMS = 6,
+    APRS = 7,
+};
+
+struct FileHeader {
+    char magic[4];
+    uint16_t version;
+    uint16_t record_header_size;
+};
+static_assert(sizeof(FileHeader) == 8);
+
+struct RecordHeader {
+    RecordType type;
+    uint8_t subtype;     // ERT packet type, TPMS signal type, ...
+    uint16_t length;     // Payload bytes following this header.
+    uint32_t timestamp;  // RTC seconds since 1970-01-01 UTC.
+    uint32_t frequency;  // Hz, 0 if not known.
+    int8_t rssi;         // dB full scale, rssi_unknown if not measured.
+    int8_t snr;          // dB, rssi_unknown if not measured.
+    uint16_t reserved;
+    /* Version 2; see PacketMetadata. */
+    uint64_t sample_index;
+    int32_t frequency_offset;
+    uint32_t reserved2;
+};
+static_assert(sizeof(RecordHeader) == 32);
+
+/* ADS-B frame with the fields the text log used to print. */
+struct ADSBRecord {
+    enum Valid : uint8_t {
+        Position = 1 << 0,
+        Altitude = 1 << 1,
+        Velocity = 1 << 2,
+    };
+
+    uint8_t raw[14];
+    uint8_t raw_length;  // 7 or 14.
+    uint8_t valid;
+    int32_t altitude;
+    float latitude;
+    float longitude;
+    uint16_t squawk;
+    uint16_t heading;
+    int32_t speed;
+    int32_t v_rate;
+    uint8_t speed_type;
+    uint8_t vel_type;
+    uint8_t sil;
+    uint8_t reserved;
+    char callsign[8];
+    uint32_t icao;
+};
+static_assert(sizeof(ADSBRecord) == 56);
+
+/* Linear staging area for records, drained by the owner in one write. */
+template <size_t N>
+class RecordBuffer {
+   public:
+    static constexpr size_t capacity = N;
+    static constexpr size_t max_payload = N - sizeof(RecordHeader);
+
+    const uint8_t* data() const { return buffer_.data(); }
+    size_t size() const { return fill_; }
+    bool empty() const { return fill_ == 0; }
+    void clear() { fill_ = 0; }
+
+    bool push(const void* src, const size_t length) {
+        if (length > N - fill_)
+            return false;
+        std::memcpy(&buffer_[fill_], src, length);
+        fill_ += length;
+        return true;
+    }
+
+    /* Appends header and payload; header.length is filled in here. */
+    bool push(RecordHeader header, const void* payload, const size_t length) {
+        if (sizeof(header) + length > N - fill_)
+            return false;
+        header.length = length;
+        push(&header, sizeof(header));
+        push(payload, length);
+        return true;
+    }
+
+   private:
+    std::array<uint8_t, N> buffer_{};
+    size_t fill_{0};
+};
+
+} /* namespace binlog */
+
+/* Buffered writer for .BLG files. Records are staged in RAM and written
+ * when the buffer fills, once they have waited flush_interval seconds
+ * (checked on every record and on the RTC second tick, so a decoder going
+ * quiet doesn't leave them in RAM), and when the log is closed. */
+class BinaryLogFile {
+   public:
+    static constexpr size_t buffer_size = 1024;
+    static constexpr uint32_t flush_interval = 2;
+
+    BinaryLogFile();
+    ~BinaryLogFile();
+
+    BinaryLogFile(const BinaryLogFile&) = delete;
+    BinaryLogFile& operator=(const BinaryLogFile&) = delete;
+
+    /* Opens filename with a .BLG extension when binary decoder logs are
+     * enabled in settings. Returns nullptr if disabled or on error. */
+    static std::unique_ptr<BinaryLogFile> open_if_enabled(const std::filesystem::path& filename);
+
+    Optional<File::Error> append(const std::filesystem::path& filename);
+
+    void write_record(
+        binlog::RecordType type,
+        const lpc43xx::rtc::RTC& timestamp,
+        uint32_t frequency,
+        const void* payload,
+        size_t length,
+        uint8_t subtype = 0,
+        const PacketMetadata& metadata = {});
+
+    Optional<File::Error> flush();
+
+   private:
+    File file{};
+    binlog::RecordBuffer<buffer_size> buffer{};
+    uint32_t last_flush{0};
+    SignalToken signal_token_tick_second{};
+
+    void on_tick_second();
+};
+
+#endif /*__BINARY_LOG_H__*/
@@ -24,6 +24,8 @@
 #include "baseband_api.hpp"
 #include "buffer_exchange.hpp"
 
+#include <algorithm>
+
 struct BasebandCapture {
     BasebandCapture(CaptureConfig* const config) {
         baseband::capture_start(config);
@@ -36,20 +38,44 @@ struct BasebandCapture {
 
 // CaptureThread //////////////////////////////////////////////////////////
 
+CaptureStats CaptureThread::stats_{};
+
+static size_t align_to_sector(const size_t bytes) {
+    return (bytes + CaptureThread::sector_size - 1) & ~(CaptureThread::sector_size - 1);
+}
+
 CaptureThread::CaptureThread(
     std::unique_ptr<stream::Writer> writer,
     size_t write_size,
     size_t buffer_count,
     std::function<void()> success_callback,
-    std::function<void(File::Error)> error_callback)
-    : config{write_size, buffer_count},
+    std::function<void(File::Error)> error_callback,
+    uint32_t bytes_per_second)
+    : config{align_to_sector(write_size), adapted_buffer_count(align_to_sector(write_size), buffer_count, bytes_per_second)},
       writer{std::move(writer)},
       success_callback{std::move(success_callback)},
       error_callback{std::move(error_callback)} {
+    stats_ = {};
+    baseband::profile::reset(stats_.write_us);
+    stats_.write_size = config.write_size;
+    stats_.buffer_count = config.buffer_count;
+
     // Need significant stack for FATFS
     thread = chThdCreateFromHeap(NULL, 1024, NORMALPRIO + 10, CaptureThread::static_fn, this);
 }
 
+// Sizes the ring so the buffers filling during the slowest write seen in the
+// previous capture (usually an SD card garbage collection pause) don't overrun.
+size_t CaptureThread::adapted_buffer_count(size_t write_size, size_t buffer_count, uint32_t bytes_per_second) {
+    if (bytes_per_second == 0 || stats_.write_us.count == 0)
+        return buffer_count;
+
+    const uint32_t fill_us = std::max<uint64_t>(1, (uint64_t)write_size * 1000000 / bytes_per_second);
+    const size_t needed = 1 + (stats_.write_us.max + fill_us - 1) / fill_us;
+    const size_t limit = std::max(buffer_count, std::min(max_buffer_count, max_buffer_bytes / write_size));
+    return std::clamp(needed, buffer_count, limit);
+}
+
 CaptureThread::~CaptureThread() {
     if (thread) {
         chThdTerminate(thread);
@@ -71,18 +97,69 @@ msg_t CaptureThread::static_fn(void* arg) {
     return 0;
 }
 
+Optional<File::Error> CaptureThread::write(StreamBuffer* const* batch, size_t count) {
+    const uint32_t ticks_per_us = halGetCounterFrequency() / 1000000;
+    size_t bytes = 0;
+    for (size_t i = 0; i < count; i++)
+        bytes += batch[i]->size();
+
+    const halrtcnt_t start = halGetCounterValue();
+    auto write_result = writer->write(batch[0]->data(), bytes);
+    baseband::profile::record(stats_.write_us, (halGetCounterValue() - start) / ticks_per_us);
+
+    if (write_result.is_error())
+        return write_result.error();
+
+    stats_.bytes_written += bytes;
+    if (count > 1)
+        stats_.writes_coalesced++;
+    return {};
+}
+
 Optional<File::Error> CaptureThread::run() {
     BasebandCapture capture{&config};
     BufferExchange buffers{&config};
 
+    std::array<StreamBuffer*, max_buffer_count> batch{};
+    StreamBuffer* next{nullptr};
+    uint64_t dropped = 0;
+    const auto start_time = chTimeNow();
+
     while (!chThdShouldTerminate()) {
-        auto buffer = buffers.get();
-        auto write_result = writer->write(buffer->data(), buffer->size());
-        if (write_result.is_error()) {
-            return write_result.error();
+        batch[0] = next ? next : buffers.get();
+        next = nullptr;
+        size_t count = 1;
+
+        // StreamInput carves its buffers from one allocation and fills them in order, so
+        // buffers queued up behind a slow write are usually adjacent and go out as one
+        // multi-sector write. Sector sized buffers keep every write sector aligned.
+        while (count < batch.size() && !buffers.empty()) {
+            auto p = buffers.get();
+            const auto prev = batch[count - 1];
+            if (p->data() != static_cast<uint8_t*>(prev->data()) + prev->size()) {
+                next = p;
+                break;
+            }
+            batch[count++] = p;
         }
-        buffer->empty();
-        buffers.put(buffer);
+
+        auto error = write(batch.data(), count);
+        if (error.is_valid())
+            return error;
+
+        for (size_t i = 0; i < count; i++) {
+            batch[i]->empty();
+            buffers.put(batch[i]);
+        }
+
+        if (config.baseband_bytes_dropped != dropped) {
+            dropped = config.baseband_bytes_dropped;
+            stats_.overruns++;
+        }
+
+        const auto elapsed_ms = chTimeNow() - start_time;
+        if (elapsed_ms > 0)
+            stats_.bytes_per_second = config.baseband_bytes_received * 1000 / elapsed_ms;
     }
 
     return {};
@@ -28,19 +28,40 @@
 
 #include "io.hpp"
 #include "optional.hpp"
+#include "baseband_profile.hpp"
 
 #include <cstdint>
 #include <cstddef>
 #include <utility>
 
+/* Write statistics for the running or most recent capture. */
+struct CaptureStats {
+    baseband::profile::StageStats write_us;  // Latency of each file write, in microseconds.
+    uint64_t bytes_written;
+    uint32_t writes_coalesced;  // Writes that merged several StreamBuffers.
+    uint32_t overruns;          // Writes during which the baseband dropped samples.
+    uint32_t write_size;
+    uint32_t buffer_count;
+    uint32_t bytes_per_second;  // Measured stream rate.
+};
+
 class CaptureThread {
    public:
+    static constexpr size_t sector_size = 512;
+    // StreamInput's FIFO capacity.
+    static constexpr size_t max_buffer_count = 8;
+    // Largest ring any app requests today (3 x 16 KiB); what the capture images' heap is known to hold.
+    static constexpr size_t max_buffer_bytes = 48 * 1024;
+
+    /* bytes_per_second, when known, lets the ring grow to cover the
+     * slowest write seen on the card during the previous capture. */
     CaptureThread(
         std::unique_ptr<stream::Writer> writer,
         size_t write_size,
         size_t buffer_count,
         std::function<void()> success_callback,
-        std::function<void(File::Error)> error_callback);
+        std::function<void(File::Error)> error_callback,
+        uint32_t bytes_per_second = 0);
     ~CaptureThread();
 
     CaptureThread(const CaptureThread&) = delete;
@@ -52,16 +73,25 @@ class CaptureThread {
         return config;
     }
 
+    /* Only one capture runs at a time, so the stats outlive the thread for the shell. */
+    static const CaptureStats& stats() {
+        return stats_;
+    }
+
+    static size_t adapted_buffer_count(size_t write_size, size_t buffer_count, uint32_t bytes_per_second);
+
    private:
     CaptureConfig config;
     std::unique_ptr<stream::Writer> writer;
     std::function<void()> success_callback;
     std::function<void(File::Error)> error_callback;
     Thread* thread{nullptr};
+    static CaptureStats stats_;
 
     static msg_t static_fn(void* arg);
 
     Optional<File::Error> run();
+    Optional<File::Error> write(StreamBuffer* const* batch, size_t count);
 };
 
 #endif /*__CAPTURE_THREAD_H__*/
@@ -27,39 +27,141 @@
 #include "lz4.h"
 #include "message.hpp"
 
+#include <array>
 #include <cstring>
 
 using namespace lpc43xx;
 using namespace portapack;
 
-void m4_init(const spi_flash::image_tag_t image_tag, const memory::region_t to, const bool full_reset) {
-    const spi_flash::chunk_t* chunk = reinterpret_cast<const spi_flash::chunk_t*>(spi_flash::images.base());
+namespace {
+
+/* Tag -> chunk lookup, so launching an image doesn't walk the chunk list in SPI flash. */
+struct image_index_entry_t {
+    spi_flash::image_tag_t tag;
+    const spi_flash::chunk_t* chunk;
+};
+
+constexpr size_t image_index_capacity = 64;
+std::array<image_index_entry_t, image_index_capacity> image_index{};
+size_t image_index_count = 0;
+bool image_index_complete = false;
+bool image_index_built = false;
+
+/* What was last decompressed into M4 code RAM. The M4 never writes to its
+ * code region, but M0 code may load other images there, so residency is
+ * confirmed against a checksum before decompression is skipped. */
+struct resident_image_t {
+    spi_flash::image_tag_t tag;
+    uint32_t base;
+    uint32_t checksum;
+    bool valid;
+};
+
+resident_image_t resident_image{};
+m4_image_stats_t image_stats{};
+
+const spi_flash::chunk_t* find_chunk(const spi_flash::image_tag_t image_tag) {
+    if (!image_index_built)
+        m4_image_index_init();
+
+    for (size_t i = 0; i < image_index_count; i++) {
+        if (image_index[i].tag == image_tag)
+            return image_index[i].chunk;
+    }
+    if (image_index_complete)
+        return nullptr;
+
+    // More images than index entries; walk the remaining chunks
+    const spi_flash::chunk_t* chunk = image_index[image_index_count - 1].chunk->next();
     while (chunk->tag) {
-        if (chunk->tag == image_tag) {
-            const void* src = &chunk->data[0];
-            void* dst = reinterpret_cast<void*>(to.base());
+        if (chunk->tag == image_tag)
+            return chunk;
+        chunk = chunk->next();
+    }
+    return nullptr;
+}
 
-            /* extract and initialize M4 code RAM */
-            unlz4_len(src, dst, chunk->compressed_data_size);
+uint32_t region_checksum(const memory::region_t region) {
+    const uint32_t* p = reinterpret_cast<const uint32_t*>(region.base());
+    const uint32_t* const end = reinterpret_cast<const uint32_t*>(region.end());
+    uint32_t sum = 0;
+    while (p < end) {
+        sum = ((sum << 5) | (sum >> 27)) ^ *(p++);
+    }
+    return sum;
+}
 
-            /* M4 core is assumed to be sleeping with interrupts off, so we can mess
-             * with its address space and RAM without concern.
-             */
-            LPC_CREG->M4MEMMAP = to.base();
+void record_load_time(const halrtcnt_t start, const bool resident) {
+    const uint32_t ticks_per_us = halGetCounterFrequency() / 1000000;
+    const uint32_t load_us = (halGetCounterValue() - start) / ticks_per_us;
+    image_stats.last_load_us = load_us;
+    if (load_us > image_stats.max_load_us)
+        image_stats.max_load_us = load_us;
+    image_stats.last_resident = resident;
+}
+
+} /* namespace */
 
-            /* Reset M4 core and optionally all peripherals */
-            LPC_RGU->RESET_CTRL[0] = (full_reset) ? (1 << 1)    // PERIPH_RST
-                                                  : (1 << 13);  // M4_RST
+void m4_image_index_init() {
+    image_index_count = 0;
+    image_index_complete = true;
 
-            return;
+    const spi_flash::chunk_t* chunk = reinterpret_cast<const spi_flash::chunk_t*>(spi_flash::images.base());
+    while (chunk->tag) {
+        if (image_index_count == image_index.size()) {
+            image_index_complete = false;
+            break;
         }
+        image_index[image_index_count++] = {chunk->tag, chunk};
         chunk = chunk->next();
     }
+    image_index_built = true;
+}
 
-    chDbgPanic("NoImg");
+const m4_image_stats_t& m4_image_stats() {
+    return image_stats;
+}
+
+void m4_init(const spi_flash::image_tag_t image_tag, const memory::region_t to, const bool full_reset) {
+    const halrtcnt_t start = halGetCounterValue();
+
+    const spi_flash::chunk_t* chunk = find_chunk(image_tag);
+    if (!chunk)
+        chDbgPanic("NoImg");
+
+    const bool resident = resident_image.valid &&
+                          (resident_image.tag == image_tag) &&
+                          (resident_image.base == to.base()) &&
+                          (resident_image.checksum == region_checksum(to));
+
+    if (resident) {
+        image_stats.resident_hits++;
+    } else {
+        const void* src = &chunk->data[0];
+        void* dst = reinterpret_cast<void*>(to.base());
+
+        /* extract and initialize M4 code RAM */
+        unlz4_len(src, dst, chunk->compressed_data_size);
+
+        resident_image = {image_tag, to.base(), region_checksum(to), true};
+        image_stats.loads++;
+    }
+    record_load_time(start, resident);
+
+    /* M4 core is assumed to be sleeping with interrupts off, so we can mess
+     * with its address space and RAM without concern.
+     */
+    LPC_CREG->M4MEMMAP = to.base();
+
+    /* Reset M4 core and optionally all peripherals */
+    LPC_RGU->RESET_CTRL[0] = (full_reset) ? (1 << 1)    // PERIPH_RST
+                                          : (1 << 13);  // M4_RST
 }
 
 void m4_init_prepared(const uint32_t m4_code, const bool full_reset) {
+    // The caller loaded its own image into M4 code RAM
+    resident_image.valid = false;
+
     /* M4 core is assumed to be sleeping with interrupts off, so we can mess
      * with its address space and RAM without concern.
      */
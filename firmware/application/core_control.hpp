@@ -23,10 +23,24 @@
 #define __CORE_CONTROL_H__
 
 #include <cstddef>
+#include <cstdint>
 
 #include "memory_map.hpp"
 #include "spi_image.hpp"
 
+struct m4_image_stats_t {
+    uint32_t loads;          // Images decompressed from SPI flash
+    uint32_t resident_hits;  // Launches that found the image already in place
+    uint32_t last_load_us;   // Lookup plus decompression (or verification) time of the last launch
+    uint32_t max_load_us;
+    bool last_resident;
+};
+
+/* Builds the tag -> chunk index of the SPI flash images. Called at boot,
+ * m4_init() builds it on first use otherwise. */
+void m4_image_index_init();
+const m4_image_stats_t& m4_image_stats();
+
 void m4_init(const portapack::spi_flash::image_tag_t image_tag, const portapack::memory::region_t to, const bool full_reset);
 void m4_init_prepared(const uint32_t m4_code, const bool full_reset);
 void m4_request_shutdown();
@@ -77,7 +77,25 @@ std::string tamper_flags_scm(TamperFlags value) {
 
 } /* namespace ert */
 
-void ERTLogger::on_packet(const ert::Packet& packet, const uint32_t target_frequency) {
+void ERTLogger::on_packet(const ert::Packet& packet, const uint32_t target_frequency, const PacketMetadata& metadata) {
+    if (binary_log) {
+        // ID (u32), symbol count (u16), then data and error bits, MSB first.
+        constexpr size_t max_bytes = 160;
+        std::array<uint8_t, 6 + 2 * max_bytes> payload{};
+        const uint32_t id = packet.id();
+        std::memcpy(&payload[0], &id, sizeof(id));
+        const uint16_t symbols = packet.symbols_packed(&payload[6], &payload[6 + max_bytes], max_bytes);
+        std::memcpy(&payload[4], &symbols, sizeof(symbols));
+
+        // Compact the error bits down behind the data bits.
+        const size_t bytes = (symbols + 7) / 8;
+        std::memmove(&payload[6 + bytes], &payload[6 + max_bytes], bytes);
+
+        binary_log->write_record(binlog::RecordType::ERT, packet.received_at(), target_frequency,
+                                 payload.data(), 6 + 2 * bytes, static_cast<uint8_t>(packet.type()), metadata);
+        return;
+    }
+
     const auto formatted = packet.symbols_formatted();
     const auto target_frequency_str = to_string_dec_uint(target_frequency, 10);
 
@@ -142,9 +160,9 @@ void ERTAppView::set_parent_rect(const Rect new_parent_rect) {
     recent_entries_view.set_parent_rect({0, header_height, new_parent_rect.width(), new_parent_rect.height() - header_height});
 }
 
-void ERTAppView::on_packet(const ert::Packet& packet) {
+void ERTAppView::on_packet(const ert::Packet& packet, const PacketMetadata& metadata) {
     if (logger) {
-        logger->on_packet(packet, receiver_model.target_frequency());
+        logger->on_packet(packet, receiver_model.target_frequency(), metadata);
     }
 
     if (packet.crc_ok()) {
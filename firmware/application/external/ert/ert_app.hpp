@@ -32,6 +32,7 @@
 #include "event_m0.hpp"
 #include "app_settings.hpp"
 #include "radio_state.hpp"
+#include "binary_log.hpp"
 #include "log_file.hpp"
 
 #include "ert_packet.hpp"
@@ -95,13 +96,17 @@ struct ERTRecentEntry {
 class ERTLogger {
    public:
     Optional<File::Error> append(const std::filesystem::path& filename) {
+        binary_log = BinaryLogFile::open_if_enabled(filename);
+        if (binary_log)
+            return {};
         return log_file.append(filename);
     }
 
-    void on_packet(const ert::Packet& packet, const uint32_t target_frequency);
+    void on_packet(const ert::Packet& packet, const uint32_t target_frequency, const PacketMetadata& metadata);
 
    private:
     LogFile log_file{};
+    std::unique_ptr<BinaryLogFile> binary_log{};
 };
 
 namespace ui::external_app::ert_app {
@@ -172,7 +177,7 @@ class ERTAppView : public View {
         [this](Message* const p) {
             const auto message = static_cast<const ERTPacketMessage*>(p);
             const ert::Packet packet{message->type, message->packet};
-            this->on_packet(packet);
+            this->on_packet(packet, message->metadata);
         }};
 
     MessageHandlerRegistration message_handler_freqchg{
@@ -183,7 +188,7 @@ class ERTAppView : public View {
         }};
 
     void on_freqchg(int64_t freq);
-    void on_packet(const ert::Packet& packet);
+    void on_packet(const ert::Packet& packet, const PacketMetadata& metadata);
     void on_show_list();
 };
 
@@ -276,6 +276,10 @@ set(EXTCPPSRC
 	#subcarrx
 	external/subcarrx/main.cpp
 	external/subcarrx/ui_subcar.cpp
+
+	#nfm_channelizer
+	external/nfm_channelizer/main.cpp
+	external/nfm_channelizer/ui_nfm_channelizer.cpp
 )
 
 set(EXTAPPLIST
@@ -345,4 +349,5 @@ set(EXTAPPLIST
 	adult_toys_controller
 	flex_rx
 	subcarrx
+	nfm_channelizer
 )
@@ -324,11 +324,13 @@ size_t LevelView::change_mode(freqman_index_t new_mod) {
     return step_mode.selected_index();
 }
 
-void LevelView::handle_coded_squelch(const uint32_t value) {
-    if (field_mode.selected_index() == NFM_MODULATION)
-        text_ctcss.set(tone_key_string_by_value(value, text_ctcss.parent_rect().width() / 8));
-    else
+void LevelView::handle_coded_squelch(const CodedSquelchMessage& message) {
+    if (field_mode.selected_index() != NFM_MODULATION)
         text_ctcss.set("        ");
+    else if (message.type == CodedSquelchMessage::Type::DCS)
+        text_ctcss.set(dcs_code_string(message.value, message.inverted));
+    else
+        text_ctcss.set(tone_key_string_by_value(message.value, text_ctcss.parent_rect().width() / 8));
 }
 
 void LevelView::on_freqchg(int64_t freq) {
@@ -0,0 +1,285 @@
+/*
+ * Copyright (C) 2026
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "ui_nfm_channelizer.hpp"
+#include "audio.hpp"
+#include "baseband_api.hpp"
+#include "string_format.hpp"
+#include "file_path.hpp"
+#include "rtc_time.hpp"
+#include "tone_key.hpp"
+
+using namespace portapack;
+using namespace ui;
+using namespace tonekey;
+
+namespace ui::external_app::nfm_channelizer {
+
+static std::string code_string(const NFMChannelEvent& event) {
+    switch (event.code_type) {
+        case NFMChannelEvent::Code::CTCSS:
+            return tone_key_string_by_value(event.code_value, 8);
+        case NFMChannelEvent::Code::DCS:
+            return dcs_code_string(event.code_value, event.code_inverted);
+        default:
+            return "";
+    }
+}
+
+ChannelLevels::ChannelLevels(Rect parent_rect)
+    : Widget{parent_rect} {
+}
+
+void ChannelLevels::set_levels(const ChannelActivity& activity) {
+    levels_ = activity;
+    set_dirty();
+}
+
+void ChannelLevels::set_monitor(const int32_t channel) {
+    monitor_ = channel;
+    set_dirty();
+}
+
+void ChannelLevels::paint(Painter& painter) {
+    const auto r = screen_rect();
+    const int bar_width = r.width() / channel_count;
+    const int bar_area = r.height() - 3;
+
+    painter.fill_rectangle(r, Theme::getInstance()->bg_darkest->background);
+
+    for (size_t i = 0; i < channel_count; i++) {
+        const int32_t db = std::clamp<int32_t>(levels_.db[i], db_min, db_max);
+        const int height = (db - db_min) * bar_area / (db_max - db_min);
+        const bool active = levels_.active & (1U << i);
+        const int x = r.left() + i * bar_width;
+
+        painter.fill_rectangle(
+            {x + 1, r.top() + bar_area - height, bar_width - 2, height},
+            active ? Color::green() : Color::grey());
+
+        if (static_cast<int32_t>(i) - static_cast<int32_t>(channel_count / 2) == monitor_)
+            painter.fill_rectangle({x, r.bottom() - 2, bar_width, 2}, Color::yellow());
+    }
+}
+
+void NFMChannelizerLogger::log_event(const rf::Frequency frequency, const NFMChannelEvent& event) {
+    std::string entry = ";" + to_string_dec_uint(frequency) + ";";
+    entry += event.active ? "open" : "close";
+    entry += ";" + to_string_dec_int(event.db) + ";" + to_string_dec_int(event.snr) + ";";
+    entry += to_string_dec_int(event.offset_hz) + ";" + to_string_dec_uint(event.duration_ms) + ";";
+    entry += code_string(event);
+    log_file.write_entry(entry);
+}
+
+SnippetWriter::SnippetWriter(const uint32_t sampling_rate, PathFunction make_path)
+    : sampling_rate_{sampling_rate},
+      make_path_{std::move(make_path)} {
+}
+
+File::Result<File::Size> SnippetWriter::write(const void* const buffer, const File::Size bytes) {
+    const auto frames = static_cast<const NFMChannelAudioFrame*>(buffer);
+    for (size_t i = 0; i < bytes / sizeof(NFMChannelAudioFrame); i++) {
+        const auto error = on_frame(frames[i]);
+        if (error.is_valid())
+            return error.value();
+    }
+    return File::Size{bytes};
+}
+
+Optional<File::Error> SnippetWriter::on_frame(const NFMChannelAudioFrame& frame) {
+    if ((frame.magic != NFMChannelAudioFrame::magic_value) || (frame.slot >= slot_count) ||
+        (frame.count > NFMChannelAudioFrame::sample_count))
+        return {};
+
+    auto& file = files_[frame.slot];
+    if (frame.flags & NFMChannelAudioFrame::Start) file.reset();
+
+    if (!file) {
+        /* Recording started mid transmission and this is its tail, nothing worth keeping. */
+        if (frame.flags & NFMChannelAudioFrame::End) return {};
+
+        file = std::make_unique<WAVFileWriter>();
+        const auto error = file->create(make_path_(frame.channel), sampling_rate_, "");
+        if (error.is_valid()) {
+            file.reset();
+            return error;
+        }
+        samples_[frame.slot] = 0;
+    }
+
+    /* A stuck carrier would otherwise fill the card, keep the start of it. */
+    if (samples_[frame.slot] < max_seconds * sampling_rate_) {
+        const auto result = file->write(frame.samples.data(), frame.count * sizeof(int16_t));
+        if (result.is_error())
+            return result.error();
+        samples_[frame.slot] += frame.count;
+    }
+
+    if (frame.flags & NFMChannelAudioFrame::End) file.reset();
+    return {};
+}
+
+NFMChannelizerView::NFMChannelizerView(NavigationView& nav)
+    : nav_{nav} {
+    add_children({&field_frequency,
+                  &field_rf_amp,
+                  &field_lna,
+                  &field_vga,
+                  &rssi,
+                  &channel,
+                  &field_volume,
+                  &labels,
+                  &field_spacing,
+                  &field_squelch,
+                  &field_monitor,
+                  &check_log,
+                  &text_monitor,
+                  &check_rec,
+                  &channel_levels,
+                  &console});
+
+    baseband::run_prepared_image(portapack::memory::map::m4_code.base());
+    logger = std::make_unique<NFMChannelizerLogger>();
+
+    if (spacing != 20000 && spacing != 25000) spacing = 12500;
+    field_frequency.set_step(spacing);
+    field_frequency.updated = [this](rf::Frequency) {
+        update_monitor_text();
+    };
+
+    field_spacing.set_by_value(spacing);
+    field_spacing.on_change = [this](size_t, OptionsField::value_t v) {
+        spacing = v;
+        field_frequency.set_step(spacing);
+        /* Snippet sample rate follows the spacing. */
+        if (capture_thread) start_recording();
+        configure_baseband();
+    };
+
+    field_squelch.set_value(squelch_db);
+    field_squelch.on_change = [this](int32_t v) {
+        squelch_db = v;
+        configure_baseband();
+    };
+
+    field_monitor.set_value(monitor_channel);
+    field_monitor.on_change = [this](int32_t v) {
+        monitor_channel = v;
+        configure_baseband();
+    };
+
+    /* Set the handler first so a saved "log" setting opens the file. */
+    check_log.on_select = [this](Checkbox&, bool v) {
+        logging = v;
+        if (logger && logging) {
+            logger->append(logs_dir.string() + "/NFMCHAN_" + to_string_timestamp(rtc_time::now()) + ".CSV");
+            logger->write_header();
+        }
+    };
+    check_log.set_value(logging);
+
+    check_rec.on_select = [this](Checkbox&, bool v) {
+        if (v)
+            start_recording();
+        else
+            stop_recording();
+    };
+
+    configure_baseband();
+    receiver_model.enable();
+    audio::output::start();
+}
+
+NFMChannelizerView::~NFMChannelizerView() {
+    capture_thread.reset();
+    audio::output::stop();
+    receiver_model.disable();
+    baseband::shutdown();
+}
+
+void NFMChannelizerView::focus() {
+    field_frequency.focus();
+}
+
+rf::Frequency NFMChannelizerView::channel_frequency(const int32_t channel) const {
+    return receiver_model.target_frequency() + (int64_t)channel * spacing;
+}
+
+void NFMChannelizerView::update_monitor_text() {
+    text_monitor.set("Mon " + to_string_short_freq(channel_frequency(monitor_channel)) + " span " +
+                     to_string_dec_uint(spacing * channel_count / 1000) + "k");
+    channel_levels.set_monitor(monitor_channel);
+}
+
+void NFMChannelizerView::configure_baseband() {
+    /* The filter bank runs on the /8 decimator output, one channel per spacing. */
+    const uint32_t sampling_rate = spacing * channel_count * 8;
+    receiver_model.set_sampling_rate(sampling_rate);
+    baseband::set_nfm_channelizer(sampling_rate, spacing <= 12500 ? 2500 : 5000, squelch_db, monitor_channel);
+    update_monitor_text();
+}
+
+void NFMChannelizerView::start_recording() {
+    capture_thread.reset();
+    ensure_directory(audio_dir);
+
+    /* Snippets carry half rate discriminator audio, see NFMChannelAudioFrame. */
+    auto writer = std::make_unique<SnippetWriter>(
+        spacing / 2,
+        [this](const int8_t channel) {
+            return audio_dir / ("NFMC_" + to_string_timestamp(rtc_time::now()) + "_" +
+                                to_string_dec_uint(channel_frequency(channel) / 1000) + ".WAV");
+        });
+
+    capture_thread = std::make_unique<CaptureThread>(
+        std::move(writer),
+        4096, 4,
+        []() {
+            CaptureThreadDoneMessage message{};
+            EventDispatcher::send_message(message);
+        },
+        [](File::Error error) {
+            CaptureThreadDoneMessage message{error.code()};
+            EventDispatcher::send_message(message);
+        });
+}
+
+void NFMChannelizerView::stop_recording() {
+    capture_thread.reset();
+    check_rec.set_value(false);
+}
+
+void NFMChannelizerView::on_event(const NFMChannelEvent& event) {
+    const auto frequency = channel_frequency(event.channel);
+    std::string line = to_string_datetime(rtc_time::now(), HMS) + " " + to_string_short_freq(frequency);
+
+    if (event.active) {
+        line += " " + to_string_dec_int(event.db) + "dB";
+    } else {
+        line += " " + to_string_time_ms(event.duration_ms) + " " + to_string_dec_int(event.offset_hz) + "Hz";
+        if (event.code_type != NFMChannelEvent::Code::None) line += " " + code_string(event);
+    }
+    console.writeln(line);
+
+    if (logger && logging) logger->log_event(frequency, event);
+}
+
+}  // namespace ui::external_app::nfm_channelizer
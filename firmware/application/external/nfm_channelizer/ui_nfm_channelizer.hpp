@@ -0,0 +1,230 @@
+/*
+ * Copyright (C) 2026
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __UI_NFM_CHANNELIZER_H__
+#define __UI_NFM_CHANNELIZER_H__
+
+#include "ui.hpp"
+#include "ui_navigation.hpp"
+#include "ui_receiver.hpp"
+#include "ui_freq_field.hpp"
+#include "app_settings.hpp"
+#include "radio_state.hpp"
+#include "log_file.hpp"
+#include "capture_thread.hpp"
+#include "io_wave.hpp"
+#include "message.hpp"
+
+#include <functional>
+
+using namespace ui;
+
+namespace ui::external_app::nfm_channelizer {
+
+/* One bar per channel, lowest frequency on the left. */
+class ChannelLevels : public Widget {
+   public:
+    ChannelLevels(Rect parent_rect);
+
+    void set_levels(const ChannelActivity& activity);
+    void set_monitor(const int32_t channel);
+
+    void paint(Painter& painter) override;
+
+   private:
+    static constexpr size_t channel_count = NFMChannelizerConfigureMessage::channel_count;
+    static constexpr int32_t db_min = -100;
+    static constexpr int32_t db_max = -20;
+
+    ChannelActivity levels_{};
+    int32_t monitor_{0};
+};
+
+class NFMChannelizerLogger {
+   public:
+    Optional<File::Error> append(const std::filesystem::path& filename) {
+        return log_file.append(filename);
+    }
+
+    void log_event(const rf::Frequency frequency, const NFMChannelEvent& event);
+    void write_header() {
+        log_file.write_entry(";Frequency;State;dB;SNR;Offset;Duration ms;Code");
+    }
+
+   private:
+    LogFile log_file{};
+};
+
+/* Splits the multiplexed channel audio into one WAV file per transmission. */
+class SnippetWriter : public stream::Writer {
+   public:
+    using PathFunction = std::function<std::filesystem::path(const int8_t channel)>;
+
+    SnippetWriter(const uint32_t sampling_rate, PathFunction make_path);
+
+    File::Result<File::Size> write(const void* const buffer, const File::Size bytes) override;
+
+   private:
+    static constexpr size_t slot_count = NFMChannelAudioFrame::slot_count;
+    static constexpr uint32_t max_seconds = 60;
+
+    const uint32_t sampling_rate_;
+    PathFunction make_path_;
+    std::array<std::unique_ptr<WAVFileWriter>, slot_count> files_{};
+    std::array<uint32_t, slot_count> samples_{};
+
+    Optional<File::Error> on_frame(const NFMChannelAudioFrame& frame);
+};
+
+class NFMChannelizerView : public View {
+   public:
+    NFMChannelizerView(NavigationView& nav);
+    ~NFMChannelizerView();
+
+    void focus() override;
+
+    std::string title() const override { return "NFM Chan"; };
+
+   private:
+    static constexpr int32_t channel_count = NFMChannelizerConfigureMessage::channel_count;
+
+    NavigationView& nav_;
+    RxRadioState radio_state_{
+        446'100'000 /* frequency */,
+        1'750'000 /* bandwidth */,
+        3'200'000 /* sampling rate */,
+        ReceiverModel::Mode::NarrowbandFMAudio};
+
+    uint32_t spacing = 12500;
+    int32_t squelch_db = 10;
+    int32_t monitor_channel = 0;
+    bool logging = false;
+    app_settings::SettingsManager settings_{
+        "rx_nfm_channelizer",
+        app_settings::Mode::RX,
+        {
+            {"spacing"sv, &spacing},
+            {"squelch"sv, &squelch_db},
+            {"monitor"sv, &monitor_channel},
+            {"log"sv, &logging},
+        }};
+
+    std::unique_ptr<NFMChannelizerLogger> logger{};
+    std::unique_ptr<CaptureThread> capture_thread{};
+
+    RxFrequencyField field_frequency{
+        {UI_POS_X(0), UI_POS_Y(0)},
+        nav_};
+    RFAmpField field_rf_amp{
+        {13 * 8, UI_POS_Y(0)}};
+    LNAGainField field_lna{
+        {15 * 8, UI_POS_Y(0)}};
+    VGAGainField field_vga{
+        {18 * 8, UI_POS_Y(0)}};
+    RSSI rssi{
+        {21 * 8, 0, UI_POS_WIDTH(6), 4}};
+    Channel channel{
+        {21 * 8, 5, UI_POS_WIDTH(6), 4}};
+    AudioVolumeField field_volume{
+        {UI_POS_X_RIGHT(2), UI_POS_Y(0)}};
+
+    Labels labels{
+        {{UI_POS_X(0), UI_POS_Y(1)}, "Sp:", Theme::getInstance()->fg_light->foreground},
+        {{UI_POS_X(10), UI_POS_Y(1)}, "Sq:", Theme::getInstance()->fg_light->foreground},
+        {{UI_POS_X(16), UI_POS_Y(1)}, "Mon:", Theme::getInstance()->fg_light->foreground},
+    };
+
+    OptionsField field_spacing{
+        {UI_POS_X(3), UI_POS_Y(1)},
+        6,
+        {
+            {"12.5k", 12500},
+            {"20k", 20000},
+            {"25k", 25000},
+        }};
+    NumberField field_squelch{
+        {UI_POS_X(13), UI_POS_Y(1)},
+        2,
+        {3, 30},
+        1,
+        ' '};
+    NumberField field_monitor{
+        {UI_POS_X(20), UI_POS_Y(1)},
+        3,
+        {-channel_count / 2, channel_count / 2 - 1},
+        1,
+        ' '};
+    Checkbox check_log{
+        {UI_POS_X(24), UI_POS_Y(1)},
+        3,
+        "Log",
+        true};
+
+    Text text_monitor{
+        {UI_POS_X(0), UI_POS_Y(2), UI_POS_WIDTH(24), UI_POS_HEIGHT(1)},
+        ""};
+    Checkbox check_rec{
+        {UI_POS_X(24), UI_POS_Y(2)},
+        3,
+        "Rec",
+        true};
+
+    ChannelLevels channel_levels{
+        {0, UI_POS_Y(3), screen_width, 32}};
+
+    Console console{
+        {0, UI_POS_Y(3) + 36, screen_width, screen_height - (UI_POS_Y(3) + 36)}};
+
+    rf::Frequency channel_frequency(const int32_t channel) const;
+    void update_monitor_text();
+    void configure_baseband();
+    void on_event(const NFMChannelEvent& event);
+    void start_recording();
+    void stop_recording();
+
+    MessageHandlerRegistration message_handler_levels{
+        Message::ID::ChannelActivity,
+        [this](const Message* const p) {
+            const auto message = static_cast<const ChannelActivityMessage*>(p);
+            this->channel_levels.set_levels(message->activity);
+        }};
+
+    MessageHandlerRegistration message_handler_event{
+        Message::ID::NFMChannelEvent,
+        [this](const Message* const p) {
+            const auto message = static_cast<const NFMChannelEventMessage*>(p);
+            this->on_event(message->event);
+        }};
+
+    MessageHandlerRegistration message_handler_capture_thread_done{
+        Message::ID::CaptureThreadDone,
+        [this](const Message* const p) {
+            const auto message = *reinterpret_cast<const CaptureThreadDoneMessage*>(p);
+            if (message.error) {
+                this->console.writeln("Rec: " + File::Error{message.error}.what());
+                this->stop_recording();
+            }
+        }};
+};
+
+}  // namespace ui::external_app::nfm_channelizer
+
+#endif /*__UI_NFM_CHANNELIZER_H__*/
@@ -486,6 +486,10 @@ void RemoteAppView::send_button(RemoteButton& btn) {
         return;
     }
 
+    // C8 files are streamed as-is, the baseband interpolator handles them natively.
+    const bool c8_samples = reader->convert_c8_to_c16;
+    reader->convert_c8_to_c16 = false;
+
     // Update the sample rate in proc_replay baseband.
     baseband::set_sample_rate(
         btn.entry()->metadata.sample_rate,
@@ -506,7 +510,8 @@ void RemoteAppView::send_button(RemoteButton& btn) {
         [](uint32_t return_code) {
             ReplayThreadDoneMessage message{return_code};
             EventDispatcher::send_message(message);
-        });
+        },
+        c8_samples);
 }
 
 void RemoteAppView::stop() {
@@ -101,6 +101,17 @@ void ScannerThread::set_scanning_direction(bool fwd) {
     }
 }
 
+// Channelized mode: ScannerView steps through blocks from ChannelActivity reports,
+// the thread only follows forced steps and keeps the lock coloring going.
+void ScannerThread::set_channelized(const bool v) {
+    _channelized = v;
+}
+
+// Index of the channel ScannerView retuned to in channelized mode.
+void ScannerThread::set_frequency_index(const uint32_t v) {
+    _freq_idx = v;
+}
+
 msg_t ScannerThread::static_fn(void* arg) {
     auto obj = static_cast<ScannerThread*>(arg);
     obj->run();
@@ -118,7 +129,14 @@ void ScannerThread::run() {
             bool force_one_step = (_index_stepper != 0);
             int32_t step = force_one_step ? _index_stepper : _stepper;  //_index_stepper direction takes priority
 
-            if (_scanning || force_one_step) {              // Scanning, or paused and using rotary encoder
+            if (_channelized && _scanning && !force_one_step) {  // Channelized, stepping is done by the view
+                frequency_index = (_freq_idx < (uint32_t)size) ? _freq_idx : 0;
+                if (_freq_lock != 0) {
+                    message.freq = frequency_list_[frequency_index];
+                    message.range = frequency_index;  // Inform freq for coloring
+                    EventDispatcher::send_message(message);
+                }
+            } else if (_scanning || force_one_step) {       // Scanning, or paused and using rotary encoder
                 if ((_freq_lock == 0) || force_one_step) {  // normal scanning (not performing freq_lock)
                     frequency_index += step;
                     if (frequency_index >= size)  // Wrap
@@ -130,6 +148,7 @@ void ScannerThread::run() {
                         _index_stepper = 0;
 
                     receiver_model.set_target_frequency(frequency_list_[frequency_index]);  // Retune
+                    _freq_idx = frequency_index;
                 }
                 message.freq = frequency_list_[frequency_index];
                 message.range = frequency_index;  // Inform freq (for coloring purposes also!)
@@ -250,11 +269,110 @@ void ScannerView::handle_encoder(EncoderEvent delta) {
     if (scan_thread)
         scan_thread->set_index_stepper(index_step);
 
+    // Manual step leaves the block measurement, next quiet period moves on to the next block.
+    if (channelized)
+        channelized_state = channelized_state_t::Verifying;
+
     // Restart browse timer when frequency changes.
     if (browse_timer != 0)
         browse_timer = 1;
 }
 
+void ScannerView::build_channel_blocks() {
+    // Group consecutive list entries that fit in one channelized measurement.
+    blocks.clear();
+    for (uint32_t i = 0; i < entries.size(); i++) {
+        const auto freq = entries[i].freq;
+        if (!blocks.empty()) {
+            auto& block = blocks.back();
+            const auto low = std::min(block.low, freq);
+            const auto high = std::max(block.high, freq);
+            if ((block.count < ChannelActivityConfigMessage::max_channels) && (high - low <= CHANNELIZED_MAX_SPAN)) {
+                block.low = low;
+                block.high = high;
+                block.count++;
+                continue;
+            }
+        }
+        blocks.push_back({i, 1, freq, freq});
+    }
+
+    if (current_block >= blocks.size())
+        current_block = 0;
+}
+
+void ScannerView::update_channelized() {
+    // Channel power is measured by the NFM baseband image only.
+    channelized = !manual_search && !blocks.empty() && scan_thread &&
+                  (receiver_model.modulation() == ReceiverModel::Mode::NarrowbandFMAudio);
+    channelized_state = channelized_state_t::Idle;
+
+    if (scan_thread) {
+        scan_thread->set_channelized(channelized);
+        if (channelized && scan_thread->is_scanning())
+            channelized_measure_block(0);
+    }
+}
+
+void ScannerView::channelized_measure_block(int32_t step) {
+    if (blocks.empty())
+        return;
+
+    const int32_t count = blocks.size();
+    current_block = (((int32_t)current_block + step) % count + count) % count;
+    const auto& block = blocks[current_block];
+    const rf::Frequency center = block.low + (block.high - block.low) / 2;
+    if (step != 0)
+        block_last_hit = block.count - 1;  // Round robin starts at the first channel of a new block
+
+    std::array<int32_t, ChannelActivityConfigMessage::max_channels> offsets{};
+    for (uint32_t i = 0; i < block.count; i++)
+        offsets[i] = entries[block.first + i].freq - center;
+
+    receiver_model.set_target_frequency(center);
+    baseband::set_channel_activity(++activity_config_id, offsets.data(), block.count, CHANNELIZED_BANDWIDTH, squelch);
+    channelized_state = channelized_state_t::Measuring;
+    activity_wait = 0;
+
+    current_index = block.first;
+    current_frequency = center;
+    bigdisplay_update(BDC_GREY);
+    field_current_index.set_text(to_string_dec_uint(block.first + 1, 3));
+    text_current_desc.set("BLOCK " + to_string_dec_uint(current_block + 1) + "/" + to_string_dec_uint(blocks.size()) +
+                          " (" + to_string_dec_uint(block.count) + " ch)");
+}
+
+void ScannerView::on_channel_activity(const ChannelActivity& activity) {
+    if (!channelized || (channelized_state != channelized_state_t::Measuring) || (activity.config_id != activity_config_id))
+        return;
+
+    if (!scan_thread || !scan_thread->is_scanning())
+        return;
+
+    if (activity.active == 0) {
+        channelized_measure_block(fwd ? 1 : -1);
+        return;
+    }
+
+    // Round robin inside the block so one busy channel doesn't hide its neighbours.
+    const auto& block = blocks[current_block];
+    uint32_t hit = 0;
+    for (uint32_t n = 1; n <= block.count; n++) {
+        const uint32_t c = (block_last_hit + n) % block.count;
+        if (activity.active & (1U << c)) {
+            hit = c;
+            break;
+        }
+    }
+    block_last_hit = hit;
+
+    const uint32_t index = block.first + hit;
+    receiver_model.set_target_frequency(entries[index].freq);
+    scan_thread->set_frequency_index(index);
+    channelized_state = channelized_state_t::Verifying;
+    handle_retune(entries[index].freq, index);
+}
+
 std::string ScannerView::loaded_filename() const {
     auto filename = freqman_file;
     if (filename.length() > 23) {  // Truncate long file name.
@@ -353,6 +471,8 @@ ScannerView::ScannerView(
         if (scan_thread && entries.size()) {
             scan_thread->stop();  // STOP SCANNER THREAD
             entries.clear();
+            build_channel_blocks();
+            update_channelized();
 
             show_max_index();  // UPDATE new list size on screen
             field_current_index.set_text("");
@@ -426,6 +546,7 @@ ScannerView::ScannerView(
             // Remove frequency from the Freq List in memory (it is not removed from the file).
             scan_thread->set_freq_del(entries[current_index].freq);
             entries.erase(entries.begin() + current_index);
+            build_channel_blocks();
 
             show_max_index();               // UPDATE new list size on screen
             text_current_desc.set("");      // Clean up description (cosmetic detail)
@@ -469,6 +590,7 @@ ScannerView::ScannerView(
         if (scan_thread && !scan_thread->is_scanning())  // for some motive, audio output gets stopped.
             audio::output::start();                      // So if scan was stopped we resume audio
         receiver_model.enable();
+        update_channelized();
     };
 
     // Step field was changed (Hz) -- only affects manual Search mode
@@ -515,6 +637,7 @@ ScannerView::ScannerView(
                 // max count we can load into memory.
                 if (entries.size() < FREQMAN_MAX_PER_FILE) {
                     entries.push_back({current_frequency, ""});
+                    build_channel_blocks();
                     show_max_index();  // Display updated frequency list size
                 }
             }
@@ -631,6 +754,13 @@ void ScannerView::on_statistics_update(const ChannelStatistics& statistics) {
         update_squelch_while_paused(statistics.max_db);
     } else if (scan_thread)  // Scanning not user-paused
     {
+        // Statistics are for the block center while measuring, nothing to lock on.
+        if (channelized && (channelized_state == channelized_state_t::Measuring) && scan_thread->is_scanning()) {
+            if (++activity_wait > CHANNELIZED_TIMEOUT)
+                channelized_measure_block(0);  // Report got lost, measure again
+            return;
+        }
+
         // Resume regardless of signal strength if browse time reached
         if ((browse_wait != 0) && (browse_timer >= (browse_wait * STATISTICS_UPDATES_PER_SEC))) {
             browse_timer = 0;
@@ -655,6 +785,8 @@ void ScannerView::on_statistics_update(const ChannelStatistics& statistics) {
                         bigdisplay_update(BDC_GREY);        // Back to grey color
                         scan_thread->set_freq_lock(0);      // Reset the scanner lock, since there is no sig
                     }
+                    if (channelized && (channelized_state == channelized_state_t::Verifying))
+                        channelized_measure_block(fwd ? 1 : -1);  // Active channel went quiet, back to block scanning
                 } else {
                     // Signal lost and scan is still paused
                     lock_timer++;                                                  // Bump paused time
@@ -685,7 +817,10 @@ void ScannerView::scan_resume() {
     bigdisplay_update(BDC_GREY);  // Back to grey color
 
     if (scan_thread) {
-        scan_thread->set_index_stepper(fwd ? 1 : -1);
+        if (channelized)
+            channelized_measure_block(fwd ? 1 : -1);
+        else
+            scan_thread->set_index_stepper(fwd ? 1 : -1);
         scan_thread->set_scanning(true);  // RESUME!
     }
 }
@@ -755,6 +890,9 @@ void ScannerView::start_scan_thread() {
     }
 
     scan_thread->set_scanning_direction(fwd);
+
+    build_channel_blocks();
+    update_channelized();
 }
 
 void ScannerView::restart_scan() {
@@ -42,6 +42,9 @@ namespace ui::external_app::scanner {
 #define SCANNER_SLEEP_MS 50  // ms that Scanner Thread sleeps per loop
 #define STATISTICS_UPDATES_PER_SEC 10
 #define MAX_FREQ_LOCK 10  // # of 50ms cycles scanner locks into freq when signal detected, to verify signal is not spurious
+#define CHANNELIZED_MAX_SPAN 200000  // Hz covered by one channelized measurement, decim_0 droop stays under ~3 dB within +/-100 kHz
+#define CHANNELIZED_BANDWIDTH 8000   // Hz around each channel center searched for a carrier
+#define CHANNELIZED_TIMEOUT 3        // # of statistics updates to wait for a ChannelActivity report before re-arming
 
 // TODO: There is too much duplicated data in these classes.
 // ScannerThread should just use more from the View.
@@ -61,6 +64,14 @@ struct scanner_range_t {
     int64_t max;
 };
 
+// Run of consecutive list entries measured together by the channelized (NFM) scan.
+struct scanner_block_t {
+    uint32_t first;
+    uint32_t count;
+    rf::Frequency low;
+    rf::Frequency high;
+};
+
 class ScannerThread {
    public:
     ScannerThread(std::vector<rf::Frequency> frequency_list);
@@ -76,6 +87,8 @@ class ScannerThread {
     void set_freq_del(const rf::Frequency v);
     void set_index_stepper(const int32_t v);
     void set_scanning_direction(bool fwd);
+    void set_channelized(const bool v);
+    void set_frequency_index(const uint32_t v);
 
     void stop();
 
@@ -92,6 +105,7 @@ class ScannerThread {
 
     bool _scanning{true};
     bool _manual_search{false};
+    bool _channelized{false};
     uint32_t _freq_lock{0};
     rf::Frequency _freq_del{0};
     uint32_t _freq_idx{0};
@@ -149,6 +163,10 @@ class ScannerView : public View {
     void on_statistics_update(const ChannelStatistics& statistics);
     void handle_retune(int64_t freq, uint32_t freq_idx);
     void handle_encoder(EncoderEvent delta);
+    void build_channel_blocks();
+    void update_channelized();
+    void channelized_measure_block(int32_t step);
+    void on_channel_activity(const ChannelActivity& activity);
     std::string loaded_filename() const;
 
     uint32_t browse_timer{0};
@@ -165,6 +183,21 @@ class ScannerView : public View {
     bool manual_search{false};
     bool fwd{true};  // to preserve direction setting even if scan_thread restarted
 
+    // Channelized scan: one FFT measures a whole block, only retune once a channel is active.
+    enum class channelized_state_t {
+        Idle,
+        Measuring,  // Tuned to block center, waiting for a ChannelActivity report
+        Verifying   // Tuned to an active channel, regular squelch/lock logic applies
+    };
+
+    bool channelized{false};
+    channelized_state_t channelized_state{channelized_state_t::Idle};
+    std::vector<scanner_block_t> blocks{};
+    uint32_t current_block{0};
+    uint32_t block_last_hit{0};
+    uint32_t activity_config_id{0};
+    uint32_t activity_wait{0};
+
     enum bigdisplay_color_type {
         BDC_GREY,
         BDC_YELLOW,
@@ -314,6 +347,12 @@ class ScannerView : public View {
             this->handle_retune(message.freq, message.range);
         }};
 
+    MessageHandlerRegistration message_handler_channel_activity{
+        Message::ID::ChannelActivity,
+        [this](const Message* const p) {
+            this->on_channel_activity(static_cast<const ChannelActivityMessage*>(p)->activity);
+        }};
+
     MessageHandlerRegistration message_handler_stats{
         Message::ID::ChannelStatistics,
         [this](const Message* const p) {
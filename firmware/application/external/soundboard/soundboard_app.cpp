@@ -100,17 +100,15 @@ void SoundBoardView::start_tx(const uint32_t id) {
 
     playing_id = id;
 
-    progressbar.set_max(reader->sample_count());
+    auto resampled = std::make_unique<WAVResampledReader>(std::move(reader), tx_sample_rate);
+    progressbar.set_max(resampled->sample_count());
 
     // button_play.set_bitmap(&bitmap_stop);
 
-    uint32_t sample_rate = reader->sample_rate();
-
     tone_key_index = options_tone_key.selected_index();
-    bits_per_sample = reader->bits_per_sample();
 
     replay_thread = std::make_unique<ReplayThread>(
-        std::move(reader),
+        std::move(resampled),
         read_size, buffer_count,
         &ready_signal,
         [](uint32_t return_code) {
@@ -131,7 +129,7 @@ void SoundBoardView::start_tx(const uint32_t id) {
         false,  // USB
         false   // LSB
     );
-    baseband::set_sample_rate(sample_rate);
+    baseband::set_sample_rate(tx_sample_rate);
 
     transmitter_model.enable();
 
@@ -193,7 +191,7 @@ void SoundBoardView::refresh_list() {
                 if (entry_extension == ".WAV" && entry.path().string().find("shopping_cart") == std::string::npos) {
                     /*                           ^ because the shopping cart lock app using the speaker to send the LF signal, it's meaningless to be here */
                     if (reader->open(wav_dir / entry.path())) {
-                        if ((reader->channels() == 1) && ((reader->bits_per_sample() == 8) || (reader->bits_per_sample() == 16))) {
+                        if (pcm::is_supported_format(reader->bits_per_sample(), reader->channels())) {
                             // sounds[c].ms_duration = reader->ms_duration();
                             // sounds[c].path = u"WAV/" + entry.path().native();
                             if (count >= (page - 1) * FILE_PER_PAGE && count < page * FILE_PER_PAGE) {
@@ -71,7 +71,9 @@ class SoundBoardView : public View {
     uint32_t page = 1;
     uint32_t c_page = 1;
     uint32_t tone_key_index = 1;
-    uint8_t bits_per_sample = 1;
+    // Files are resampled to 16 bit mono at this rate, an exact divisor of the AudioTX baseband rate.
+    static constexpr uint32_t tx_sample_rate = 1536000 / 32;
+    static constexpr uint8_t bits_per_sample = 16;
 
     std::vector<std::filesystem::path> file_list{};
 
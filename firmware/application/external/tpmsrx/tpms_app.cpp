@@ -73,7 +73,23 @@ static std::string signal_type(tpms::SignalType signal_type) {
 
 } /* namespace format */
 
-void TPMSLogger::on_packet(const tpms::Packet& packet, const uint32_t target_frequency) {
+void TPMSLogger::on_packet(const tpms::Packet& packet, const uint32_t target_frequency, const PacketMetadata& metadata) {
+    if (binary_log) {
+        // Symbol count (u16), then data and error bits, MSB first.
+        constexpr size_t max_bytes = 160;
+        std::array<uint8_t, 2 + 2 * max_bytes> payload{};
+        const uint16_t symbols = packet.symbols_packed(&payload[2], &payload[2 + max_bytes], max_bytes);
+        std::memcpy(&payload[0], &symbols, sizeof(symbols));
+
+        // Compact the error bits down behind the data bits.
+        const size_t bytes = (symbols + 7) / 8;
+        std::memmove(&payload[2 + bytes], &payload[2 + max_bytes], bytes);
+
+        binary_log->write_record(binlog::RecordType::TPMS, packet.received_at(), target_frequency,
+                                 payload.data(), 2 + 2 * bytes, packet.signal_type(), metadata);
+        return;
+    }
+
     const auto hex_formatted = packet.symbols_formatted();
 
     // TODO: function doesn't take uint64_t, so when >= 1<<32, weirdness will ensue!
@@ -166,9 +182,9 @@ void TPMSAppView::set_parent_rect(const Rect new_parent_rect) {
     update_view();
 }
 
-void TPMSAppView::on_packet(const tpms::Packet& packet) {
+void TPMSAppView::on_packet(const tpms::Packet& packet, const PacketMetadata& metadata) {
     if (logger) {
-        logger->on_packet(packet, receiver_model.target_frequency());
+        logger->on_packet(packet, receiver_model.target_frequency(), metadata);
     }
 
     const auto reading_opt = packet.reading();
@@ -32,6 +32,7 @@
 #include "radio_state.hpp"
 #include "event_m0.hpp"
 
+#include "binary_log.hpp"
 #include "log_file.hpp"
 
 #include "recent_entries.hpp"
@@ -79,13 +80,17 @@ using TPMSRecentEntries = RecentEntries<TPMSRecentEntry>;
 class TPMSLogger {
    public:
     Optional<File::Error> append(const std::filesystem::path& filename) {
+        binary_log = BinaryLogFile::open_if_enabled(filename);
+        if (binary_log)
+            return {};
         return log_file.append(filename);
     }
 
-    void on_packet(const tpms::Packet& packet, const uint32_t target_frequency);
+    void on_packet(const tpms::Packet& packet, const uint32_t target_frequency, const PacketMetadata& metadata);
 
    private:
     LogFile log_file{};
+    std::unique_ptr<BinaryLogFile> binary_log{};
 };
 
 using TPMSRecentEntriesView = RecentEntriesView<TPMSRecentEntries>;
@@ -126,7 +131,7 @@ class TPMSAppView : public View {
         [this](Message* const p) {
             const auto message = static_cast<const TPMSPacketMessage*>(p);
             const tpms::Packet packet{message->packet, message->signal_type};
-            this->on_packet(packet);
+            this->on_packet(packet, message->metadata);
         }};
 
     static constexpr ui::Dim header_height = 1 * 16;
@@ -186,7 +191,7 @@ class TPMSAppView : public View {
     }};
     TPMSRecentEntriesView recent_entries_view{columns, recent};
 
-    void on_packet(const tpms::Packet& packet);
+    void on_packet(const tpms::Packet& packet, const PacketMetadata& metadata);
     void on_show_list();
     void update_view();
 };
@@ -31,6 +31,8 @@
 namespace fs = std::filesystem;
 static const fs::path c8_ext{u".C8"};
 static const fs::path c16_ext{u".C16"};
+static const fs::path c4_ext{u".C4"};
+static const fs::path c6_ext{u".C6"};
 
 Optional<File::Error> File::open_fatfs(const std::filesystem::path& filename, BYTE mode) {
     auto result = f_open(&f, reinterpret_cast<const TCHAR*>(filename.c_str()), mode);
@@ -553,6 +555,14 @@ uint8_t capture_file_sample_size(const path& filename) {
     return 0;
 }
 
+uint8_t capture_file_bfp_bits(const path& filename) {
+    if (path_iequal(filename.extension(), c4_ext))
+        return 4;
+    if (path_iequal(filename.extension(), c6_ext))
+        return 6;
+    return 0;
+}
+
 directory_iterator::directory_iterator(
     const std::filesystem::path& path,
     const std::filesystem::path& wild)
@@ -172,6 +172,8 @@ path operator/(const path& lhs, const path& rhs);
 bool path_iequal(const path& lhs, const path& rhs);
 bool is_cxx_capture_file(const path& filename);
 uint8_t capture_file_sample_size(const path& filename);
+/* Returns 4 or 6 for block floating point captures (.C4, .C6), 0 otherwise. */
+uint8_t capture_file_bfp_bits(const path& filename);
 
 using file_status = BYTE;
 
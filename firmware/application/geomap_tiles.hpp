@@ -0,0 +1,212 @@
+/*
+ * Copyright (C) 2026
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GEOMAP_TILES_HPP__
+#define __GEOMAP_TILES_HPP__
+
+#include "ui.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+/* Pre-tiled world map container, written by tools/generate_world_map_tiles.py.
+ * All values are little endian.
+ *   TileMapHeader
+ *   TileMapLevel[levels]
+ *   uint32_t tile offset index, row-major, one table per level
+ *   tile data, tile_size * tile_size RGB565 pixels each, row-major
+ * Level n is level 0 downscaled by 2^n. Identical tiles may share one
+ * offset; an offset of 0 marks a tile with no data. */
+
+namespace geomap {
+
+constexpr uint32_t tile_map_magic = 0x544D4750;  // "PGMT"
+constexpr uint16_t tile_size = 32;
+constexpr size_t tile_pixels = tile_size * tile_size;
+constexpr size_t tile_map_max_levels = 8;
+
+struct TileMapHeader {
+    uint32_t magic;
+    uint16_t tile_size;
+    uint16_t levels;
+    uint16_t width;  // Level 0 size in pixels
+    uint16_t height;
+};
+static_assert(sizeof(TileMapHeader) == 12, "TileMapHeader must match the file layout");
+
+struct TileMapLevel {
+    uint16_t tiles_x;
+    uint16_t tiles_y;
+    uint32_t index_offset;
+};
+static_assert(sizeof(TileMapLevel) == 8, "TileMapLevel must match the file layout");
+
+/* Most tiles a run of this many map pixels can touch. */
+constexpr size_t tiles_spanned(const size_t pixels) {
+    return (pixels + tile_size - 2) / tile_size + 1;
+}
+
+/* Least recently used cache of decoded tiles.
+ * BufferType requires the following members
+ * Result<Size> read(void* data, Size bytes_to_read)
+ * Result<Offset> seek(uint32_t offset)
+ * HeapType requires the following static members, allocate() must return
+ * nullptr when the heap is short instead of panicking like operator new
+ * void* allocate(size_t size)
+ * void release(void* p) */
+template <typename BufferType, typename HeapType>
+class TileCache {
+   public:
+    TileCache(BufferType& buffer)
+        : buffer_{buffer} {}
+
+    TileCache(const TileCache&) = delete;
+    TileCache& operator=(const TileCache&) = delete;
+
+    /* Allocates the tile slots, returns false if the heap cannot hold them. */
+    bool allocate(const size_t slots) {
+        slots_.reset();
+        slot_count_ = 0;
+
+        auto p = static_cast<Slot*>(HeapType::allocate(slots * sizeof(Slot)));
+        if (p == nullptr)
+            return false;
+
+        for (size_t i = 0; i < slots; i++)
+            new (&p[i]) Slot{};
+        slots_.reset(p);
+        slot_count_ = slots;
+        return slots != 0;
+    }
+
+    size_t slot_count() const { return slot_count_; }
+
+    /* Reads and validates the header and level table. */
+    bool open() {
+        invalidate();
+        levels_ = 0;
+
+        if (!read_at(0, &header_, sizeof(header_)) ||
+            header_.magic != tile_map_magic ||
+            header_.tile_size != tile_size ||
+            header_.levels == 0 || header_.levels > tile_map_max_levels)
+            return false;
+
+        if (!read_at(sizeof(header_), level_table_.data(), header_.levels * sizeof(TileMapLevel)))
+            return false;
+
+        levels_ = header_.levels;
+        return true;
+    }
+
+    uint8_t levels() const { return levels_; }
+    uint16_t width() const { return header_.width; }
+    uint16_t height() const { return header_.height; }
+    const TileMapLevel& level(uint8_t n) const { return level_table_[n]; }
+
+    /* Returns the tile pixels, or nullptr if the tile is outside the map,
+     * has no data or could not be read. */
+    const ui::Color* get(uint8_t level, int32_t tile_x, int32_t tile_y) {
+        if (level >= levels_ || tile_x < 0 || tile_y < 0 || slot_count_ == 0)
+            return nullptr;
+
+        const auto& info = level_table_[level];
+        if (tile_x >= info.tiles_x || tile_y >= info.tiles_y)
+            return nullptr;
+
+        const uint32_t key = (level << 28) | (tile_y << 14) | tile_x;
+        Slot* victim = &slots_[0];
+        for (size_t i = 0; i < slot_count_; i++) {
+            auto& slot = slots_[i];
+            if (slot.key == key) {
+                slot.last_used = ++clock_;
+                hits_++;
+                return slot.pixels.data();
+            }
+            if (slot.last_used < victim->last_used)
+                victim = &slot;
+        }
+
+        misses_++;
+        victim->key = invalid_key;
+        victim->last_used = 0;
+
+        uint32_t offset = 0;
+        const uint32_t index_pos = info.index_offset + (tile_y * info.tiles_x + tile_x) * sizeof(uint32_t);
+        if (!read_at(index_pos, &offset, sizeof(offset)) || offset == 0)
+            return nullptr;
+        if (!read_at(offset, victim->pixels.data(), tile_pixels * sizeof(ui::Color)))
+            return nullptr;
+
+        victim->key = key;
+        victim->last_used = ++clock_;
+        return victim->pixels.data();
+    }
+
+    void invalidate() {
+        for (size_t i = 0; i < slot_count_; i++) {
+            slots_[i].key = invalid_key;
+            slots_[i].last_used = 0;
+        }
+    }
+
+    uint32_t hits() const { return hits_; }
+    uint32_t misses() const { return misses_; }
+
+   private:
+    static constexpr uint32_t invalid_key = 0xFFFFFFFF;
+
+    struct Slot {
+        uint32_t key{invalid_key};
+        uint32_t last_used{0};
+        std::array<ui::Color, tile_pixels> pixels{};
+    };
+    static_assert(std::is_trivially_destructible<Slot>::value, "Slots are released without running destructors");
+
+    struct SlotDeleter {
+        void operator()(Slot* p) const { HeapType::release(p); }
+    };
+
+    bool read_at(uint32_t offset, void* data, size_t size) {
+        if (buffer_.seek(offset).is_error())
+            return false;
+        auto result = buffer_.read(data, size);
+        return result.is_ok() && *result == size;
+    }
+
+    BufferType& buffer_;
+    TileMapHeader header_{};
+    std::array<TileMapLevel, tile_map_max_levels> level_table_{};
+    uint8_t levels_{0};
+    uint32_t clock_{0};
+    uint32_t hits_{0};
+    uint32_t misses_{0};
+    std::unique_ptr<Slot[], SlotDeleter> slots_{};
+    size_t slot_count_{0};
+};
+
+} /* namespace geomap */
+
+#endif /*__GEOMAP_TILES_HPP__*/
@@ -22,20 +22,57 @@
 #include "io_convert.hpp"
 #include "complex.hpp"
 
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
 namespace fs = std::filesystem;
 static const fs::path c8_ext = u".C8";
 
 namespace file_convert {
 
+// The word at a time paths below assume little endian lanes and 4 byte aligned buffers
+// (the M0 faults on unaligned word access); anything else takes the per sample path.
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+static constexpr bool word_lanes = true;
+#else
+static constexpr bool word_lanes = false;
+#endif
+
+static bool word_aligned(const void* buffer) {
+    return word_lanes && ((reinterpret_cast<uintptr_t>(buffer) & 3) == 0);
+}
+
 // Convert buffer contents from c16 to c8.
 // Same buffer used for input & output; input size is bytes; output size is bytes/2.
 void c16_to_c8(const void* buffer, File::Size bytes) {
     complex16_t* src = (complex16_t*)buffer;
     complex8_t* dest = (complex8_t*)buffer;
+    const File::Size count = bytes / sizeof(complex16_t);
+    File::Size i = 0;
+
+    if (word_aligned(buffer)) {
+        // Two samples (four int16 lanes) per iteration: 2 word loads, 1 word store.
+        // Adding 255 to negative lanes before taking the high byte rounds towards zero like / 256.
+        // The lane add masks bit 15 so a carry can't cross into the upper lane.
+        const uint32_t* in = reinterpret_cast<const uint32_t*>(buffer);
+        uint32_t* out = (uint32_t*)buffer;
+        auto round_lanes = [](uint32_t w) {
+            const uint32_t bias = ((w >> 15) & 0x00010001) * 0xFF;
+            return ((w & 0x7FFF7FFF) + bias) ^ (w & 0x80008000);
+        };
+        for (; i + 2 <= count; i += 2) {
+            const uint32_t a = round_lanes(in[0]);
+            const uint32_t b = round_lanes(in[1]);
+            in += 2;
+            *(out++) = ((a >> 8) & 0x000000FF) | ((a >> 16) & 0x0000FF00) |
+                       ((b << 8) & 0x00FF0000) | (b & 0xFF000000);
+        }
+    }
 
     // Shift isn't used here because it would amplify noise at center freq since it's a signed number
     // i.e. ((-1 >> 8) << 8) = -256, whereas (-1 / 256) * 256 = 0
-    for (File::Size i = 0; i < bytes / sizeof(complex16_t); i++) {
+    for (; i < count; i++) {
         auto re_out = src[i].real() / 256;
         auto im_out = src[i].imag() / 256;
         dest[i] = {(int8_t)re_out, (int8_t)im_out};
@@ -49,6 +86,26 @@ void c8_to_c16(const void* buffer, File::Size bytes) {
     complex16_t* dest = (complex16_t*)buffer;
     uint32_t i = bytes / sizeof(complex8_t);
 
+    // Expanding in place runs backwards; an odd last sample goes first so the rest pairs up
+    if (word_aligned(buffer) && (i >= 2)) {
+        if (i & 1) {
+            i--;
+            dest[i] = {(int16_t)(src[i].real() * 256), (int16_t)(src[i].imag() * 256)};
+        }
+
+        // Two samples (four int8 lanes) per iteration: 1 word load, 2 word stores.
+        // x * 256 of an int8 is just the byte moved into the high half of its int16 lane.
+        const uint32_t* in = reinterpret_cast<const uint32_t*>(buffer) + i / 2;
+        uint32_t* out = (uint32_t*)buffer + i;
+        while (i != 0) {
+            const uint32_t w = *(--in);
+            out -= 2;
+            out[1] = ((w >> 8) & 0x0000FF00) | (w & 0xFF000000);
+            out[0] = ((w << 8) & 0x0000FF00) | ((w << 16) & 0xFF000000);
+            i -= 2;
+        }
+    }
+
     if (i != 0) {
         do {
             i--;
@@ -59,16 +116,163 @@ void c8_to_c16(const void* buffer, File::Size bytes) {
     }
 }
 
+uint64_t bfp_sample_count(uint64_t file_size, uint8_t bits) {
+    if (file_size <= bfp_header_size)
+        return 0;
+    return ((file_size - bfp_header_size) / bfp_block_bytes(bits)) * bfp_block_samples;
+}
+
+// Each sample is read before any output byte that overlaps it is written, so dst may alias src.
+void bfp_encode_block(const complex16_t* src, uint8_t* dst, uint8_t bits) {
+    const int32_t q_max = (1 << (bits - 1)) - 1;
+    const int32_t q_min = -q_max - 1;
+    const uint32_t mask = (1 << bits) - 1;
+
+    int32_t peak = 0;
+    for (size_t i = 0; i < bfp_block_samples; i++) {
+        peak = std::max(peak, std::abs((int32_t)src[i].real()));
+        peak = std::max(peak, std::abs((int32_t)src[i].imag()));
+    }
+
+    // Smallest exponent that fits the block's peak into the signed range
+    uint8_t exponent = 0;
+    while ((peak >> exponent) > q_max)
+        exponent++;
+
+    // Round to nearest; truncating would add a DC offset of half a step
+    const int32_t half = exponent ? (1 << (exponent - 1)) : 0;
+    auto quantize = [=](int32_t v) -> uint32_t {
+        v = std::clamp((v + half) >> exponent, q_min, q_max);
+        return (uint32_t)v & mask;
+    };
+
+    uint8_t* out = dst + 1;
+    if (bits == 4) {
+        for (size_t i = 0; i < bfp_block_samples; i++) {
+            const auto s = src[i];
+            out[i] = quantize(s.real()) | (quantize(s.imag()) << 4);
+        }
+    } else {
+        for (size_t i = 0; i < bfp_block_samples; i += 2) {
+            const auto a = src[i];
+            const auto b = src[i + 1];
+            const uint32_t packed = quantize(a.real()) | (quantize(a.imag()) << 6) |
+                                    (quantize(b.real()) << 12) | (quantize(b.imag()) << 18);
+            *(out++) = packed;
+            *(out++) = packed >> 8;
+            *(out++) = packed >> 16;
+        }
+    }
+
+    // Written last, dst[0] overlaps the first input sample when encoding in place
+    dst[0] = exponent;
+}
+
+void bfp_decode_block(const uint8_t* src, complex16_t* dst, uint8_t bits) {
+    const uint8_t exponent = src[0] & 0x0F;
+    const uint8_t* in = src + 1;
+
+    auto expand = [exponent](int32_t q) -> int16_t {
+        return std::clamp<int32_t>(q * (1 << exponent), INT16_MIN, INT16_MAX);
+    };
+
+    if (bits == 4) {
+        for (size_t i = 0; i < bfp_block_samples; i++) {
+            const uint8_t packed = in[i];
+            dst[i] = {expand((int8_t)(packed << 4) >> 4), expand((int8_t)packed >> 4)};
+        }
+    } else {
+        for (size_t i = 0; i < bfp_block_samples; i += 2) {
+            const uint32_t packed = in[0] | (in[1] << 8) | (in[2] << 16);
+            in += 3;
+            dst[i] = {expand((int32_t)(packed << 26) >> 26), expand((int32_t)(packed << 20) >> 26)};
+            dst[i + 1] = {expand((int32_t)(packed << 14) >> 26), expand((int32_t)(packed << 8) >> 26)};
+        }
+    }
+}
+
 } /* namespace file_convert */
 
-// Automatically enables C8/C16 conversion based on file extension
+// Automatically enables C8/C16 and block floating point conversion based on file extension
 Optional<File::Error> FileConvertReader::open(const std::filesystem::path& filename) {
     convert_c8_to_c16 = path_iequal(filename.extension(), c8_ext);
-    return file_.open(filename);
+    bfp_bits_ = fs::capture_file_bfp_bits(filename);
+
+    auto error = file_.open(filename);
+    if (error.is_valid() || !bfp_bits_)
+        return error;
+
+    uint8_t header[file_convert::bfp_header_size];
+    auto result = file_.read(header, sizeof(header));
+    if (result.is_error())
+        return result.error();
+
+    uint32_t magic;
+    memcpy(&magic, header, sizeof(magic));
+    if ((*result != sizeof(header)) || (magic != file_convert::bfp_magic) || (header[4] != bfp_bits_) ||
+        ((header[6] | (header[7] << 8)) != file_convert::bfp_block_samples))
+        return File::Error{FR_INVALID_OBJECT};
+
+    bfp_block_ = std::make_unique<std::array<complex16_t, file_convert::bfp_block_samples>>();
+    bfp_block_pos_ = bfp_block_size_ = 0;
+    return {};
+}
+
+// Expands block floating point data to C16. Whole blocks are read into the end of the
+// caller's buffer and decoded in place; a block split across reads goes through bfp_block_.
+File::Result<File::Size> FileConvertReader::read_bfp(uint8_t* buffer, const File::Size bytes) {
+    using namespace file_convert;
+    const size_t block_bytes = bfp_block_bytes(bfp_bits_);
+    uint8_t* const staging = reinterpret_cast<uint8_t*>(bfp_block_->data());
+    File::Size done = 0;
+
+    while (done < bytes) {
+        if (bfp_block_pos_ < bfp_block_size_) {
+            const size_t n = std::min<size_t>(bfp_block_size_ - bfp_block_pos_, bytes - done);
+            memcpy(buffer + done, staging + bfp_block_pos_, n);
+            bfp_block_pos_ += n;
+            done += n;
+            continue;
+        }
+
+        const size_t blocks = (bytes - done) / bfp_block_c16_bytes;
+        if (blocks > 0) {
+            uint8_t* const out = buffer + done;
+            uint8_t* const encoded = out + blocks * (bfp_block_c16_bytes - block_bytes);
+            auto result = file_.read(encoded, blocks * block_bytes);
+            if (result.is_error())
+                return result.error();
+
+            // Block i ends no earlier than its decoded output, so decoding forward is safe
+            const size_t got = *result / block_bytes;
+            for (size_t i = 0; i < got; i++)
+                bfp_decode_block(encoded + i * block_bytes, reinterpret_cast<complex16_t*>(out + i * bfp_block_c16_bytes), bfp_bits_);
+            done += got * bfp_block_c16_bytes;
+            if (got < blocks)
+                break;
+        } else {
+            auto result = file_.read(staging + bfp_block_c16_bytes - block_bytes, block_bytes);
+            if (result.is_error())
+                return result.error();
+            if (*result < block_bytes)
+                break;
+            bfp_decode_block(staging + bfp_block_c16_bytes - block_bytes, bfp_block_->data(), bfp_bits_);
+            bfp_block_pos_ = 0;
+            bfp_block_size_ = bfp_block_c16_bytes;
+        }
+    }
+    return done;
 }
 
 // If C8 conversion enabled, half the number of bytes are read from the file & expanded to fill the whole buffer.
 File::Result<File::Size> FileConvertReader::read(void* const buffer, const File::Size bytes) {
+    if (bfp_bits_) {
+        auto read_result = read_bfp(static_cast<uint8_t*>(buffer), bytes);
+        if (read_result.is_ok())
+            bytes_read_ += read_result.value();
+        return read_result;
+    }
+
     auto read_result = file_.read(buffer, convert_c8_to_c16 ? bytes / 2 : bytes);
     if (read_result.is_ok()) {
         if (convert_c8_to_c16) {
@@ -80,14 +284,93 @@ File::Result<File::Size> FileConvertReader::read(void* const buffer, const File:
     return read_result;
 }
 
-// Automatically enables C8/C16 conversion based on file extension
+// Automatically enables C8/C16 and block floating point conversion based on file extension
 Optional<File::Error> FileConvertWriter::create(const std::filesystem::path& filename) {
     convert_c16_to_c8 = path_iequal(filename.extension(), c8_ext);
-    return file_.create(filename);
+    bfp_bits_ = fs::capture_file_bfp_bits(filename);
+
+    auto error = file_.create(filename);
+    if (error.is_valid() || !bfp_bits_)
+        return error;
+
+    const uint8_t header[file_convert::bfp_header_size] = {
+        'B', 'F', 'P', 'Q', bfp_bits_, 0,
+        file_convert::bfp_block_samples & 0xFF, file_convert::bfp_block_samples >> 8};
+    auto result = file_.write(header, sizeof(header));
+    if (result.is_error())
+        return result.error();
+
+    bfp_block_ = std::make_unique<std::array<complex16_t, file_convert::bfp_block_samples>>();
+    bfp_block_fill_ = 0;
+    return {};
+}
+
+// Compresses C16 to block floating point. Whole blocks are encoded in place and packed
+// towards the start of the buffer; samples that don't fill a block wait in bfp_block_.
+File::Result<File::Size> FileConvertWriter::write_bfp(uint8_t* buffer, const File::Size bytes) {
+    using namespace file_convert;
+    const size_t block_bytes = bfp_block_bytes(bfp_bits_);
+    uint8_t* const staging = reinterpret_cast<uint8_t*>(bfp_block_->data());
+    File::Size pos = 0;
+
+    if (bfp_block_fill_ > 0) {
+        pos = std::min<size_t>(bfp_block_c16_bytes - bfp_block_fill_, bytes);
+        memcpy(staging + bfp_block_fill_, buffer, pos);
+        bfp_block_fill_ += pos;
+        if (bfp_block_fill_ == bfp_block_c16_bytes) {
+            bfp_encode_block(bfp_block_->data(), staging, bfp_bits_);
+            auto result = file_.write(staging, block_bytes);
+            if (result.is_error())
+                return result.error();
+            bfp_block_fill_ = 0;
+        }
+    }
+
+    const size_t blocks = (bytes - pos) / bfp_block_c16_bytes;
+    if (blocks > 0) {
+        uint8_t* const in = buffer + pos;
+        for (size_t i = 0; i < blocks; i++)
+            bfp_encode_block(reinterpret_cast<const complex16_t*>(in + i * bfp_block_c16_bytes), in + i * block_bytes, bfp_bits_);
+        auto result = file_.write(in, blocks * block_bytes);
+        if (result.is_error())
+            return result.error();
+        pos += blocks * bfp_block_c16_bytes;
+    }
+
+    if (pos < bytes) {
+        bfp_block_fill_ = bytes - pos;
+        memcpy(staging, buffer + pos, bfp_block_fill_);
+    }
+    return File::Size{bytes};
+}
+
+// A capture rarely ends on a block boundary; the tail is zero padded to a whole block.
+Optional<File::Error> FileConvertWriter::close() {
+    Optional<File::Error> error{};
+    if (bfp_bits_ && bfp_block_ && bfp_block_fill_ > 0) {
+        using namespace file_convert;
+        uint8_t* const staging = reinterpret_cast<uint8_t*>(bfp_block_->data());
+        memset(staging + bfp_block_fill_, 0, bfp_block_c16_bytes - bfp_block_fill_);
+        bfp_encode_block(bfp_block_->data(), staging, bfp_bits_);
+        bfp_block_fill_ = 0;
+
+        auto result = file_.write(staging, bfp_block_bytes(bfp_bits_));
+        if (result.is_error())
+            error = result.error();
+    }
+    file_.close();
+    return error;
 }
 
 // If C8 conversion is enabled, half the number of bytes are written to the file.
 File::Result<File::Size> FileConvertWriter::write(const void* const buffer, const File::Size bytes) {
+    if (bfp_bits_) {
+        auto write_result = write_bfp(static_cast<uint8_t*>(const_cast<void*>(buffer)), bytes);
+        if (write_result.is_ok())
+            bytes_written_ += write_result.value();
+        return write_result;
+    }
+
     if (convert_c16_to_c8) {
         file_convert::c16_to_c8(buffer, bytes);
     }
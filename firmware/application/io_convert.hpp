@@ -27,14 +27,43 @@
 #include "io.hpp"
 #include "file.hpp"
 #include "optional.hpp"
+#include "complex.hpp"
 
+#include <array>
 #include <cstdint>
+#include <memory>
 
 namespace file_convert {
 
 void c8_to_c16(const void* buffer, File::Size bytes);
 void c16_to_c8(const void* buffer, File::Size bytes);
 
+/* Block floating point captures (.C4 and .C6).
+ * An 8 byte header ("BFPQ", bits, 0, uint16 samples per block) is followed by
+ * fixed size blocks: one exponent byte, then the block's I/Q values packed as
+ * signed 4 or 6 bit integers, LSB first. A sample is value << exponent.
+ * Blocks have a fixed size, so block n starts at
+ * bfp_header_size + n * bfp_block_bytes(bits). The last block is zero padded. */
+constexpr uint32_t bfp_magic = 0x51504642;  // "BFPQ"
+constexpr size_t bfp_header_size = 8;
+constexpr size_t bfp_block_samples = 256;
+constexpr size_t bfp_block_c16_bytes = bfp_block_samples * sizeof(complex16_t);
+
+constexpr size_t bfp_block_bytes(uint8_t bits) {
+    return 1 + (bfp_block_samples * 2 * bits) / 8;
+}
+
+constexpr uint64_t bfp_block_offset(uint64_t block, uint8_t bits) {
+    return bfp_header_size + block * bfp_block_bytes(bits);
+}
+
+uint64_t bfp_sample_count(uint64_t file_size, uint8_t bits);
+
+/* Encodes one block of C16 samples. dst may alias src. */
+void bfp_encode_block(const complex16_t* src, uint8_t* dst, uint8_t bits);
+/* Decodes one block. dst may alias src as long as src ends no earlier than dst. */
+void bfp_decode_block(const uint8_t* src, complex16_t* dst, uint8_t bits);
+
 } /* namespace file_convert */
 
 class FileConvertReader : public stream::Reader {
@@ -54,13 +83,23 @@ class FileConvertReader : public stream::Reader {
     bool convert_c8_to_c16{};
 
    protected:
+    File::Result<File::Size> read_bfp(uint8_t* buffer, const File::Size bytes);
+
     File file_{};
     uint64_t bytes_read_{0};
+
+    uint8_t bfp_bits_{0};
+    std::unique_ptr<std::array<complex16_t, file_convert::bfp_block_samples>> bfp_block_{};
+    size_t bfp_block_pos_{0};
+    size_t bfp_block_size_{0};
 };
 
 class FileConvertWriter : public stream::Writer {
    public:
     FileConvertWriter() = default;
+    ~FileConvertWriter() {
+        close();
+    }
 
     FileConvertWriter(const FileConvertWriter&) = delete;
     FileConvertWriter& operator=(const FileConvertWriter&) = delete;
@@ -68,6 +107,8 @@ class FileConvertWriter : public stream::Writer {
     FileConvertWriter& operator=(FileConvertWriter&&) = delete;
 
     Optional<File::Error> create(const std::filesystem::path& filename);
+    // Writes out a partial block frame, then closes the file.
+    Optional<File::Error> close();
 
     File::Result<File::Size> write(const void* const buffer, const File::Size bytes) override;
     const File& file() const& { return file_; }
@@ -75,8 +116,14 @@ class FileConvertWriter : public stream::Writer {
     bool convert_c16_to_c8{};
 
    protected:
+    File::Result<File::Size> write_bfp(uint8_t* buffer, const File::Size bytes);
+
     File file_{};
     uint64_t bytes_written_{0};
+
+    uint8_t bfp_bits_{0};
+    std::unique_ptr<std::array<complex16_t, file_convert::bfp_block_samples>> bfp_block_{};
+    size_t bfp_block_fill_{0};
 };
 
 #endif
@@ -24,6 +24,8 @@
 #include "io_wave.hpp"
 #include "utility.hpp"
 
+#include <algorithm>
+
 bool WAVFileReader::open(const std::filesystem::path& path) {
     size_t i = 0;
     char ch;
@@ -157,6 +159,69 @@ uint16_t WAVFileReader::bits_per_sample() {
     return header.fmt.wBitsPerSample;
 }
 
+WAVResampledReader::WAVResampledReader(std::unique_ptr<WAVFileReader> reader, uint32_t output_rate)
+    : reader_{std::move(reader)},
+      bits_per_sample_{reader_->bits_per_sample()},
+      channels_{reader_->channels()},
+      frame_bytes_{pcm::frame_bytes(bits_per_sample_, channels_)} {
+    resampler_.configure(reader_->sample_rate(), output_rate);
+    if (pcm::is_supported_format(bits_per_sample_, channels_)) {
+        bytes_remaining_ = reader_->data_size();
+        sample_count_ = resampler_.output_count(bytes_remaining_ / frame_bytes_);
+    }
+}
+
+// Reads stop at the end of the data chunk rather than running into trailing tags.
+Optional<File::Error> WAVResampledReader::refill() {
+    block_pos_ = 0;
+    block_count_ = 0;
+
+    if (!pcm::is_supported_format(bits_per_sample_, channels_))
+        return {};
+
+    if (bytes_remaining_ >= frame_bytes_) {
+        const size_t frames = std::min<size_t>(block_frames, bytes_remaining_ / frame_bytes_);
+        auto result = reader_->read(raw_.data(), frames * frame_bytes_);
+        if (result.is_error())
+            return result.error();
+
+        const size_t frames_read = result.value() / frame_bytes_;
+        bytes_remaining_ = frames_read ? bytes_remaining_ - frames_read * frame_bytes_ : 0;
+        block_count_ = pcm::to_mono_s16(raw_.data(), frames_read, bits_per_sample_, channels_, block_.data());
+    }
+
+    // Push the last input samples through the filter's delay line.
+    if (!block_count_ && !flushed_ && !resampler_.bypass()) {
+        flushed_ = true;
+        block_count_ = pcm::Resampler::taps / 2;
+        std::fill(block_.begin(), block_.begin() + block_count_, 0);
+    }
+
+    return {};
+}
+
+File::Result<File::Size> WAVResampledReader::read(void* const buffer, const File::Size bytes) {
+    auto out = static_cast<int16_t*>(buffer);
+    const size_t capacity = bytes / sizeof(int16_t);
+    size_t produced = 0;
+
+    while (produced < capacity) {
+        if (block_pos_ == block_count_) {
+            auto error = refill();
+            if (error.is_valid())
+                return error.value();
+            if (!block_count_)
+                break;
+        }
+
+        size_t consumed = block_count_ - block_pos_;
+        produced += resampler_.process(&block_[block_pos_], consumed, out + produced, capacity - produced);
+        block_pos_ += consumed;
+    }
+
+    return produced * sizeof(int16_t);
+}
+
 Optional<File::Error> WAVFileWriter::create(
     const std::filesystem::path& filename,
     size_t sampling_rate_set,
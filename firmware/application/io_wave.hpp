@@ -27,7 +27,10 @@
 
 #include "file.hpp"
 #include "optional.hpp"
+#include "pcm_resampler.hpp"
 
+#include <array>
+#include <memory>
 #include <string.h>
 
 struct fmt_pcm_t {
@@ -155,6 +158,40 @@ class WAVFileReader : public FileReader {
     std::filesystem::path last_path{};
 };
 
+/* Streams a WAV file's data chunk as mono s16 at a fixed output rate.
+ * 8/16 bit mono or stereo input is normalised and resampled one block at a
+ * time, so any supported file plays without pre-conversion. */
+class WAVResampledReader : public stream::Reader {
+   public:
+    WAVResampledReader(std::unique_ptr<WAVFileReader> reader, uint32_t output_rate);
+
+    WAVResampledReader(const WAVResampledReader&) = delete;
+    WAVResampledReader& operator=(const WAVResampledReader&) = delete;
+
+    File::Result<File::Size> read(void* const buffer, const File::Size bytes) override;
+
+    /* Number of output samples, for progress reporting. */
+    uint32_t sample_count() const { return sample_count_; }
+
+   private:
+    static constexpr size_t block_frames = 128;
+
+    std::unique_ptr<WAVFileReader> reader_;
+    pcm::Resampler resampler_{};
+    std::array<uint8_t, block_frames * 4> raw_{};
+    std::array<int16_t, block_frames> block_{};
+    size_t block_pos_{0};
+    size_t block_count_{0};
+    uint32_t bytes_remaining_{0};
+    uint16_t bits_per_sample_;
+    uint16_t channels_;
+    size_t frame_bytes_;
+    uint32_t sample_count_{0};
+    bool flushed_{false};
+
+    Optional<File::Error> refill();
+};
+
 class WAVFileWriter : public FileWriter {
    public:
     WAVFileWriter() = default;
@@ -21,6 +21,8 @@
 
 #include "iq_trim.hpp"
 
+#include <algorithm>
+#include <limits>
 #include <memory>
 #include "string_format.hpp"
 
@@ -63,7 +65,7 @@ Optional<CaptureInfo> profile_capture(
 
     auto profile_samples = buckets.size * samples_per_bucket;
     auto sample_interval = info.sample_count / profile_samples;
-    uint32_t bucket_width = std::max(1ULL, info.sample_count / buckets.size);
+    uint32_t bucket_width = std::max<uint64_t>(1, info.sample_count / buckets.size);
     uint64_t sample_index = 0;
     T value{};
 
@@ -144,35 +146,59 @@ TrimRange compute_trim_range(
         info.sample_size};
 }
 
+/* Saturating gain kernels. Samples are clamped to +/-max, so -max - 1 is never produced.
+ * They work on whole words where the buffer allows it; the M0 has no saturating SIMD
+ * instructions, so lanes are unpacked, scaled and clamped in registers instead. */
+template <typename T>
+static T saturate_gain(int32_t value, int32_t gain) {
+    constexpr int32_t max = std::numeric_limits<T>::max();
+    return std::clamp(value * gain, -max, max);
+}
+
+static void amplify_c16(int16_t* values, uint32_t count, int32_t gain) {
+    uint32_t i = 0;
+    if ((reinterpret_cast<uintptr_t>(values) & 3) == 0) {
+        uint32_t* words = reinterpret_cast<uint32_t*>(values);
+        for (; i + 2 <= count; i += 2) {
+            const uint32_t w = *words;
+            const uint16_t lo = saturate_gain<int16_t>((int16_t)(w & 0xFFFF), gain);
+            const uint16_t hi = saturate_gain<int16_t>((int16_t)(w >> 16), gain);
+            *(words++) = lo | (hi << 16);
+        }
+    }
+    for (; i < count; i++)
+        values[i] = saturate_gain<int16_t>(values[i], gain);
+}
+
+static void amplify_c8(int8_t* values, uint32_t count, int32_t gain) {
+    uint32_t i = 0;
+    if ((reinterpret_cast<uintptr_t>(values) & 3) == 0) {
+        uint32_t* words = reinterpret_cast<uint32_t*>(values);
+        for (; i + 4 <= count; i += 4) {
+            const uint32_t w = *words;
+            const uint8_t b0 = saturate_gain<int8_t>((int8_t)w, gain);
+            const uint8_t b1 = saturate_gain<int8_t>((int8_t)(w >> 8), gain);
+            const uint8_t b2 = saturate_gain<int8_t>((int8_t)(w >> 16), gain);
+            const uint8_t b3 = saturate_gain<int8_t>((int8_t)(w >> 24), gain);
+            *(words++) = b0 | (b1 << 8) | (b2 << 16) | (b3 << 24);
+        }
+    }
+    for (; i < count; i++)
+        values[i] = saturate_gain<int8_t>(values[i], gain);
+}
+
 void amplify_iq_buffer(uint8_t* buffer, uint32_t length, uint32_t amplification, uint8_t sample_size) {
-    uint32_t mult_count = length / sample_size / 2;
+    // Any gain above 0x10000 saturates every non-zero value anyway and would overflow the product.
+    const int32_t gain = std::min<uint32_t>(amplification, 0x10000);
 
     switch (sample_size) {
-        case sizeof(complex16_t): {
-            int16_t* buf_ptr = (int16_t*)buffer;
-            for (uint32_t i = 0; i < mult_count; i++) {
-                int32_t val = *buf_ptr * amplification;
-                if (val > 0x7FFF)
-                    val = 0x7FFF;
-                else if (val < -0x7FFF)
-                    val = -0x7FFF;
-                *buf_ptr++ = val;
-            }
+        case sizeof(complex16_t):
+            amplify_c16(reinterpret_cast<int16_t*>(buffer), length / sizeof(int16_t), gain);
             break;
-        }
 
-        case sizeof(complex8_t): {
-            int8_t* buf_ptr = (int8_t*)buffer;
-            for (uint32_t i = 0; i < mult_count; i++) {
-                int32_t val = *buf_ptr * amplification;
-                if (val > 0x7F)
-                    val = 0x7F;
-                else if (val < -0x7F)
-                    val = -0x7F;
-                *buf_ptr++ = val;
-            }
+        case sizeof(complex8_t):
+            amplify_c8(reinterpret_cast<int8_t*>(buffer), length / sizeof(int8_t), gain);
             break;
-        }
 
         default:
             break;
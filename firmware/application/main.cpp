@@ -186,11 +186,13 @@ int main(void) {
 
             lcd_frame_sync_configure();
             rtc_interrupt_enable();
+            m4_image_index_init();
 
             Theme::SetTheme((Theme::ThemeId)portapack::persistent_memory::ui_theme_id());  // load theme
 
             event_loop();
 
+            sd_card::flush();
             sdcDisconnect(&SDCD1);
             sdcStop(&SDCD1);
 
@@ -0,0 +1,164 @@
+/*
+ * Copyright (C) 2026
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "pcm_resampler.hpp"
+#include "complex.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace pcm {
+
+size_t to_mono_s16(const uint8_t* src, size_t frames, uint16_t bits_per_sample, uint16_t channels, int16_t* dst) {
+    if (!is_supported_format(bits_per_sample, channels))
+        return 0;
+
+    if (bits_per_sample == 8) {
+        if (channels == 1) {
+            for (size_t i = 0; i < frames; i++)
+                dst[i] = (int16_t)((src[i] - 0x80) * 256);
+        } else {
+            for (size_t i = 0; i < frames; i++, src += 2)
+                dst[i] = (int16_t)(((src[0] - 0x80) + (src[1] - 0x80)) * 128);
+        }
+    } else {
+        if (channels == 1) {
+            for (size_t i = 0; i < frames; i++, src += 2)
+                dst[i] = (int16_t)(src[0] | (src[1] << 8));
+        } else {
+            for (size_t i = 0; i < frames; i++, src += 4) {
+                const int32_t l = (int16_t)(src[0] | (src[1] << 8));
+                const int32_t r = (int16_t)(src[2] | (src[3] << 8));
+                dst[i] = (int16_t)((l + r) >> 1);
+            }
+        }
+    }
+
+    return frames;
+}
+
+void Resampler::configure(uint32_t input_rate, uint32_t output_rate) {
+    input_rate_ = input_rate ? input_rate : 1;
+    output_rate_ = output_rate ? output_rate : 1;
+    bypass_ = (input_rate_ == output_rate_);
+
+    const uint64_t step = ((uint64_t)input_rate_ << 32) / output_rate_;
+    step_int_ = step >> 32;
+    step_frac_ = (uint32_t)step;
+
+    if (!bypass_) {
+        // Windowed sinc prototype spanning taps input samples, sampled at phases x the input rate.
+        // Cutoff in cycles per input sample, with a 10% guard band below the lower Nyquist.
+        const float fc = 0.45f * std::min(input_rate_, output_rate_) / input_rate_;
+        const float centre = taps / 2.0f;
+
+        for (size_t p = 0; p < phases; p++) {
+            std::array<float, taps> h{};
+            float sum = 0.0f;
+
+            for (size_t j = 0; j < taps; j++) {
+                const float t = j + (float)p / phases;
+                const float x = t - centre;
+                const float u = t / taps;
+                const float sinc = (x == 0.0f) ? 1.0f : std::sin(2.0f * pi * fc * x) / (2.0f * pi * fc * x);
+                const float window = 0.42f - 0.5f * std::cos(2.0f * pi * u) + 0.08f * std::cos(4.0f * pi * u);
+                h[j] = sinc * window;
+                sum += h[j];
+            }
+
+            // Unity DC gain per phase, so phase changes don't modulate the level.
+            int32_t total = 0;
+            for (size_t j = 0; j < taps; j++) {
+                const int16_t c = (int16_t)std::lround(h[j] * 32767.0f / sum);
+                coefs_[p][taps - 1 - j] = c;  // Reversed to run oldest to newest over the history.
+                total += c;
+            }
+            coefs_[p][taps - 1 - taps / 2] += 32767 - total;
+        }
+    }
+
+    reset();
+}
+
+void Resampler::reset() {
+    history_.fill(0);
+    history_pos_ = 0;
+    frac_ = 0;
+    // Fill half the history first, so output starts aligned with the filter's centre.
+    advance_ = bypass_ ? 0 : taps / 2;
+}
+
+uint64_t Resampler::output_count(uint64_t input_samples) const {
+    return (input_samples * output_rate_ + input_rate_ - 1) / input_rate_;
+}
+
+void Resampler::push(int16_t sample) {
+    history_[history_pos_] = sample;
+    history_[history_pos_ + taps] = sample;
+    history_pos_ = (history_pos_ + 1) & (taps - 1);
+}
+
+int16_t Resampler::filter() const {
+    const int16_t* x = &history_[history_pos_];
+    const int16_t* c = coefs_[frac_ >> phase_shift].data();
+    int32_t acc = 0;
+
+    for (size_t k = 0; k < taps; k++)
+        acc += x[k] * c[k];
+
+    acc = (acc + (1 << 14)) >> 15;
+    return (int16_t)std::clamp<int32_t>(acc, INT16_MIN, INT16_MAX);
+}
+
+size_t Resampler::process(const int16_t* in, size_t& in_count, int16_t* out, size_t out_capacity) {
+    if (bypass_) {
+        const size_t n = std::min(in_count, out_capacity);
+        memcpy(out, in, n * sizeof(int16_t));
+        in_count = n;
+        return n;
+    }
+
+    size_t consumed = 0;
+    size_t produced = 0;
+
+    while (produced < out_capacity) {
+        while (advance_ > 0) {
+            if (consumed == in_count) {
+                in_count = consumed;
+                return produced;
+            }
+            push(in[consumed++]);
+            advance_--;
+        }
+
+        out[produced++] = filter();
+
+        const uint64_t next = (uint64_t)frac_ + step_frac_;
+        frac_ = (uint32_t)next;
+        advance_ = step_int_ + (uint32_t)(next >> 32);
+    }
+
+    in_count = consumed;
+    return produced;
+}
+
+} /* namespace pcm */
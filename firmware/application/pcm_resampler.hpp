@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2026
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __PCM_RESAMPLER_H
+#define __PCM_RESAMPLER_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace pcm {
+
+/* Formats the normaliser understands: 8 bit unsigned or 16 bit signed, mono or stereo. */
+constexpr bool is_supported_format(uint16_t bits_per_sample, uint16_t channels) {
+    return (bits_per_sample == 8 || bits_per_sample == 16) && (channels == 1 || channels == 2);
+}
+
+constexpr size_t frame_bytes(uint16_t bits_per_sample, uint16_t channels) {
+    return (bits_per_sample / 8) * channels;
+}
+
+/* Converts interleaved little endian PCM frames to mono s16, averaging stereo.
+ * dst may not alias src. Returns the number of frames converted. */
+size_t to_mono_s16(const uint8_t* src, size_t frames, uint16_t bits_per_sample, uint16_t channels, int16_t* dst);
+
+/* Streaming polyphase FIR resampler for mono s16 audio.
+ * All state is fixed size: a 32 phase x 16 tap Q15 windowed sinc table and
+ * a 16 sample history, so arbitrarily long files stream in constant memory.
+ * The cutoff follows the lower of the two rates, which keeps downsampling
+ * free of aliasing and upsampling free of images. Equal rates bypass the filter. */
+class Resampler {
+   public:
+    static constexpr size_t taps = 16;
+    static constexpr size_t phases = 32;
+    static constexpr uint32_t phase_shift = 32 - 5;  // log2(phases)
+
+    void configure(uint32_t input_rate, uint32_t output_rate);
+    void reset();
+
+    /* Consumes input and produces output until either runs out.
+     * in_count is updated to the number of input samples consumed.
+     * Returns the number of output samples written. */
+    size_t process(const int16_t* in, size_t& in_count, int16_t* out, size_t out_capacity);
+
+    /* Output samples produced from input_samples of input. */
+    uint64_t output_count(uint64_t input_samples) const;
+
+    bool bypass() const { return bypass_; }
+
+   private:
+    using phase_coefs_t = std::array<int16_t, taps>;
+
+    std::array<phase_coefs_t, phases> coefs_{};
+    std::array<int16_t, taps * 2> history_{};  // Mirrored, so taps are always contiguous.
+    size_t history_pos_{0};
+
+    uint32_t input_rate_{1};
+    uint32_t output_rate_{1};
+    uint32_t step_int_{1};   // Integer input samples per output sample.
+    uint32_t step_frac_{0};  // Fractional part, 0.32 fixed point.
+    uint32_t frac_{0};
+    uint32_t advance_{0};  // Input samples to consume before the next output.
+    bool bypass_{true};
+
+    void push(int16_t sample);
+    int16_t filter() const;
+};
+
+} /* namespace pcm */
+
+#endif /*__PCM_RESAMPLER_H*/
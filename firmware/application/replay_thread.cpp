@@ -42,8 +42,9 @@ ReplayThread::ReplayThread(
     size_t read_size,
     size_t buffer_count,
     bool* ready_signal,
-    std::function<void(uint32_t return_code)> terminate_callback)
-    : config{read_size, buffer_count},
+    std::function<void(uint32_t return_code)> terminate_callback,
+    bool c8_samples)
+    : config{read_size, buffer_count, c8_samples},
       reader{std::move(reader)},
       ready_sig{ready_signal},
       terminate_callback{std::move(terminate_callback)} {
@@ -96,6 +97,8 @@ uint32_t ReplayThread::run() {
                 if (read_result.is_error()) {
                     return READ_ERROR;
                 }
+                if (read_result.value() < block_size)
+                    config.end_of_stream = true;
             }
 
             prefill_buffer->set_size(config.read_size);
@@ -114,8 +117,11 @@ uint32_t ReplayThread::run() {
             return READ_ERROR;
         } else {
             if (read_result.value() == 0) {
+                config.end_of_stream = true;
                 return END_OF_FILE;
             }
+            if (read_result.value() < buffer->capacity())
+                config.end_of_stream = true;
         }
 
         buffer->set_size(buffer->capacity());
@@ -41,7 +41,8 @@ class ReplayThread {
         size_t read_size,
         size_t buffer_count,
         bool* ready_signal,
-        std::function<void(uint32_t return_code)> terminate_callback);
+        std::function<void(uint32_t return_code)> terminate_callback,
+        bool c8_samples = false);
     ~ReplayThread();
 
     ReplayThread(const ReplayThread&) = delete;
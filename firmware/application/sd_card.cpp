@@ -24,6 +24,7 @@
 #include <hal.h>
 
 #include "ff.h"
+#include "diskio.h"
 
 namespace sd_card {
 
@@ -73,4 +74,15 @@ Status status() {
     return status_;
 }
 
+void flush() {
+    if (status_ != Status::Mounted)
+        return;
+
+    /* Take the volume lock, so the cache is not synced under a FatFs call running on another thread. */
+    if (ff_req_grant(fs.sobj)) {
+        disk_ioctl(0, CTRL_SYNC, nullptr);
+        ff_rel_grant(fs.sobj);
+    }
+}
+
 } /* namespace sd_card */
@@ -45,6 +45,10 @@ extern Signal<Status> status_signal;
 void poll_inserted();
 Status status();
 
+/* Writes out sectors held back by the diskio sector cache.
+ * Call before disconnecting or handing the card to another core. */
+void flush();
+
 } /* namespace sd_card */
 
 #endif /*__SD_CARD_H__*/
@@ -184,4 +184,12 @@ tone_index tone_key_index_by_string(char* str) {
     return -1;
 }
 
+// Return DCS code as "D:023N" / "D:023I"
+std::string dcs_code_string(uint32_t code, bool inverted) {
+    std::string str = "D:";
+    for (int shift = 6; shift >= 0; shift -= 3)
+        str += (char)('0' + ((code >> shift) & 7));
+    return str + (inverted ? "I" : "N");
+}
+
 }  // namespace tonekey
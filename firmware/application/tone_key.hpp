@@ -47,6 +47,7 @@ std::string tone_key_string(tone_index index);
 std::string tone_key_value_string(tone_index index);
 std::string tone_key_string_by_value(uint32_t value, size_t max_length);
 tone_index tone_key_index_by_value(uint32_t value);
+std::string dcs_code_string(uint32_t code, bool inverted);
 
 }  // namespace tonekey
 
@@ -263,6 +263,141 @@ void GeoMap::map_read_line_bin(ui::Color* buffer, uint16_t pixels) {
     }
 }
 
+void GeoMap::tile_seek(int32_t& seek_x, int32_t& seek_y) const {
+    const auto r = screen_rect();
+    const int zoom_in = (map_zoom > 1) ? map_zoom : 1;
+    const int zoom_out = (map_zoom < 0) ? -map_zoom : 1;
+    seek_x = x_pos - (float)(r.width() * zoom_out) / (2 * zoom_in);
+    seek_y = y_pos - (float)(r.height() * zoom_out) / (2 * zoom_in);
+}
+
+void GeoMap::draw_map_tiles(const ui::Rect area) {
+    const auto r = screen_rect();
+    const auto clip = area.intersect(r);
+    if (clip.is_empty())
+        return;
+
+    // Use the pyramid level that matches the zoom out factor, then sample it like the line based reader does
+    const int zoom_in = (map_zoom > 1) ? map_zoom : 1;
+    const int zoom_out = (map_zoom < 0) ? -map_zoom : 1;
+    uint8_t level = 0;
+    while ((level + 1 < map_tiles->levels()) && ((2 << level) <= zoom_out))
+        level++;
+
+    // Sample at the position the rest of the screen was drawn at
+    const int32_t seek_x = tiles_seek_x;
+    const int32_t seek_y = tiles_seek_y;
+
+    std::vector<int32_t> map_x(clip.width());
+    for (int x = 0; x < clip.width(); x++)
+        map_x[x] = (seek_x + ((x + clip.left() - r.left()) * zoom_out) / zoom_in) >> level;
+    std::vector<int32_t> map_y(clip.height());
+    for (int y = 0; y < clip.height(); y++)
+        map_y[y] = (seek_y + ((y + clip.top() - r.top()) * zoom_out) / zoom_in) >> level;
+
+    const int tile_shift = 5;
+    static_assert((1 << tile_shift) == geomap::tile_size, "tile_shift must match the tile size");
+    const int32_t tile_mask = geomap::tile_size - 1;
+    std::vector<ui::Color> line(clip.width());
+
+    // Walk the area one tile at a time so each tile is fetched once
+    for (int y0 = 0; y0 < clip.height();) {
+        const int32_t tile_y = map_y[y0] >> tile_shift;
+        int y1 = y0 + 1;
+        while ((y1 < clip.height()) && ((map_y[y1] >> tile_shift) == tile_y))
+            y1++;
+
+        for (int x0 = 0; x0 < clip.width();) {
+            const int32_t tile_x = map_x[x0] >> tile_shift;
+            int x1 = x0 + 1;
+            while ((x1 < clip.width()) && ((map_x[x1] >> tile_shift) == tile_x))
+                x1++;
+
+            const ui::Color* tile = map_tiles->get(level, tile_x, tile_y);
+            if (tile) {
+                for (int y = y0; y < y1; y++) {
+                    const ui::Color* tile_line = tile + ((map_y[y] & tile_mask) << tile_shift);
+                    for (int x = x0; x < x1; x++)
+                        line[x - x0] = tile_line[map_x[x] & tile_mask];
+                    display.draw_pixels({clip.left() + x0, clip.top() + y, x1 - x0, 1}, line.data(), x1 - x0);
+                }
+            } else {
+                display.fill_rectangle({clip.left() + x0, clip.top() + y0, x1 - x0, y1 - y0}, Color::black());
+            }
+            x0 = x1;
+        }
+        y0 = y1;
+    }
+}
+
+void GeoMap::restore_marker_areas() {
+    for (size_t i = 0; i < marker_areas_len; i++)
+        draw_map_tiles(marker_areas[i]);
+    marker_areas_len = 0;
+}
+
+void GeoMap::track_area(const ui::Rect area) {
+    if (map_tiles && !use_osm && (marker_areas_len < marker_areas.size()))
+        marker_areas[marker_areas_len++] = area;
+}
+
+bool GeoMap::scroll_map_tiles() {
+    const auto r = screen_rect();
+    int32_t seek_x, seek_y;
+    tile_seek(seek_x, seek_y);
+
+    // Screen pixels only line up with the previous drawing for whole steps of the zoom out factor
+    const int zoom_in = (map_zoom > 1) ? map_zoom : 1;
+    const int zoom_out = (map_zoom < 0) ? -map_zoom : 1;
+    const int32_t step_x = (seek_x - tiles_seek_x) * zoom_in;
+    const int32_t step_y = (seek_y - tiles_seek_y) * zoom_in;
+    if ((step_x % zoom_out) || (step_y % zoom_out))
+        return false;
+
+    const int dx = step_x / zoom_out;
+    const int dy = step_y / zoom_out;
+    if ((abs(dx) >= r.width()) || (abs(dy) >= r.height()))
+        return false;
+
+    // Take the overlays off first so only map pixels move
+    restore_marker_areas();
+    draw_map_tiles(center_marker_area);
+    center_marker_area = {};
+
+    // The LCD already holds the rest of the view; move it instead of fetching its tiles again
+    const int width = r.width() - abs(dx);
+    const int rows = r.height() - abs(dy);
+    const int src_x = r.left() + std::max(dx, 0);
+    const int dst_x = r.left() + std::max(-dx, 0);
+    const int first_y = r.top() + std::max(-dy, 0);
+    std::vector<ui::ColorRGB888> rgb(width);
+    std::vector<ui::Color> line(width);
+    for (int i = 0; i < rows; i++) {
+        // Walk away from the exposed edge so every row is read before it is overwritten
+        const int y = (dy >= 0) ? first_y + i : first_y + rows - 1 - i;
+        display.read_pixels({src_x, y + dy, width, 1}, rgb);
+        for (int x = 0; x < width; x++)
+            line[x] = Color(rgb[x].r, rgb[x].g, rgb[x].b);
+        display.draw_pixels({dst_x, y, width, 1}, line);
+    }
+
+    tiles_seek_x = seek_x;
+    tiles_seek_y = seek_y;
+    if (dx)
+        draw_map_tiles({(dx > 0) ? r.right() - dx : r.left(), r.top(), abs(dx), r.height()});
+    if (dy)
+        draw_map_tiles({dst_x, (dy > 0) ? r.bottom() - dy : r.top(), width, abs(dy)});
+    return true;
+}
+
+ui::Rect GeoMap::marker_area(const ui::Point p, const std::string& tag) {
+    // Symbol plus the tag above it, so a later update can restore just this area
+    const int tag_width = tag.length() * 8;
+    ui::Rect area{p - Point(16, 16), {33, 33}};
+    area += {p - Point(tag_width / 2, 30), {tag_width, 16}};
+    return area;
+}
+
 void GeoMap::draw_markers(Painter& painter) {
     for (int i = 0; i < markerListLen; ++i) {
         draw_marker_item(painter, markerList[i], Color::blue(), Color::blue(), Color::magenta());
@@ -275,7 +410,9 @@ void GeoMap::draw_marker_item(Painter& painter, GeoMarker& item, const Color col
     if ((itemPoint.x() >= 0) && (itemPoint.x() < r.width()) &&
         (itemPoint.y() > 10) && (itemPoint.y() < r.height()))  // Dont draw within symbol size of top
     {
-        draw_marker(painter, {itemPoint.x() + r.left(), itemPoint.y() + r.top()}, item.angle, item.tag, color, fontColor, backColor);
+        const ui::Point screen_point{itemPoint.x() + r.left(), itemPoint.y() + r.top()};
+        draw_marker(painter, screen_point, item.angle, item.tag, color, fontColor, backColor);
+        track_area(marker_area(screen_point, item.tag));
     }
 }
 
@@ -483,6 +620,9 @@ void GeoMap::paint(Painter& painter) {
     map_line_buffer.resize(r.width());
     int16_t zoom_seek_x, zoom_seek_y;
 
+    // Only a plain move of the tiled map may scroll what is already on screen
+    const bool full_redraw = redraw_map || !tiles_drawn;
+
     if (!use_osm) {
         // Ony redraw map if it moved by at least 1 pixel or the markers list was updated
         if (map_zoom <= 1) {
@@ -503,10 +643,23 @@ void GeoMap::paint(Painter& painter) {
         // using osm; needs to be stricter with the redraws, it'll be checked on move
     }
 
+    // Marker updates over the tiled map only restore the areas under the old markers from the tile cache
+    const bool restore_markers = map_tiles && !use_osm && map_visible;
+    if (redraw_markers && !restore_markers)
+        redraw_map = true;
+
     if (redraw_map) {
         redraw_map = false;
         if (map_visible) {
-            if (!use_osm) {
+            if (!use_osm && map_tiles) {
+                prev_x_pos = x_pos;
+                prev_y_pos = y_pos;
+                if (full_redraw || !scroll_map_tiles()) {
+                    tile_seek(tiles_seek_x, tiles_seek_y);
+                    draw_map_tiles(r);
+                }
+                tiles_drawn = true;
+            } else if (!use_osm) {
                 prev_x_pos = x_pos;  // Note x_pos/y_pos pixel position in map file now correspond to screen rect CENTER pixel
                 prev_y_pos = y_pos;
                 // Adjust starting corner position of map per zoom setting;
@@ -574,23 +727,40 @@ void GeoMap::paint(Painter& painter) {
             // No map data or excessive zoom; just draw a grid
             draw_map_grid(r);
         }
+        if (!map_visible || use_osm || !map_tiles)
+            tiles_drawn = false;
+        marker_areas_len = 0;
+        center_marker_area = {};
+        redraw_markers = true;
+    } else if (redraw_markers) {
+        restore_marker_areas();
+    }
+
+    if (redraw_markers) {
+        redraw_markers = false;
         // Draw crosshairs in center in manual panning mode
         if (manual_panning_) {
             display.fill_rectangle({r.center() - Point(16, 1) + Point(zoom_pixel_offset, zoom_pixel_offset), {32, 2}}, Color::red());
             display.fill_rectangle({r.center() - Point(1, 16) + Point(zoom_pixel_offset, zoom_pixel_offset), {2, 32}}, Color::red());
+            track_area({r.center() - Point(16, 16) + Point(zoom_pixel_offset, zoom_pixel_offset), {32, 32}});
         }
 
         // Draw the other markers
         draw_markers(painter);
         if (!use_osm) draw_scale(painter);
         draw_mypos(painter);
-        if (has_osm) draw_switcher(painter);
+        if (has_osm) {
+            draw_switcher(painter);
+            track_area({r.location(), {3 * 20, 20}});
+        }
         set_clean();
     }
 
     // Draw the marker in the center
     if (!manual_panning_ && !hide_center_marker_) {
-        draw_marker(painter, r.center() + Point(zoom_pixel_offset, zoom_pixel_offset), angle_, tag_, Color::red(), Color::white(), Color::black());
+        const ui::Point center = r.center() + Point(zoom_pixel_offset, zoom_pixel_offset);
+        draw_marker(painter, center, angle_, tag_, Color::red(), Color::white(), Color::black());
+        center_marker_area = marker_area(center, tag_);
     }
 }
 
@@ -663,13 +833,33 @@ void GeoMap::move(const float lon, const float lat) {
 }
 
 bool GeoMap::init() {
-    auto result = map_file.open(adsb_dir / u"world_map.bin");
-    map_opened = !result.is_valid();
+    // Prefer the pre-tiled map, fall back to the line based world_map.bin
+    auto result = map_file.open(adsb_dir / u"world_map_tiles.bin");
+    if (!result.is_valid()) {
+        // Enough tiles for the strips exposed by a diagonal pan; scroll_map_tiles() moves the rest
+        const auto r = screen_rect();
+        const size_t slots = geomap::tiles_spanned(r.width()) + geomap::tiles_spanned(r.height());
+        map_tiles = std::make_unique<geomap::TileCache<File, GeoMapTileHeap>>(map_file);
+        if (!map_tiles->allocate(slots) || !map_tiles->open()) {
+            map_tiles.reset();
+            map_file.close();
+        }
+    }
 
-    if (map_opened) {
-        map_file.read(&map_width, 2);
-        map_file.read(&map_height, 2);
+    if (map_tiles) {
+        map_opened = true;
+        map_width = map_tiles->width();
+        map_height = map_tiles->height();
     } else {
+        result = map_file.open(adsb_dir / u"world_map.bin");
+        map_opened = !result.is_valid();
+        if (map_opened) {
+            map_file.read(&map_width, 2);
+            map_file.read(&map_height, 2);
+        }
+    }
+
+    if (!map_opened) {
         map_width = 32768;
         map_height = 32768;
     }
@@ -728,7 +918,9 @@ void GeoMap::draw_scale(Painter& painter) {
     display.fill_rectangle({{r.right() - 5, r.bottom() - 8}, {2, 6}}, scale_color);
     display.fill_rectangle({{r.right() - 5 - (uint16_t)scale_width, r.bottom() - 8}, {2, 6}}, scale_color);
 
-    painter.draw_string({(uint16_t)(r.right() - 25 - scale_width - km_string.length() * 5 / 2), r.bottom() - 10}, ui::font::fixed_5x8, Color::black(), Color::white(), km_string);
+    const int text_x = r.right() - 25 - scale_width - km_string.length() * 5 / 2;
+    painter.draw_string({(uint16_t)text_x, r.bottom() - 10}, ui::font::fixed_5x8, Color::black(), Color::white(), km_string);
+    track_area({text_x, r.bottom() - 10, r.right() - text_x, 10});
 }
 
 void GeoMap::draw_bearing(const Point origin, const uint16_t angle, uint32_t size, const Color color) {
@@ -807,7 +999,7 @@ MapMarkerStored GeoMap::store_marker(GeoMarker& marker) {
     } else if (markerListLen < NumMarkerListElements) {
         markerList[markerListLen] = marker;
         markerListLen++;
-        redraw_map = true;
+        redraw_markers = true;
         ret = MARKER_STORED;
     } else {
         ret = MARKER_LIST_FULL;
@@ -820,7 +1012,8 @@ void GeoMap::update_my_position(float lat, float lon, int32_t altitude) {
     my_pos.lat = lat;
     my_pos.lon = lon;
     my_altitude = altitude;
-    redraw_map = is_changed;
+    if (is_changed)
+        redraw_markers = true;
     set_dirty();
 }
 
@@ -828,7 +1021,7 @@ void GeoMap::update_my_orientation(uint16_t angle, bool refresh) {
     bool is_changed = (my_pos.angle != angle);
     my_pos.angle = angle;
     if (refresh && is_changed) {
-        redraw_map = true;
+        redraw_markers = true;
         set_dirty();
     }
 }
@@ -28,9 +28,14 @@
 #include "file.hpp"
 #include "ui_navigation.hpp"
 #include "bmpfile.hpp"
+#include "geomap_tiles.hpp"
 #include "mathdef.hpp"
 
 #include "portapack.hpp"
+#include "ch.h"
+
+#include <array>
+#include <memory>
 
 namespace ui {
 
@@ -200,6 +205,12 @@ enum MapType {
     MAP_TYPE_BIN
 };
 
+// Tile slots come straight from the ChibiOS heap, which returns NULL when short
+struct GeoMapTileHeap {
+    static void* allocate(size_t size) { return chHeapAlloc(nullptr, size); }
+    static void release(void* p) { chHeapFree(p); }
+};
+
 class GeoMap : public Widget {
    public:
     std::function<void(float, float, bool)> on_move{};
@@ -253,6 +264,12 @@ class GeoMap : public Widget {
     void draw_map_grid(ui::Rect r);
     void draw_switcher(Painter& painter);
     void map_read_line_bin(ui::Color* buffer, uint16_t pixels);
+    void tile_seek(int32_t& seek_x, int32_t& seek_y) const;
+    void draw_map_tiles(const ui::Rect area);
+    bool scroll_map_tiles();
+    void restore_marker_areas();
+    void track_area(const ui::Rect area);
+    static ui::Rect marker_area(const ui::Point p, const std::string& tag);
     // open street map related
     uint8_t find_osm_file_tile();
     void set_osm_max_zoom(bool changeboth = false);
@@ -272,6 +289,11 @@ class GeoMap : public Widget {
     bool hide_center_marker_{false};
     GeoMapMode mode_{};
     File map_file{};
+    // Decoded tiles of world_map_tiles.bin; only allocated when that file is present
+    std::unique_ptr<geomap::TileCache<File, GeoMapTileHeap>> map_tiles{};
+    // Map pixel at the top left of the tiles currently on screen
+    int32_t tiles_seek_x{0}, tiles_seek_y{0};
+    bool tiles_drawn{false};
     bool map_opened{};
     bool map_visible{};
     uint16_t map_width{}, map_height{};
@@ -298,6 +320,11 @@ class GeoMap : public Widget {
     int markerListLen{0};
     GeoMarker markerList[NumMarkerListElements];
     bool redraw_map{true};
+    bool redraw_markers{false};
+    // Screen areas covered by markers, crosshair, scale and switcher drawn over the tiled map
+    std::array<ui::Rect, NumMarkerListElements + 4> marker_areas{};
+    size_t marker_areas_len{0};
+    ui::Rect center_marker_area{};
     bool use_osm{false};
     bool has_osm{false};
 };
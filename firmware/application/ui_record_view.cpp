@@ -230,7 +230,9 @@ void RecordView::start() {
         } break;
 
         case FileType::RawS8:
-        case FileType::RawS16: {
+        case FileType::RawS16:
+        case FileType::BFP6:
+        case FileType::BFP4: {
             const auto metadata_file_error = write_metadata_file(
                 get_metadata_path(base_path), {receiver_model.target_frequency(), sampling_rate, latitude, longitude, satinuse});
             if (metadata_file_error.is_valid()) {
@@ -239,8 +241,25 @@ void RecordView::start() {
             }
 
             auto p = std::make_unique<FileConvertWriter>();
-            trim_path = base_path.replace_extension((file_type == FileType::RawS8) ? u".C8" : u".C16");
-            auto create_error = p->create(trim_path);
+            std::filesystem::path capture_path;
+            switch (file_type) {
+                case FileType::RawS8:
+                    capture_path = base_path.replace_extension(u".C8");
+                    break;
+                case FileType::BFP6:
+                    capture_path = base_path.replace_extension(u".C6");
+                    break;
+                case FileType::BFP4:
+                    capture_path = base_path.replace_extension(u".C4");
+                    break;
+                default:
+                    capture_path = base_path.replace_extension(u".C16");
+                    break;
+            }
+            // IQ trim only handles C8 and C16
+            if (file_type == FileType::RawS8 || file_type == FileType::RawS16)
+                trim_path = capture_path;
+            auto create_error = p->create(capture_path);
             if (create_error.is_valid()) {
                 handle_error(create_error.value());
             } else {
@@ -265,7 +284,8 @@ void RecordView::start() {
             [](File::Error error) {
                 CaptureThreadDoneMessage message{error.code()};
                 EventDispatcher::send_message(message);
-            });
+            },
+            stream_bytes_per_second());
     }
 
     update_status_display();
@@ -295,6 +315,8 @@ void RecordView::update_status_display() {
         const auto dropped_percent = std::min(99U, capture_thread->state().dropped_percent());
         const auto s = to_string_dec_uint(dropped_percent, 2, ' ') + "%";
         text_record_dropped.set(s);
+        // Red once the card has stalled long enough to drop samples, even if it rounds to 0%.
+        text_record_dropped.set_style(CaptureThread::stats().overruns ? Theme::getInstance()->fg_red : nullptr);
     }
 
     /*
@@ -308,8 +330,15 @@ void RecordView::update_status_display() {
         // - Audio is 1 int16_t per sample or '2' bytes per sample.
         // - C8 captures 2 (I,Q) int8_t per sample or '2' bytes per sample.
         // - C16 captures 2 (I,Q) int16_t per sample or '4' bytes per sample.
-        const auto bytes_per_sample = file_type == FileType::RawS16 ? 4 : 2;
-        const uint32_t bytes_per_second = sampling_rate * bytes_per_sample;
+        // - C6/C4 captures pack 2 (I,Q) 6/4 bit values per sample plus an exponent byte per block.
+        uint32_t bytes_per_second;
+        if (file_type == FileType::BFP6 || file_type == FileType::BFP4) {
+            const auto block_bytes = file_convert::bfp_block_bytes(file_type == FileType::BFP6 ? 6 : 4);
+            bytes_per_second = (uint64_t)sampling_rate * block_bytes / file_convert::bfp_block_samples;
+        } else {
+            const auto bytes_per_sample = file_type == FileType::RawS16 ? 4 : 2;
+            bytes_per_second = sampling_rate * bytes_per_sample;
+        }
         const uint32_t available_seconds = space_info.free / bytes_per_second;
         const uint32_t seconds = available_seconds % 60;
         const uint32_t available_minutes = available_seconds / 60;
@@ -323,6 +352,11 @@ void RecordView::update_status_display() {
     }
 }
 
+// The baseband streams C16 for every IQ format and converts on the way to the file.
+uint32_t RecordView::stream_bytes_per_second() const {
+    return sampling_rate * (file_type == FileType::WAV ? sizeof(int16_t) : sizeof(complex16_t));
+}
+
 void RecordView::trim_capture() {
     using bucket_t = iq::PowerBuckets::Bucket;
 
@@ -44,6 +44,8 @@ class RecordView : public View {
         RawS8 = 1,
         RawS16 = 2,
         WAV = 3,
+        BFP6 = 4,  // Block floating point, see file_convert::bfp_encode_block()
+        BFP4 = 5,
     };
 
     RecordView(
@@ -75,12 +77,16 @@ class RecordView : public View {
     void set_filename_date_frequency(bool set);
     void set_filename_as_is(bool set);
 
+    /* Write latency and overrun counts of the running or last capture. */
+    const CaptureStats& capture_stats() const { return CaptureThread::stats(); }
+
    private:
     void toggle();
     // void toggle_pitch_rssi();
 
     void on_tick_second();
     void update_status_display();
+    uint32_t stream_bytes_per_second() const;
     void trim_capture();
 
     void handle_capture_thread_done(const File::Error error);
@@ -51,6 +51,9 @@
 #include "usb_serial_shell_filesystem.hpp"
 
 #include "portapack_persistent_memory.hpp"
+#include "sd_card.hpp"
+#include "fatfs_cache.h"
+#include "capture_thread.hpp"
 
 #include <string>
 #include <cstring>
@@ -117,6 +120,7 @@ static void cmd_sd_over_usb(BaseSequentialStream* chp, int argc, char* argv[]) {
         Theme::getInstance()->fg_yellow->foreground,
         Theme::getInstance()->fg_yellow->background);
 
+    sd_card::flush();
     sdcDisconnect(&SDCD1);
     sdcStop(&SDCD1);
 
@@ -1189,6 +1193,113 @@ static void cmd_sysinfo(BaseSequentialStream* chp, int argc, char* argv[]) {
     return;
 }
 
+static void cmd_bbprof(BaseSequentialStream* chp, int argc, char* argv[]) {
+    const char* usage = "usage: bbprof [reset]\r\n";
+    if (argc == 1 && strcmp(argv[0], "reset") == 0) {
+        shared_memory.request_m4_profile_reset = 1;
+        chprintf(chp, "ok\r\n");
+        return;
+    }
+    if (argc > 0) {
+        chprintf(chp, usage);
+        return;
+    }
+
+    // Values are M4 cycles per baseband block; p99 is a histogram bucket bound.
+    chprintf(chp, "%-15s %8s %8s %8s %8s %8s\r\n", "stage", "blocks", "min", "mean", "p99", "max");
+    for (size_t i = 0; i < baseband::profile::stage_count; i++) {
+        const auto& stats = shared_memory.m4_profile.stages[i];
+        if (stats.count == 0) continue;
+        chprintf(chp, "%-15s %8lu %8lu %8lu %8lu %8lu\r\n",
+                 baseband::profile::stage_names[i],
+                 stats.count,
+                 stats.min,
+                 baseband::profile::mean(stats),
+                 baseband::profile::percentile(stats, 99),
+                 stats.max);
+    }
+    chprintf(chp, "M4 miss: %u\r\n", shared_memory.m4_buffer_missed);
+}
+
+static void cmd_uistats(BaseSequentialStream* chp, int argc, char* argv[]) {
+    const char* usage = "usage: uistats\r\n";
+    (void)argv;
+    if (argc > 0) {
+        chprintf(chp, usage);
+        return;
+    }
+
+    chprintf(chp, "last frame pixels: %lu\r\n", ui::Painter::last_frame_pixels());
+    chprintf(chp, "total pixels: %lu\r\n", portapack::io.lcd_pixels_written());
+}
+
+static void cmd_m4stats(BaseSequentialStream* chp, int argc, char* argv[]) {
+    const char* usage = "usage: m4stats\r\n";
+    (void)argv;
+    if (argc > 0) {
+        chprintf(chp, usage);
+        return;
+    }
+
+    const auto& stats = m4_image_stats();
+    chprintf(chp, "image loads: %lu\r\n", stats.loads);
+    chprintf(chp, "resident hits: %lu\r\n", stats.resident_hits);
+    chprintf(chp, "last launch: %lu us (%s)\r\n", stats.last_load_us, stats.last_resident ? "resident" : "decompressed");
+    chprintf(chp, "max launch: %lu us\r\n", stats.max_load_us);
+}
+
+static void cmd_sdcache(BaseSequentialStream* chp, int argc, char* argv[]) {
+    const char* usage = "usage: sdcache [flush]\r\n";
+    if (argc > 1 || (argc == 1 && strcmp(argv[0], "flush") != 0)) {
+        chprintf(chp, usage);
+        return;
+    }
+
+    if (argc == 1)
+        sd_card::flush();
+
+    const auto& stats = *fatfs_cache_stats();
+    chprintf(chp, "read hits: %lu (read-ahead %lu)\r\n", stats.hits, stats.readahead_hits);
+    chprintf(chp, "read misses: %lu\r\n", stats.misses);
+    chprintf(chp, "read-aheads: %lu\r\n", stats.readaheads);
+    chprintf(chp, "write hits: %lu\r\n", stats.write_hits);
+    chprintf(chp, "write-backs: %lu\r\n", stats.write_backs);
+    chprintf(chp, "flushes: %lu (%lu coalesced writes)\r\n", stats.flushes, stats.coalesced);
+}
+
+static void cmd_capstats(BaseSequentialStream* chp, int argc, char* argv[]) {
+    const char* usage = "usage: capstats\r\n";
+    (void)argv;
+    if (argc > 0) {
+        chprintf(chp, usage);
+        return;
+    }
+
+    const auto& stats = CaptureThread::stats();
+    const auto& latency = stats.write_us;
+    if (latency.count == 0) {
+        chprintf(chp, "no capture\r\n");
+        return;
+    }
+
+    chprintf(chp, "buffers: %lu x %lu bytes\r\n", stats.buffer_count, stats.write_size);
+    chprintf(chp, "stream: %lu bytes/s\r\n", stats.bytes_per_second);
+    chprintf(chp, "written: %lu KiB in %lu writes (%lu coalesced)\r\n",
+             (uint32_t)(stats.bytes_written / 1024), latency.count, stats.writes_coalesced);
+    chprintf(chp, "overruns: %lu\r\n", stats.overruns);
+    chprintf(chp, "write us: min %lu mean %lu p99 %lu max %lu\r\n",
+             latency.min, baseband::profile::mean(latency), baseband::profile::percentile(latency, 99), latency.max);
+
+    // Histogram rows are "<upper bound us> <writes>"; the last bucket is open ended.
+    for (size_t i = 0; i < baseband::profile::bucket_count; i++) {
+        if (latency.histogram[i] == 0) continue;
+        if (i == baseband::profile::bucket_count - 1)
+            chprintf(chp, ">%7lu %8u\r\n", baseband::profile::bucket_upper(i - 1), latency.histogram[i]);
+        else
+            chprintf(chp, "<%7lu %8u\r\n", baseband::profile::bucket_upper(i), latency.histogram[i]);
+    }
+}
+
 static void cmd_radioinfo(BaseSequentialStream* chp, int argc, char* argv[]) {
     const char* usage = "usage: radioinfo\r\n";
     (void)argv;
@@ -1413,6 +1524,11 @@ static const ShellCommand commands[] = {
     {"gotlight", cmd_gotlight},
     {"sysinfo", cmd_sysinfo},
     {"radioinfo", cmd_radioinfo},
+    {"bbprof", cmd_bbprof},
+    {"uistats", cmd_uistats},
+    {"m4stats", cmd_m4stats},
+    {"sdcache", cmd_sdcache},
+    {"capstats", cmd_capstats},
     {"pmemreset", cmd_pmemreset},
     {"settingsreset", cmd_settingsreset},
     {"sendpocsag", cmd_sendpocsag},
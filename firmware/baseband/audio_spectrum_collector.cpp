@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2026
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "audio_spectrum_collector.hpp"
+
+#include "dsp_fft.hpp"
+#include "portapack_shared_memory.hpp"
+#include "utility.hpp"
+
+#include <algorithm>
+
+void AudioSpectrumCollector::feed(const buffer_s16_t& audio) {
+    if (++timer >= interval) {
+        timer = 0;
+        if (state == State::Idle) {
+            state = State::Feed;
+            fill = 0;
+        }
+    }
+
+    switch (state) {
+        case State::Feed:
+            collect(audio);
+            break;
+
+        case State::FFT:
+            if (fft_step < log_2(fft_size)) {
+                fft_c_preswapped(fft_data, fft_step, fft_step + 1);
+                fft_step++;
+            } else {
+                post_spectrum();
+                state = State::Idle;
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+void AudioSpectrumCollector::collect(const buffer_s16_t& audio) {
+    /* Even samples go to the real part and odd ones to the imaginary part
+     * of the bit reversed FFT input, which saves a separate fft_swap() pass. */
+    const size_t count = std::min(audio.count, real_size - fill);
+    for (size_t i = 0; i < count; i++, fill++) {
+        const size_t i_rev = __RBIT(fill >> 1) >> (32 - log_2(fft_size));
+        const float s = audio.p[i] * scale;
+        if (fill & 1)
+            fft_data[i_rev].imag(s);
+        else
+            fft_data[i_rev].real(s);
+    }
+
+    if (fill == real_size) {
+        state = State::FFT;
+        fft_step = 0;
+    }
+}
+
+void AudioSpectrumCollector::post_spectrum() {
+    static_assert(std::tuple_size<decltype(spectrum.db)>::value == fft_size);
+
+    /* exp(-i*PI/fft_size) - 1, advances the split twiddle by one bin. */
+    constexpr std::complex<float> wp{-0.00030118130379577988423f, -0.024541228522912288032f};
+    std::complex<float> w{1.0f, 0.0f};
+
+    for (size_t i = 0; i < fft_size; i++) {
+        const auto bin = fft_r_split_bin(fft_data, i, w);
+        w += w * wp;
+
+        const float db = mag2_to_dbv_norm(magnitude_squared(bin));
+        constexpr float mag_scale = 5.0f;
+        const unsigned int v = (db * mag_scale) + 255.0f;
+        spectrum.db[i] = std::max(0U, std::min(255U, v));
+    }
+
+    AudioSpectrumMessage message{&spectrum};
+    shared_memory.application_queue.push(message);
+}
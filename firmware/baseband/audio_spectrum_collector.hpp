@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2026
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __AUDIO_SPECTRUM_COLLECTOR_H__
+#define __AUDIO_SPECTRUM_COLLECTOR_H__
+
+#include "dsp_types.hpp"
+#include "message.hpp"
+
+#include <array>
+#include <complex>
+#include <cstdint>
+
+/* Posts an AudioSpectrum of 256 real audio samples every `interval` calls to
+ * feed(). Samples are packed in pairs into a 128 point complex FFT followed
+ * by a real split stage, and the work is spread over consecutive calls
+ * (one FFT stage per call) so audio processing never misses a buffer. */
+class AudioSpectrumCollector {
+   public:
+    constexpr AudioSpectrumCollector(const uint32_t interval, const float scale)
+        : interval{interval},
+          scale{scale} {
+    }
+
+    void feed(const buffer_s16_t& audio);
+
+   private:
+    static constexpr size_t fft_size = 128;
+    static constexpr size_t real_size = fft_size * 2;
+
+    enum class State {
+        Idle,
+        Feed,
+        FFT,
+    };
+
+    const uint32_t interval;
+    const float scale;
+
+    std::array<std::complex<float>, fft_size> fft_data{};
+    AudioSpectrum spectrum{};
+    State state{State::Idle};
+    uint32_t timer{0};
+    size_t fill{0};
+    size_t fft_step{0};
+
+    void collect(const buffer_s16_t& audio);
+    void post_spectrum();
+};
+
+#endif /*__AUDIO_SPECTRUM_COLLECTOR_H__*/
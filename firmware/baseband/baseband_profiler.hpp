@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2026
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __BASEBAND_PROFILER_H__
+#define __BASEBAND_PROFILER_H__
+
+#include "baseband_profile.hpp"
+
+#include <cstdint>
+
+#if defined(__arm__)
+#include "ch.h"
+#include "hal.h"
+#else
+#include <chrono>
+#endif
+
+namespace baseband {
+namespace profile {
+
+/* DWT cycle counter on the M4 (enabled by the HAL), nanoseconds on host builds. */
+inline uint32_t cycle_count() {
+#if defined(__arm__)
+    return halGetCounterValue();
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+#endif
+}
+
+/* Times consecutive stages of one block: construct with the first stage,
+ * call lap() with the next one between stages; the last stage ends on
+ * destruction. Unsigned subtraction handles counter wrap.
+ */
+class StageTimer {
+   public:
+    StageTimer(Profile& profile, const Stage stage)
+        : profile_{profile},
+          stage_{stage},
+          start_{cycle_count()} {
+    }
+
+    ~StageTimer() {
+        stop();
+    }
+
+    StageTimer(const StageTimer&) = delete;
+    StageTimer& operator=(const StageTimer&) = delete;
+
+    void lap(const Stage next) {
+        const auto now = cycle_count();
+        record(profile_.stages[static_cast<size_t>(stage_)], now - start_);
+        stage_ = next;
+        start_ = now;
+    }
+
+    void stop() {
+        if (stage_ == Stage::Count) return;
+        record(profile_.stages[static_cast<size_t>(stage_)], cycle_count() - start_);
+        stage_ = Stage::Count;
+    }
+
+   private:
+    Profile& profile_;
+    Stage stage_;
+    uint32_t start_;
+};
+
+} /* namespace profile */
+} /* namespace baseband */
+
+#endif /*__BASEBAND_PROFILER_H__*/
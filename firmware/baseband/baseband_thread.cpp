@@ -32,6 +32,7 @@
 using namespace lpc43xx;
 
 #include "portapack_shared_memory.hpp"
+#include "baseband_profiler.hpp"
 
 #include "utility.hpp"
 
@@ -88,12 +89,15 @@ void BasebandThread::run() {
     baseband::dma::enable(direction());
     baseband_sgpio.streaming_enable();
 
+    baseband::profile::reset(shared_memory.m4_profile);
+
     while (!chThdShouldTerminate()) {
         // TODO: Place correct sampling rate into buffer returned here:
         const auto buffer_tmp = baseband::dma::wait_for_buffer();
         if (buffer_tmp) {
             buffer_c8_t buffer{
                 buffer_tmp.p, buffer_tmp.count, sampling_rate_};
+            sample_index_ += buffer_tmp.count;
 
             if (shared_memory.request_m4_performance_counter == 0x02) {
                 uint8_t max = shared_memory.m4_performance_counter;
@@ -109,7 +113,13 @@ void BasebandThread::run() {
                 shared_memory.m4_performance_counter = max;
             }
 
+            if (shared_memory.request_m4_profile_reset) {
+                baseband::profile::reset(shared_memory.m4_profile);
+                shared_memory.request_m4_profile_reset = 0;
+            }
+
             if (baseband_processor_) {
+                baseband::profile::StageTimer timer{shared_memory.m4_profile, baseband::profile::Stage::Execute};
                 baseband_processor_->execute(buffer);
             }
         }
@@ -59,6 +59,12 @@ class BasebandThread : public ThreadBase {
 
     void set_sampling_rate(uint32_t new_sampling_rate);
 
+    /* Baseband samples received since the thread started, including the
+     * buffer currently being executed. Used to stamp decoded packets. */
+    uint64_t sample_index() const {
+        return sample_index_;
+    }
+
    private:
     static Thread* thread;
 
@@ -66,6 +72,7 @@ class BasebandThread : public ThreadBase {
     baseband::Direction direction_;
     uint32_t sampling_rate_;
     const tprio_t priority_;
+    uint64_t sample_index_{0};
 
     void run() override;
 };
@@ -0,0 +1,154 @@
+/*
+ * Copyright (C) 2026
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "channel_activity_collector.hpp"
+
+#include "dsp_fft.hpp"
+
+#include "utility.hpp"
+#include "event_m4.hpp"
+#include "portapack_shared_memory.hpp"
+
+#include <algorithm>
+
+void ChannelActivityCollector::on_message(const Message* const message) {
+    switch (message->id) {
+        case Message::ID::UpdateSpectrum:
+            update();
+            break;
+
+        case Message::ID::ChannelActivityConfig:
+            configure(*reinterpret_cast<const ChannelActivityConfigMessage*>(message));
+            break;
+
+        default:
+            break;
+    }
+}
+
+void ChannelActivityCollector::configure(const ChannelActivityConfigMessage& message) {
+    // Called from idle thread, baseband thread only looks at armed/request_update.
+    armed = false;
+
+    const size_t count = std::min(message.channel_count, offsets.size());
+    std::copy(message.offsets.begin(), message.offsets.begin() + count, offsets.begin());
+    channel_bandwidth = message.channel_bandwidth;
+    threshold_db = message.threshold_db;
+
+    activity = {};
+    activity.config_id = message.config_id;
+    activity.channel_count = count;
+    bins_sampling_rate = 0;
+    accumulator.fill(0.0f);
+    frame_count = 0;
+
+    armed = (count > 0);
+}
+
+void ChannelActivityCollector::feed(const buffer_c16_t& wideband) {
+    // Called from baseband processing thread.
+    if (!armed || request_update || (wideband.count < fft_size)) {
+        return;
+    }
+
+    fft_swap(wideband, frame);
+    sampling_rate = wideband.sampling_rate;
+    request_update = true;
+    EventDispatcher::events_flag(EVT_MASK_SPECTRUM);
+}
+
+void ChannelActivityCollector::update_bins() {
+    /* Bin k of the FFT is at k * fs / N, negative frequencies wrap to the top half. */
+    const int32_t bin_hz = std::max<int32_t>(sampling_rate / fft_size, 1);
+    const int32_t half_span = std::max<int32_t>(channel_bandwidth / 2 / bin_hz, 0);
+    bin_span = half_span * 2 + 1;
+
+    for (size_t c = 0; c < activity.channel_count; c++) {
+        const int32_t center = (offsets[c] + ((offsets[c] >= 0) ? bin_hz / 2 : -bin_hz / 2)) / bin_hz;
+        first_bin[c] = (center - half_span) & (fft_size - 1);
+    }
+
+    bins_sampling_rate = sampling_rate;
+}
+
+void ChannelActivityCollector::update() {
+    // Called from idle thread (after EVT_MASK_SPECTRUM is flagged)
+    if (!request_update) {
+        return;
+    }
+
+    if (!armed) {
+        request_update = false;
+        return;
+    }
+
+    if (frame_count < settle_frames) {
+        frame_count++;
+        request_update = false;
+        return;
+    }
+
+    if (bins_sampling_rate != sampling_rate) {
+        update_bins();
+    }
+
+    fft_c_preswapped(frame, 0, 8);
+
+    /* Hann window applied in the frequency domain: 0.5 * X[k] - 0.25 * (X[k-1] + X[k+1]). */
+    constexpr size_t mask = fft_size - 1;
+    for (size_t c = 0; c < activity.channel_count; c++) {
+        float peak = 0.0f;
+        for (size_t n = 0; n < bin_span; n++) {
+            const size_t k = (first_bin[c] + n) & mask;
+            const auto windowed = frame[k] * 0.5f - (frame[(k - 1) & mask] + frame[(k + 1) & mask]) * 0.25f;
+            peak = std::max(peak, magnitude_squared(windowed));
+        }
+        accumulator[c] += peak;
+    }
+
+    // Frame consumed, let the baseband thread capture the next one.
+    request_update = false;
+
+    if (++frame_count < (settle_frames + integration_frames)) {
+        return;
+    }
+
+    /* Full scale complex16 tone: N * 32768 * window gain (0.5). */
+    constexpr float mag2_norm = 1.0f / ((fft_size * 32768.0f * 0.5f) * (fft_size * 32768.0f * 0.5f));
+    constexpr float frames_norm = 1.0f / integration_frames;
+    activity.active = 0;
+    for (size_t c = 0; c < activity.channel_count; c++) {
+        const int32_t db = mag2_to_dbv_norm(accumulator[c] * frames_norm * mag2_norm);
+        activity.db[c] = std::max<int32_t>(-128, std::min<int32_t>(127, db));
+        if (db > threshold_db) {
+            activity.active |= (1U << c);
+        }
+    }
+
+    const ChannelActivityMessage message{activity};
+    if (shared_memory.application_queue.push(message)) {
+        armed = false;
+    } else {
+        // Queue busy, report the next integration instead.
+        accumulator.fill(0.0f);
+        frame_count = settle_frames;
+    }
+}
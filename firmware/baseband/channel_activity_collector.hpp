@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2026
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __CHANNEL_ACTIVITY_COLLECTOR_H__
+#define __CHANNEL_ACTIVITY_COLLECTOR_H__
+
+#include "dsp_types.hpp"
+#include "complex.hpp"
+
+#include <cstdint>
+#include <array>
+
+#include "message.hpp"
+
+/* Measures the power of a list of channels inside the wideband (pre-channel filter)
+ * capture with one FFT per block, so a scanner doesn't need to retune per channel.
+ * A measurement is one-shot: each ChannelActivityConfigMessage arms one report.
+ */
+class ChannelActivityCollector {
+   public:
+    void on_message(const Message* const message);
+
+    void feed(const buffer_c16_t& wideband);
+
+   private:
+    static constexpr size_t fft_size = 256;
+    /* Frames skipped after (re)configuration to flush samples from before a retune. */
+    static constexpr size_t settle_frames = 2;
+    static constexpr size_t integration_frames = 8;
+
+    std::array<std::complex<float>, fft_size> frame{};
+    volatile bool request_update{false};
+    bool armed{false};
+    uint32_t sampling_rate{0};
+    uint32_t bins_sampling_rate{0};
+
+    ChannelActivity activity{};
+    uint32_t channel_bandwidth{0};
+    int32_t threshold_db{0};
+    std::array<int32_t, ChannelActivityConfigMessage::max_channels> offsets{};
+    std::array<uint8_t, ChannelActivityConfigMessage::max_channels> first_bin{};
+    size_t bin_span{1};
+    std::array<float, ChannelActivityConfigMessage::max_channels> accumulator{};
+    size_t frame_count{0};
+
+    void configure(const ChannelActivityConfigMessage& message);
+    void update_bins();
+    void update();
+};
+
+#endif /*__CHANNEL_ACTIVITY_COLLECTOR_H__*/
@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 2026
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __DSP_CHANNELIZER_H__
+#define __DSP_CHANNELIZER_H__
+
+#include "dsp_types.hpp"
+#include "dsp_fft.hpp"
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include <complex>
+#include <cmath>
+
+namespace dsp {
+namespace channelize {
+
+/* Critically sampled polyphase filter bank. Splits a complex stream at fs into
+ * M adjacent channels of fs / M, one output vector per M input samples.
+ * Channel c is centered at c * fs / M for c < M / 2 and at (c - M) * fs / M
+ * above, i.e. the usual FFT bin order.
+ */
+template <size_t M, size_t P>
+class PolyphaseChannelizer {
+    static_assert(power_of_two(M) && M <= 256, "M must be a power of two FFT size");
+
+   public:
+    static constexpr size_t channel_count = M;
+    static constexpr size_t taps_count = M * P;
+
+    using output_t = std::array<std::complex<float>, M>;
+
+    PolyphaseChannelizer() {
+        for (size_t i = 0; i < M; i++) {
+            size_t r = 0;
+            for (size_t b = 0; b < log_2(M); b++) {
+                r |= ((i >> b) & 1) << (log_2(M) - 1 - b);
+            }
+            bit_reverse[i] = r;
+        }
+        configure();
+    }
+
+    /* Prototype low-pass is a Blackman windowed sinc, cutoff given relative to
+     * the channel spacing (0.5 puts -6dB on the channel edge). Unity DC gain.
+     */
+    void configure(const float cutoff = 0.5f) {
+        float sum = 0.0f;
+        for (size_t n = 0; n < taps_count; n++) {
+            const float t = static_cast<float>(n) - (taps_count - 1) * 0.5f;
+            const float x = 2.0f * cutoff * t / M;
+            const float sinc = (x == 0.0f) ? 1.0f : std::sin(pi * x) / (pi * x);
+            const float r = static_cast<float>(n) / (taps_count - 1);
+            const float window = 0.42f - 0.5f * std::cos(2.0f * pi * r) + 0.08f * std::cos(4.0f * pi * r);
+            taps[n] = sinc * window;
+            sum += taps[n];
+        }
+        for (auto& tap : taps) {
+            tap /= sum;
+        }
+
+        history.fill({0.0f, 0.0f});
+        history_index = 0;
+        phase = 0;
+    }
+
+    /* Calls handler(const output_t&) once per M input samples. */
+    template <typename ChannelsHandler>
+    void execute(const buffer_c16_t& src, ChannelsHandler handler) {
+        for (size_t i = 0; i < src.count; i++) {
+            const std::complex<float> sample{
+                static_cast<float>(src.p[i].real()),
+                static_cast<float>(src.p[i].imag())};
+
+            /* Every sample is stored twice so the newest taps_count samples
+             * are always contiguous and end at history_index + taps_count.
+             */
+            history[history_index] = sample;
+            history[history_index + taps_count] = sample;
+            history_index = (history_index + 1) % taps_count;
+
+            if (++phase == M) {
+                phase = 0;
+                compute_outputs();
+                handler(channels);
+            }
+        }
+    }
+
+    const output_t& outputs() const {
+        return channels;
+    }
+
+   private:
+    std::array<float, taps_count> taps{};
+    std::array<std::complex<float>, taps_count * 2> history{};
+    output_t spectrum{};
+    output_t channels{};
+    std::array<uint8_t, M> bit_reverse{};
+    size_t history_index{0};
+    size_t phase{0};
+
+    void compute_outputs() {
+        /* newest sample */
+        const std::complex<float>* const x = &history[history_index + taps_count - 1];
+
+        for (size_t k = 0; k < M; k++) {
+            std::complex<float> acc{0.0f, 0.0f};
+            for (size_t p = 0; p < P; p++) {
+                const size_t j = p * M + k;
+                acc += taps[j] * x[-static_cast<ptrdiff_t>(j)];
+            }
+            spectrum[bit_reverse[k]] = acc;
+        }
+
+        fft_c_preswapped(spectrum, 0, log_2(M));
+
+        /* Branch sum needs exp(+j..), the FFT computes exp(-j..): mirror bins. */
+        for (size_t c = 0; c < M; c++) {
+            channels[c] = spectrum[(M - c) & (M - 1)];
+        }
+    }
+};
+
+} /* namespace channelize */
+} /* namespace dsp */
+
+#endif /*__DSP_CHANNELIZER_H__*/
@@ -0,0 +1,239 @@
+/*
+ * Copyright (C) 2026
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "dsp_coded_squelch.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace dsp {
+
+namespace {
+
+/* Standard CTCSS tones, 0.01 Hz */
+constexpr std::array<uint16_t, CodedSquelchDetector::tone_count> ctcss_tones{
+    6700, 6930, 7190, 7440, 7700, 7970, 8250, 8540, 8850, 9150,
+    9480, 9740, 10000, 10350, 10720, 11090, 11480, 11880, 12300, 12730,
+    13180, 13650, 14130, 14620, 15140, 15670, 15980, 16220, 16550, 16790,
+    17130, 17380, 17730, 17990, 18350, 18620, 18990, 19280, 19660, 19950,
+    20350, 20650, 21070, 21810, 22570, 22910, 23360, 24180, 25030, 25410};
+
+/* Standard DCS codes, written in octal */
+constexpr std::array<uint16_t, 104> dcs_codes{
+    0023, 0025, 0026, 0031, 0032, 0036, 0043, 0047, 0051, 0053, 0054, 0065, 0071,
+    0072, 0073, 0074, 0114, 0115, 0116, 0122, 0125, 0131, 0132, 0134, 0143, 0145,
+    0152, 0155, 0156, 0162, 0165, 0172, 0174, 0205, 0212, 0223, 0225, 0226, 0243,
+    0244, 0245, 0246, 0251, 0252, 0255, 0261, 0263, 0265, 0266, 0271, 0274, 0306,
+    0311, 0315, 0325, 0331, 0332, 0343, 0346, 0351, 0356, 0364, 0365, 0371, 0411,
+    0412, 0413, 0423, 0431, 0432, 0445, 0446, 0452, 0454, 0455, 0462, 0464, 0465,
+    0466, 0503, 0506, 0516, 0523, 0526, 0532, 0546, 0565, 0606, 0612, 0624, 0627,
+    0631, 0632, 0654, 0662, 0664, 0703, 0712, 0723, 0731, 0732, 0734, 0743, 0754};
+
+constexpr uint32_t dcs_generator = 0xC75;  // x^11 + x^10 + x^6 + x^5 + x^4 + x^2 + 1
+constexpr uint32_t dcs_word_mask = (1U << 23) - 1;
+constexpr float dcs_bit_rate = 134.4f;
+
+constexpr uint32_t rotate_word(const uint32_t word, const size_t r) {
+    return ((word >> r) | (word << (23 - r))) & dcs_word_mask;
+}
+
+} /* namespace */
+
+CodedSquelchDetector::CodedSquelchDetector() {
+    for (size_t i = 0; i < tone_count; i++) {
+        coefficients[i] = 2.0f * std::cos(2.0f * pi * (ctcss_tones[i] / 100.0f) / rate);
+    }
+    reset();
+}
+
+void CodedSquelchDetector::reset() {
+    banks = {};
+    stagger = window / 2;
+    decim_acc = 0;
+    decim_count = 0;
+    dc_x = 0.0f;
+    dc_y = 0.0f;
+    dcs_phase = 0.0f;
+    dcs_last_level = false;
+    dcs_register = 0;
+    dcs_valid_bits = 0;
+    ctcss_pending = false;
+    dcs_pending = false;
+}
+
+void CodedSquelchDetector::execute(const buffer_s16_t& src) {
+    for (size_t i = 0; i < src.count; i++) {
+        /* 12 kHz -> 2 kHz, the input is already band limited well below 1 kHz. */
+        decim_acc += src.p[i];
+        if (++decim_count == decimation) {
+            const float x = decim_acc * (1.0f / (32768.0f * decimation));
+            decim_acc = 0;
+            decim_count = 0;
+
+            /* DC block, carrier offset shows up as DC after the discriminator. */
+            dc_y = x - dc_x + 0.995f * dc_y;
+            dc_x = x;
+
+            feed(dc_y);
+            feed_dcs(dc_y);
+        }
+    }
+}
+
+bool CodedSquelchDetector::pop(Result& result) {
+    if (dcs_pending) {
+        dcs_pending = false;
+        result = dcs_result;
+        return true;
+    }
+    if (ctcss_pending) {
+        ctcss_pending = false;
+        result = ctcss_result;
+        return true;
+    }
+    return false;
+}
+
+void CodedSquelchDetector::feed(const float sample) {
+    for (size_t b = 0; b < banks.size(); b++) {
+        if ((b == 1) && stagger) {
+            stagger--;
+            continue;
+        }
+
+        auto& bank = banks[b];
+        for (size_t i = 0; i < tone_count; i++) {
+            const float s0 = sample + coefficients[i] * bank.s1[i] - bank.s2[i];
+            bank.s2[i] = bank.s1[i];
+            bank.s1[i] = s0;
+        }
+        bank.energy += sample * sample;
+
+        if (++bank.samples == window) {
+            evaluate(bank);
+            bank = {};
+        }
+    }
+}
+
+void CodedSquelchDetector::evaluate(Bank& bank) {
+    const float signal_power = bank.energy / window;
+    if (signal_power < ctcss_min_power) return;
+
+    size_t best = 0;
+    float best_power = 0.0f;
+    for (size_t i = 0; i < tone_count; i++) {
+        const float power = bank.s1[i] * bank.s1[i] + bank.s2[i] * bank.s2[i] - coefficients[i] * bank.s1[i] * bank.s2[i];
+        if (power > best_power) {
+            best_power = power;
+            best = i;
+        }
+    }
+
+    /* A tone of amplitude A gives |X|^2 = (A * N / 2)^2, i.e. mean square 2 |X|^2 / N^2. */
+    const float tone_power = 2.0f * best_power / (static_cast<float>(window) * window);
+    const float confidence = tone_power / signal_power;
+    if (confidence < ctcss_min_confidence) return;
+
+    ctcss_result.type = Result::Type::CTCSS;
+    ctcss_result.value = ctcss_tones[best];
+    ctcss_result.inverted = false;
+    ctcss_result.confidence = std::min(confidence, 1.0f) * 100;
+    ctcss_pending = true;
+}
+
+void CodedSquelchDetector::feed_dcs(const float sample) {
+    const bool level = sample > 0.0f;
+    const float previous_phase = dcs_phase;
+
+    dcs_phase += dcs_bit_rate / rate;
+
+    if (level != dcs_last_level) {
+        /* Transitions belong on bit boundaries (phase 0), pull the clock toward them. */
+        const float error = (dcs_phase < 0.5f) ? -dcs_phase : (1.0f - dcs_phase);
+        dcs_phase += error * 0.3f;
+        dcs_last_level = level;
+    }
+
+    if ((previous_phase < 0.5f) && (dcs_phase >= 0.5f)) {
+        /* Bits arrive LSB first; after 23 bits an aligned word reads as-is. */
+        dcs_register = (dcs_register >> 1) | (static_cast<uint32_t>(level) << 22);
+        check_dcs();
+    }
+
+    if (dcs_phase >= 1.0f) dcs_phase -= 1.0f;
+    if (dcs_phase < 0.0f) dcs_phase += 1.0f;
+}
+
+void CodedSquelchDetector::check_dcs() {
+    if (!dcs_is_codeword(dcs_register)) {
+        dcs_valid_bits = 0;
+        return;
+    }
+
+    /* A random register passes the syndrome check 1 in 2048 times, wait for a few in a row. */
+    dcs_valid_bits++;
+    if ((dcs_valid_bits % dcs_word_bits) == dcs_min_valid_bits) decode_dcs();
+}
+
+void CodedSquelchDetector::decode_dcs() {
+    /* The register holds a complete (rotated) codeword. Several rotations and
+     * polarities can decode to standard codes (DCS aliases): prefer normal
+     * polarity, then the lowest code.
+     */
+    bool found = false;
+    for (const bool inverted : {false, true}) {
+        const uint32_t word = inverted ? (~dcs_register & dcs_word_mask) : dcs_register;
+        for (size_t r = 0; r < dcs_word_bits; r++) {
+            const uint32_t rotated = rotate_word(word, r);
+            if (((rotated >> 9) & 0b111) != 0b100) continue;
+
+            const uint32_t code = rotated & 0x1FF;
+            if (!dcs_is_standard_code(code)) continue;
+
+            if (!found || (code < dcs_result.value)) {
+                dcs_result.value = code;
+                found = true;
+            }
+        }
+        if (found) {
+            dcs_result.type = Result::Type::DCS;
+            dcs_result.inverted = inverted;
+            dcs_result.confidence = std::min<uint32_t>(100, (dcs_valid_bits + dcs_word_bits - dcs_min_valid_bits) * 100 / (2 * dcs_word_bits));
+            dcs_pending = true;
+            return;
+        }
+    }
+}
+
+bool CodedSquelchDetector::dcs_is_codeword(const uint32_t word) {
+    uint32_t remainder = word & dcs_word_mask;
+    for (size_t b = 22; b >= 11; b--) {
+        if (remainder & (1U << b)) remainder ^= dcs_generator << (b - 11);
+    }
+    return remainder == 0;
+}
+
+bool CodedSquelchDetector::dcs_is_standard_code(const uint32_t code) {
+    return std::binary_search(dcs_codes.begin(), dcs_codes.end(), code);
+}
+
+} /* namespace dsp */
@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2026
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __DSP_CODED_SQUELCH_H__
+#define __DSP_CODED_SQUELCH_H__
+
+#include "dsp_types.hpp"
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+
+namespace dsp {
+
+/* CTCSS and DCS detector for sub-audio extracted from FM audio.
+ *
+ * Input is 12 kHz audio low-passed below ~600 Hz. It is decimated to 2 kHz
+ * and fed to two Goertzel banks covering all standard CTCSS tones,
+ * staggered by half a window so a result is ready every 75 ms from the
+ * last 150 ms. Confidence is tone power relative to total sub-audio power,
+ * which keeps speech and noise from being mistaken for a tone.
+ *
+ * DCS bits are sliced at 134.4 bps with a simple DPLL, and the last 23
+ * bits are checked as a Golay (23,12) codeword in both polarities. Every
+ * inverted standard code is also some normal code (023I is 047N), which is
+ * what gets reported.
+ */
+class CodedSquelchDetector {
+   public:
+    struct Result {
+        enum class Type : uint8_t {
+            CTCSS,
+            DCS,
+        };
+        Type type{Type::CTCSS};
+        /* CTCSS: tone frequency in 0.01 Hz. DCS: 9 bit code (3 octal digits). */
+        uint32_t value{0};
+        bool inverted{false};
+        uint8_t confidence{0};
+    };
+
+    static constexpr uint32_t input_rate = 12000;
+    static constexpr uint32_t rate = 2000;
+    static constexpr size_t window = 300;  // 150 ms at 2 kHz
+    static constexpr size_t tone_count = 50;
+
+    CodedSquelchDetector();
+
+    void reset();
+    void execute(const buffer_s16_t& src);
+
+    /* Returns true and fills result while detections are pending. */
+    bool pop(Result& result);
+
+    static bool dcs_is_codeword(const uint32_t word);
+    static bool dcs_is_standard_code(const uint32_t code);
+
+   private:
+    static constexpr size_t decimation = input_rate / rate;
+    static constexpr float ctcss_min_confidence = 0.4f;
+    static constexpr float ctcss_min_power = 1e-6f;
+    static constexpr size_t dcs_word_bits = 23;
+    static constexpr size_t dcs_min_valid_bits = 4;
+
+    struct Bank {
+        std::array<float, tone_count> s1{};
+        std::array<float, tone_count> s2{};
+        float energy{0.0f};
+        size_t samples{0};
+    };
+
+    std::array<float, tone_count> coefficients{};
+    std::array<Bank, 2> banks{};
+    size_t stagger{0};
+
+    int32_t decim_acc{0};
+    size_t decim_count{0};
+    float dc_x{0.0f};
+    float dc_y{0.0f};
+
+    float dcs_phase{0.0f};
+    bool dcs_last_level{false};
+    uint32_t dcs_register{0};
+    uint32_t dcs_valid_bits{0};
+
+    Result ctcss_result{};
+    Result dcs_result{};
+    bool ctcss_pending{false};
+    bool dcs_pending{false};
+
+    void feed(const float sample);
+    void evaluate(Bank& bank);
+    void feed_dcs(const float sample);
+    void check_dcs();
+    void decode_dcs();
+};
+
+} /* namespace dsp */
+
+#endif /*__DSP_CODED_SQUELCH_H__*/
@@ -0,0 +1,214 @@
+/*
+ * Copyright (C) 2026
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "dsp_interpolate.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#if defined(__arm__)
+#include <hal.h>
+#endif
+
+namespace dsp {
+namespace interpolate {
+
+namespace {
+
+constexpr float kaiser_beta = 5.0f;  // ~55 dB stopband
+
+/* Zeroth order modified Bessel function of the first kind. */
+float bessel_i0(const float x) {
+    float sum = 1.0f;
+    float term = 1.0f;
+    for (size_t k = 1; k < 20; k++) {
+        term *= (x / (2.0f * k)) * (x / (2.0f * k));
+        sum += term;
+    }
+    return sum;
+}
+
+int8_t saturate_c8(const int32_t v) {
+    return std::clamp<int32_t>(v, -128, 127);
+}
+
+uint32_t load_word(const void* p) {
+    uint32_t w;
+    memcpy(&w, p, sizeof(w));
+    return w;
+}
+
+/* Dual 16 bit helpers: the M4 SIMD instructions, portable versions on host builds. */
+#if defined(__arm__)
+uint32_t pack_low_halves(const uint32_t a, const uint32_t b) {
+    return __PKHBT(a, b, 16);  // b[15:0]:a[15:0]
+}
+
+uint32_t pack_high_halves(const uint32_t a, const uint32_t b) {
+    return __PKHTB(b, a, 16);  // b[31:16]:a[31:16]
+}
+
+int32_t mac2(const uint32_t x, const uint32_t y, const int32_t acc) {
+    return __SMLAD(x, y, acc);
+}
+#else
+uint32_t pack_low_halves(const uint32_t a, const uint32_t b) {
+    return (b << 16) | (a & 0xFFFF);
+}
+
+uint32_t pack_high_halves(const uint32_t a, const uint32_t b) {
+    return (b & 0xFFFF0000) | (a >> 16);
+}
+
+int32_t mac2(const uint32_t x, const uint32_t y, const int32_t acc) {
+    return acc + (int16_t)x * (int16_t)y + (int16_t)(x >> 16) * (int16_t)(y >> 16);
+}
+#endif
+
+/* Each input sample's window is split into I and Q pairs once, then reused
+ * by every phase: Taps / 2 SMLADs per rail per output sample. */
+template <size_t Taps>
+void filter_phases(const complex16_t* history, const int16_t* taps, const size_t count, const size_t factor, complex8_t* out) {
+    constexpr size_t pairs = Taps / 2;
+
+    for (size_t m = 0; m < count; m++) {
+        std::array<uint32_t, pairs> x_i;
+        std::array<uint32_t, pairs> x_q;
+        for (size_t j = 0; j < pairs; j++) {
+            const uint32_t w0 = load_word(&history[m + 2 * j]);
+            const uint32_t w1 = load_word(&history[m + 2 * j + 1]);
+            x_i[j] = pack_low_halves(w0, w1);
+            x_q[j] = pack_high_halves(w0, w1);
+        }
+
+        const int16_t* phase_taps = taps;
+        for (size_t phase = 0; phase < factor; phase++) {
+            int32_t acc_i = 0;
+            int32_t acc_q = 0;
+            for (size_t j = 0; j < pairs; j++) {
+                const uint32_t t = load_word(&phase_taps[2 * j]);
+                acc_i = mac2(t, x_i[j], acc_i);
+                acc_q = mac2(t, x_q[j], acc_q);
+            }
+            phase_taps += Taps;
+
+            /* Q14 taps, C16 to C8: 14 + 8 bits, rounded. */
+            *(out++) = {saturate_c8((acc_i + (1 << 21)) >> 22), saturate_c8((acc_q + (1 << 21)) >> 22)};
+        }
+    }
+}
+
+} /* namespace */
+
+void PolyphaseInterpolatorC8::configure(const size_t factor, const size_t taps_per_phase) {
+    factor_ = std::clamp<size_t>(factor, 1, factor_max);
+    taps_per_phase_ = (factor_ == 1) ? 1 : std::clamp<size_t>(taps_per_phase, 1, taps_per_phase_max);
+    // Powers of two only, so the filter runs in whole SMLAD pairs (1 is a zero-order hold).
+    while (taps_per_phase_ & (taps_per_phase_ - 1))
+        taps_per_phase_ &= taps_per_phase_ - 1;
+    history.fill({0, 0});
+
+    const size_t length = factor_ * taps_per_phase_;
+    const float center = (length - 1) / 2.0f;
+    const float i0_beta = bessel_i0(kaiser_beta);
+
+    for (size_t phase = 0; phase < factor_; phase++) {
+        std::array<float, taps_per_phase_max> h{};
+        float sum = 0.0f;
+
+        for (size_t k = 0; k < taps_per_phase_; k++) {
+            const size_t n = k * factor_ + phase;
+            const float t = (n - center) / factor_;
+            const float sinc = (t == 0.0f) ? 1.0f : std::sin(pi * t) / (pi * t);
+            const float r = (length > 1) ? (2.0f * n / (length - 1) - 1.0f) : 0.0f;
+            const float window = bessel_i0(kaiser_beta * std::sqrt(std::max(0.0f, 1.0f - r * r))) / i0_beta;
+            h[k] = sinc * window;
+            sum += h[k];
+        }
+
+        for (size_t k = 0; k < taps_per_phase_; k++) {
+            /* Output n = m * factor + phase is sum over k of h[k * factor + phase] * x[m - k]. */
+            taps[phase * taps_per_phase_ + (taps_per_phase_ - 1 - k)] = std::lround(h[k] / sum * 16384.0f);
+        }
+    }
+}
+
+void PolyphaseInterpolatorC8::execute(const buffer_c8_t& src, const buffer_c8_t& dst) {
+    const size_t count = std::min(src.count, input_block_max);
+    auto in = &history[taps_per_phase_ - 1];
+    for (size_t i = 0; i < count; i++) {
+        in[i] = {(int16_t)(src.p[i].real() * 256), (int16_t)(src.p[i].imag() * 256)};
+    }
+    last_sampling_rate = src.sampling_rate;
+    filter(count, dst);
+}
+
+void PolyphaseInterpolatorC8::execute(const buffer_c16_t& src, const buffer_c8_t& dst) {
+    const size_t count = std::min(src.count, input_block_max);
+    std::copy(src.p, src.p + count, &history[taps_per_phase_ - 1]);
+    last_sampling_rate = src.sampling_rate;
+    filter(count, dst);
+}
+
+buffer_c16_t PolyphaseInterpolatorC8::last_input() const {
+    return {const_cast<complex16_t*>(&history[taps_per_phase_ - 1]), last_count, last_sampling_rate};
+}
+
+void PolyphaseInterpolatorC8::filter(const size_t count, const buffer_c8_t& dst) {
+    const size_t n_taps = taps_per_phase_;
+    auto out = dst.p;
+
+    if (factor_ == 1) {
+        for (size_t i = 0; i < count; i++) {
+            // Round toward zero like file_convert::c16_to_c8, so noise around zero doesn't become -1.
+            *(out++) = {(int8_t)(history[i].real() / 256), (int8_t)(history[i].imag() / 256)};
+        }
+    } else {
+        switch (n_taps) {
+            case 8:
+                filter_phases<8>(history.data(), taps.data(), count, factor_, out);
+                break;
+            case 4:
+                filter_phases<4>(history.data(), taps.data(), count, factor_, out);
+                break;
+            case 2:
+                filter_phases<2>(history.data(), taps.data(), count, factor_, out);
+                break;
+            default:
+                // Zero-order hold, every phase's single tap is unity.
+                for (size_t m = 0; m < count; m++) {
+                    const complex8_t v{saturate_c8((history[m].real() + 128) >> 8), saturate_c8((history[m].imag() + 128) >> 8)};
+                    for (size_t phase = 0; phase < factor_; phase++)
+                        *(out++) = v;
+                }
+                break;
+        }
+    }
+
+    last_count = count;
+
+    // Keep the newest samples as history for the next block.
+    std::copy(&history[count], &history[count + n_taps - 1], &history[0]);
+}
+
+} /* namespace interpolate */
+} /* namespace dsp */
@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2026
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __DSP_INTERPOLATE_H__
+#define __DSP_INTERPOLATE_H__
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+
+#include "dsp_types.hpp"
+
+namespace dsp {
+namespace interpolate {
+
+/* Polyphase FIR interpolator, complex in, C8 out.
+ *
+ * The prototype is a Kaiser windowed sinc of factor * taps_per_phase taps,
+ * cut off at half the input rate, split into `factor` phases so each
+ * output sample costs taps_per_phase MACs per rail. Each phase is normalised
+ * to unity DC gain. A factor of 1 is a plain copy. taps_per_phase is
+ * rounded down to 1, 2, 4 or 8; 1 is a zero-order hold.
+ *
+ * C16 input is scaled down to C8 as part of the filter (divide by 256).
+ */
+class PolyphaseInterpolatorC8 {
+   public:
+    static constexpr size_t taps_per_phase_max = 8;
+    static constexpr size_t factor_max = 64;
+    static constexpr size_t input_block_max = 512;
+
+    void configure(const size_t factor, const size_t taps_per_phase);
+
+    size_t factor() const { return factor_; }
+    size_t taps_per_phase() const { return taps_per_phase_; }
+
+    /* Writes src.count * factor() samples to dst. */
+    void execute(const buffer_c8_t& src, const buffer_c8_t& dst);
+    void execute(const buffer_c16_t& src, const buffer_c8_t& dst);
+
+    /* The last block of input as C16, e.g. for spectrum display. */
+    buffer_c16_t last_input() const;
+
+   private:
+    size_t factor_{1};
+    size_t taps_per_phase_{1};
+    size_t last_count{0};
+    uint32_t last_sampling_rate{0};
+
+    /* Q14, phase major, each phase reversed so it runs over history oldest first. */
+    alignas(4) std::array<int16_t, factor_max * taps_per_phase_max> taps{};
+
+    /* taps_per_phase - 1 samples of history followed by the current block. */
+    std::array<complex16_t, taps_per_phase_max - 1 + input_block_max> history{};
+
+    void filter(const size_t count, const buffer_c8_t& dst);
+};
+
+} /* namespace interpolate */
+} /* namespace dsp */
+
+#endif /*__DSP_INTERPOLATE_H__*/
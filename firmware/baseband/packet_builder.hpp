@@ -24,8 +24,9 @@
 
 #include <cstdint>
 #include <cstddef>
+#include <algorithm>
 #include <bitset>
-#include <functional>
+#include <type_traits>
 
 #include "bit_pattern.hpp"
 #include "baseband_packet.hpp"
@@ -44,17 +45,27 @@ struct FixedLength {
     const size_t length;
 };
 
-template <typename PreambleMatcher, typename UnstuffMatcher, typename EndMatcher>
+/* Forwards completed packets to Owner::Method. The target is part of the
+ * type, so the call inlines instead of going through a std::function.
+ */
+template <typename Owner, void (Owner::*Method)(const baseband::Packet&)>
+struct PacketHandler {
+    Owner* const owner;
+
+    void operator()(const baseband::Packet& packet) const {
+        (owner->*Method)(packet);
+    }
+};
+
+template <typename PreambleMatcher, typename UnstuffMatcher, typename EndMatcher, typename PayloadHandler>
 class PacketBuilder {
    public:
-    using PayloadHandlerFunc = std::function<void(const baseband::Packet& packet)>;
-
     PacketBuilder(
         const PreambleMatcher preamble_matcher,
         const UnstuffMatcher unstuff_matcher,
         const EndMatcher end_matcher,
-        PayloadHandlerFunc payload_handler)
-        : payload_handler{std::move(payload_handler)},
+        const PayloadHandler payload_handler)
+        : payload_handler{payload_handler},
           preamble(preamble_matcher),
           unstuff(unstuff_matcher),
           end(end_matcher) {
@@ -86,14 +97,7 @@ class PacketBuilder {
                 }
 
                 if (end(bit_history, packet.size())) {
-                    // NOTE: This check is to avoid std::function nullptr check, which
-                    // brings in "_ZSt25__throw_bad_function_callv" and a lot of extra code.
-                    // TODO: Make payload_handler known at compile time.
-                    if (payload_handler) {
-                        packet.set_timestamp(Timestamp::now());
-                        payload_handler(packet);
-                    }
-                    reset_state();
+                    deliver();
                 } else {
                     if (packet_truncated()) {
                         reset_state();
@@ -107,6 +111,43 @@ class PacketBuilder {
         }
     }
 
+    /* Batched entry point, one bit per byte. The preamble search runs as a
+     * tight loop over the shift register, and fixed length payloads without
+     * unstuffing are copied in a single pass.
+     */
+    void execute(
+        const uint8_t* const symbols,
+        const size_t count) {
+        size_t i = 0;
+        while (i < count) {
+            if (state == State::Preamble) {
+                while (i < count) {
+                    bit_history.add(symbols[i++]);
+                    if (preamble(bit_history, packet.size())) {
+                        state = State::Payload;
+                        break;
+                    }
+                }
+            } else if constexpr (std::is_same<UnstuffMatcher, NeverMatch>::value && std::is_same<EndMatcher, FixedLength>::value) {
+                const size_t wanted = std::min(end.length, packet.capacity()) - packet.size();
+                const size_t n = std::min(wanted, count - i);
+                for (size_t j = 0; j < n; j++) {
+                    bit_history.add(symbols[i + j]);
+                    packet.add(symbols[i + j]);
+                }
+                i += n;
+
+                if (packet.size() >= end.length) {
+                    deliver();
+                } else if (packet_truncated()) {
+                    reset_state();
+                }
+            } else {
+                execute(symbols[i++]);
+            }
+        }
+    }
+
    private:
     enum State {
         Preamble,
@@ -117,7 +158,7 @@ class PacketBuilder {
         return packet.size() >= packet.capacity();
     }
 
-    const PayloadHandlerFunc payload_handler;
+    const PayloadHandler payload_handler;
 
     BitHistory bit_history{};
     PreambleMatcher preamble{};
@@ -127,6 +168,12 @@ class PacketBuilder {
     State state{State::Preamble};
     baseband::Packet packet{};
 
+    void deliver() {
+        packet.set_timestamp(Timestamp::now());
+        payload_handler(packet);
+        reset_state();
+    }
+
     void reset_state() {
         packet.clear();
         state = State::Preamble;
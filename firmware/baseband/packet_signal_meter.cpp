@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2026
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "packet_signal_meter.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+/* ~10 dB per second with 2 ms slots. */
+constexpr float noise_floor_rise = 1.0046f;
+constexpr float noise_floor_min = 1e-12f;
+constexpr float full_scale_squared = 32768.0f * 32768.0f;
+
+int8_t to_db(const float ratio) {
+    if (ratio <= 0.0f)
+        return -127;
+    const float db = std::round(10.0f * std::log10(ratio));
+    return static_cast<int8_t>(std::clamp(db, -127.0f, 127.0f));
+}
+
+} /* namespace */
+
+void PacketSignalMeter::configure(const uint32_t new_sampling_rate) {
+    if (new_sampling_rate == sampling_rate)
+        return;
+
+    sampling_rate = new_sampling_rate;
+    slot_samples = std::max<size_t>(sampling_rate / slots_per_second, 1);
+    current = {};
+    head = 0;
+    filled = 0;
+    noise_floor = 0.0f;
+}
+
+void PacketSignalMeter::feed(const buffer_c16_t& channel) {
+    configure(channel.sampling_rate);
+    has_rotation = true;
+
+    int32_t last_re = last.real();
+    int32_t last_im = last.imag();
+    size_t i = 0;
+
+    while (i < channel.count) {
+        const size_t n = std::min(channel.count - i, slot_samples - current.count);
+        int64_t power = 0;
+        int64_t rotation_re = 0;
+        int64_t rotation_im = 0;
+
+        /* s[n] * conj(s[n - 1]) summed over the slot points at the mean
+         * phase advance per sample, i.e. the carrier offset. */
+        for (const auto end = i + n; i < end; i++) {
+            const int32_t re = channel.p[i].real();
+            const int32_t im = channel.p[i].imag();
+            power += static_cast<int64_t>(re * re) + im * im;
+            rotation_re += static_cast<int64_t>(re * last_re) + im * last_im;
+            rotation_im += static_cast<int64_t>(im * last_re) - re * last_im;
+            last_re = re;
+            last_im = im;
+        }
+
+        current.power += power * (1.0f / full_scale_squared);
+        current.rotation_re += rotation_re * (1.0f / full_scale_squared);
+        current.rotation_im += rotation_im * (1.0f / full_scale_squared);
+        current.count += n;
+        if (current.count >= slot_samples)
+            commit_slot();
+    }
+
+    last = {static_cast<int16_t>(last_re), static_cast<int16_t>(last_im)};
+}
+
+void PacketSignalMeter::feed_power(const float power_sum, const size_t count, const uint32_t sampling_rate) {
+    configure(sampling_rate);
+    has_rotation = false;
+
+    const float mean = (count > 0) ? power_sum / count : 0.0f;
+    size_t remaining = count;
+    while (remaining > 0) {
+        const size_t n = std::min(remaining, slot_samples - current.count);
+        current.power += mean * n;
+        current.count += n;
+        remaining -= n;
+        if (current.count >= slot_samples)
+            commit_slot();
+    }
+}
+
+void PacketSignalMeter::commit_slot() {
+    slots[head] = current;
+    head = (head + 1) % slot_count;
+    filled = std::min(filled + 1, slot_count);
+
+    const float mean = std::max(current.power / current.count, noise_floor_min);
+    if ((noise_floor == 0.0f) || (mean < noise_floor))
+        noise_floor = mean;
+    else
+        noise_floor *= noise_floor_rise;
+
+    current = {};
+}
+
+PacketMetadata PacketSignalMeter::measure(
+    const size_t frame_samples,
+    const uint64_t sample_index,
+    const size_t samples_after_frame) const {
+    PacketMetadata metadata{};
+    metadata.sample_index = sample_index;
+
+    size_t skipped = current.count;
+    Slot total = (samples_after_frame < skipped) ? current : Slot{};
+    size_t index = head;
+    for (size_t n = 0; (n < filled) && (total.count < frame_samples); n++) {
+        index = (index + slot_count - 1) % slot_count;
+        if (skipped < samples_after_frame) {
+            skipped += slots[index].count;
+            if (skipped <= samples_after_frame)
+                continue;
+        }
+        total.power += slots[index].power;
+        total.rotation_re += slots[index].rotation_re;
+        total.rotation_im += slots[index].rotation_im;
+        total.count += slots[index].count;
+    }
+
+    if (total.count == 0)
+        return metadata;
+
+    const float mean = total.power / total.count;
+    metadata.rssi = to_db(mean);
+    if (noise_floor > 0.0f)
+        metadata.snr = to_db(mean / noise_floor);
+
+    if (has_rotation && ((total.rotation_re != 0.0f) || (total.rotation_im != 0.0f))) {
+        const float phase = std::atan2(total.rotation_im, total.rotation_re);
+        metadata.frequency_offset = std::lround(phase * sampling_rate * (1.0f / (2.0f * pi)));
+    }
+
+    return metadata;
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2026
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __PACKET_SIGNAL_METER_H__
+#define __PACKET_SIGNAL_METER_H__
+
+#include "dsp_types.hpp"
+#include "packet_metadata.hpp"
+
+#include <array>
+#include <cstdint>
+#include <cstddef>
+
+/* Keeps the last 64 ms of channel power and phase rotation in 2 ms slots
+ * so a decoder can report RSSI, SNR and frequency offset for a frame when
+ * it completes. Frames longer than the history are measured over their
+ * end. The noise floor follows the quietest slots, rising by about 10 dB
+ * per second when the channel gets busier. */
+class PacketSignalMeter {
+   public:
+    static constexpr size_t slot_count = 32;
+    static constexpr uint32_t slots_per_second = 500;
+
+    /* Complex channel samples; also measures frequency offset. */
+    void feed(const buffer_c16_t& channel);
+
+    /* For decoders that only have magnitudes: power_sum is the sum of
+     * |s|^2 over count samples, normalized to full scale. */
+    void feed_power(const float power_sum, const size_t count, const uint32_t sampling_rate);
+
+    /* Measures a frame of frame_samples channel samples that ended
+     * samples_after_frame samples ago, to slot resolution. sample_index is
+     * passed through to the result. */
+    PacketMetadata measure(
+        const size_t frame_samples,
+        const uint64_t sample_index,
+        const size_t samples_after_frame = 0) const;
+
+   private:
+    struct Slot {
+        float power{0.0f};
+        float rotation_re{0.0f};
+        float rotation_im{0.0f};
+        uint32_t count{0};
+    };
+
+    std::array<Slot, slot_count> slots{};
+    Slot current{};
+    size_t head{0};
+    size_t filled{0};
+    size_t slot_samples{1};
+    uint32_t sampling_rate{0};
+    complex16_t last{0, 0};
+    float noise_floor{0.0f};
+    bool has_rotation{false};
+
+    void configure(const uint32_t new_sampling_rate);
+    void commit_slot();
+};
+
+#endif /*__PACKET_SIGNAL_METER_H__*/
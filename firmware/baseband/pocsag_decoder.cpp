@@ -0,0 +1,297 @@
+/*
+ * Copyright (C) 1996 Thomas Sailer (sailer@ife.ee.ethz.ch, hb9jnx@hb9w.che.eu)
+ * Copyright (C) 2012-2014 Elias Oenal (multimon-ng@eliasoenal.com)
+ * Copyright (C) 2015 Jared Boone, ShareBrained Technology, Inc.
+ * Copyright (C) 2016 Furrtek
+ * Copyright (C) 2023 Kyle Reed
+ * Copyright (C) 2026
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "pocsag_decoder.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+
+namespace {
+/* Count of bits that differ between the two values. */
+uint8_t diff_bit_count(uint32_t left, uint32_t right) {
+    return __builtin_popcount(left ^ right);
+}
+
+/* True if value matches pattern, or its inverse, within max_errors bits. */
+bool correlates(uint32_t value, uint32_t pattern, uint8_t max_errors) {
+    const auto errors = diff_bit_count(value, pattern);
+    return errors <= max_errors || errors >= 32 - max_errors;
+}
+}  // namespace
+
+/* AudioNormalizer ***************************************/
+
+void AudioNormalizer::execute_in_place(const buffer_f32_t& audio) {
+    // Decay min/max every second (@24kHz).
+    if (counter_ >= 24'000) {
+        // 90% decay factor seems to work well.
+        // This keeps large transients from wrecking the filter.
+        max_ *= 0.9f;
+        min_ *= 0.9f;
+        counter_ = 0;
+        calculate_thresholds();
+    }
+
+    counter_ += audio.count;
+
+    for (size_t i = 0; i < audio.count; ++i) {
+        auto& val = audio.p[i];
+
+        if (val > max_) {
+            max_ = val;
+            calculate_thresholds();
+        }
+        if (val < min_) {
+            min_ = val;
+            calculate_thresholds();
+        }
+
+        if (val >= t_hi_)
+            val = 1.0f;
+        else if (val <= t_lo_)
+            val = -1.0f;
+        else
+            val = 0.0;
+    }
+}
+
+void AudioNormalizer::calculate_thresholds() {
+    auto center = (max_ + min_) / 2.0f;
+    auto range = (max_ - min_) / 2.0f;
+
+    // 10% off center force either +/-1.0f.
+    // Higher == larger dead zone.
+    // Lower == more false positives.
+    auto threshold = range * 0.1;
+    t_hi_ = center + threshold;
+    t_lo_ = center - threshold;
+}
+
+/* BitQueue **********************************************/
+
+void BitQueue::push(bool bit) {
+    data_ = (data_ << 1) | (bit ? 1 : 0);
+    if (count_ < max_size_) ++count_;
+}
+
+bool BitQueue::pop() {
+    if (count_ == 0) return false;
+
+    --count_;
+    return ((data_ >> count_) & 1) != 0;
+}
+
+void BitQueue::reset() {
+    data_ = 0;
+    count_ = 0;
+}
+
+uint8_t BitQueue::size() const {
+    return count_;
+}
+
+uint64_t BitQueue::data() const {
+    return data_;
+}
+
+/* BitExtractor ******************************************/
+
+void BitExtractor::extract_bits(const buffer_f32_t& audio) {
+    // Assumes input has been normalized +/- 1.0f.
+    // Positive == 0, Negative == 1.
+    for (size_t i = 0; i < audio.count; ++i) {
+        const auto sample = audio.p[i];
+        const int8_t decision = (sample > 0.0f) - (sample < 0.0f);
+        const bool transition = decision != 0 && decision != last_sign_;
+        if (decision != 0)
+            last_sign_ = decision;
+
+        for (size_t rate = 0; rate < rate_count; ++rate) {
+            if (transition) {
+                // Pull the bit boundary (phase 0) towards the transition.
+                const auto shift = (static_cast<int8_t>(rate) == locked_) ? track_shift : acquire_shift;
+                phase_[rate] -= static_cast<int32_t>(phase_[rate]) >> shift;
+            }
+
+            const auto prev_phase = phase_[rate];
+            phase_[rate] += phase_step_[rate];
+            if (phase_[rate] < prev_phase) {
+                // Bit boundary: dump the integrator.
+                on_bit(rate, integrator_[rate] < 0);
+                integrator_[rate] = 0;
+            }
+            integrator_[rate] += decision;
+        }
+    }
+}
+
+void BitExtractor::configure(uint32_t sample_rate) {
+    for (size_t rate = 0; rate < rate_count; ++rate)
+        phase_step_[rate] = (static_cast<uint64_t>(known_rates_[rate]) << 32) / sample_rate;
+
+    reset();
+}
+
+void BitExtractor::reset() {
+    phase_.fill(0);
+    integrator_.fill(0);
+    history_.fill(0);
+    clock_score_.fill(0);
+    bits_since_sync_.fill(UINT16_MAX);
+    last_sign_ = 0;
+    locked_ = is_fixed_rate() ? baud_config_ : no_rate;
+}
+
+void BitExtractor::set_baud_config(int8_t baud_config) {
+    baud_config_ = baud_config;
+}
+
+uint16_t BitExtractor::baud_rate() const {
+    return (locked_ != no_rate) ? known_rates_[locked_] : 0;
+}
+
+void BitExtractor::on_bit(size_t rate, bool bit) {
+    const auto history = (history_[rate] << 1) | (bit ? 1 : 0);
+    history_[rate] = history;
+
+    if (static_cast<int8_t>(rate) == locked_)
+        bits_.push(bit);
+
+    const bool sync = correlates(history, sync_codeword, sync_max_errors);
+    if (sync)
+        bits_since_sync_[rate] = 0;
+    else if (bits_since_sync_[rate] < UINT16_MAX)
+        ++bits_since_sync_[rate];
+
+    if (correlates(history, clock_magic_number, clock_max_errors)) {
+        if (clock_score_[rate] < clock_score_max)
+            ++clock_score_[rate];
+    } else if (clock_score_[rate] > 0) {
+        --clock_score_[rate];
+    }
+
+    if (is_fixed_rate())
+        return;
+
+    if (locked_ == no_rate) {
+        if (sync || clock_score_[rate] >= clock_lock_score)
+            lock(rate);
+    } else if (sync && static_cast<int8_t>(rate) != locked_ &&
+               bits_since_sync_[locked_] > lock_hold_bits) {
+        lock(rate);
+    }
+}
+
+void BitExtractor::lock(size_t rate) {
+    locked_ = rate;
+    bits_since_sync_[rate] = 0;
+
+    // Replay the bits that won the lock so the sync codeword,
+    // or the end of the preamble, isn't lost.
+    for (size_t i = 32; i > 0; --i)
+        bits_.push((history_[rate] >> (i - 1)) & 1);
+}
+
+bool BitExtractor::is_fixed_rate() const {
+    return baud_config_ >= 0 && baud_config_ < static_cast<int8_t>(rate_count);
+}
+
+/* CodewordExtractor *************************************/
+
+void CodewordExtractor::process_bits() {
+    // Process all of the bits in the bits queue.
+    while (bits_.size() > 0) {
+        take_one_bit();
+
+        // Wait until data_ is full.
+        if (bit_count_ < data_bit_count)
+            continue;
+
+        // Wait for the sync frame.
+        if (!has_sync_) {
+            if (diff_bit_count(data_, sync_codeword) <= 2)
+                handle_sync(/*inverted=*/false);
+            else if (diff_bit_count(data_, ~sync_codeword) <= 2)
+                handle_sync(/*inverted=*/true);
+            continue;
+        }
+
+        save_current_codeword();
+
+        if (word_count_ == pocsag::batch_size)
+            handle_batch_complete();
+    }
+}
+
+void CodewordExtractor::flush() {
+    // Don't bother flushing if there's no pending data.
+    if (word_count_ == 0) return;
+
+    pad_idle();
+    handle_batch_complete();
+}
+
+void CodewordExtractor::reset() {
+    clear_data_bits();
+    has_sync_ = false;
+    inverted_ = false;
+    word_count_ = 0;
+}
+
+void CodewordExtractor::clear_data_bits() {
+    data_ = 0;
+    bit_count_ = 0;
+}
+
+void CodewordExtractor::take_one_bit() {
+    data_ = (data_ << 1) | bits_.pop();
+    if (bit_count_ < data_bit_count)
+        ++bit_count_;
+}
+
+void CodewordExtractor::handle_sync(bool inverted) {
+    clear_data_bits();
+    has_sync_ = true;
+    inverted_ = inverted;
+    word_count_ = 0;
+}
+
+void CodewordExtractor::save_current_codeword() {
+    batch_[word_count_++] = inverted_ ? ~data_ : data_;
+    clear_data_bits();
+}
+
+void CodewordExtractor::handle_batch_complete() {
+    on_batch_(*this);
+    has_sync_ = false;
+    word_count_ = 0;
+}
+
+void CodewordExtractor::pad_idle() {
+    while (word_count_ < pocsag::batch_size)
+        batch_[word_count_++] = idle_codeword;
+}
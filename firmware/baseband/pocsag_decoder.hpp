@@ -0,0 +1,201 @@
+/*
+ * Copyright (C) 1996 Thomas Sailer (sailer@ife.ee.ethz.ch, hb9jnx@hb9w.che.eu)
+ * Copyright (C) 2012-2014 Elias Oenal (multimon-ng@eliasoenal.com)
+ * Copyright (C) 2015 Jared Boone, ShareBrained Technology, Inc.
+ * Copyright (C) 2016 Furrtek
+ * Copyright (C) 2023 Kyle Reed
+ * Copyright (C) 2026
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __POCSAG_DECODER_H__
+#define __POCSAG_DECODER_H__
+
+#include "dsp_types.hpp"
+#include "pocsag_packet.hpp"
+
+#include <array>
+#include <cstdint>
+#include <functional>
+
+/* Normalizes audio stream to +/-1.0f */
+class AudioNormalizer {
+   public:
+    void execute_in_place(const buffer_f32_t& audio);
+
+   private:
+    void calculate_thresholds();
+
+    uint32_t counter_ = 0;
+    float min_ = 99.0f;
+    float max_ = -99.0f;
+    float t_hi_ = 1.0;
+    float t_lo_ = 1.0;
+};
+
+/* FIFO wrapper over a uint64_t's bits. */
+class BitQueue {
+   public:
+    void push(bool bit);
+    bool pop();
+    void reset();
+    uint8_t size() const;
+    uint64_t data() const;
+
+   private:
+    uint64_t data_ = 0;
+    uint8_t count_ = 0;
+
+    static constexpr uint8_t max_size_ = sizeof(data_) * 8;
+};
+
+/* Extracts bits and bitrate from audio stream.
+ * All known rates are decoded in a single pass: the slicer decision is made
+ * once per sample and fed to an integrate-and-dump slicer per rate, each
+ * with its own clock recovery loop. The first rate whose bits correlate
+ * with the sync codeword or a long clock preamble takes the lock, and only
+ * loses it to another rate's sync after going lock_hold_bits without one. */
+class BitExtractor {
+   public:
+    BitExtractor(BitQueue& bits)
+        : bits_{bits} {}
+
+    void extract_bits(const buffer_f32_t& audio);
+    void configure(uint32_t sample_rate);
+    void reset();
+    void set_baud_config(int8_t baud_config);
+    uint16_t baud_rate() const;
+
+   private:
+    static constexpr size_t rate_count = 3;
+    static constexpr std::array<uint16_t, rate_count> known_rates_{512, 1200, 2400};
+    static constexpr int8_t no_rate = -1;
+
+    /* Clock signal detection magic number. */
+    static constexpr uint32_t clock_magic_number = 0xAAAAAAAA;
+    static constexpr uint32_t sync_codeword = 0x7cd215d8;
+
+    /* Max bit errors (of 32) for a correlation match, either polarity. */
+    static constexpr uint8_t sync_max_errors = 2;
+    static constexpr uint8_t clock_max_errors = 3;
+
+    /* Clock matches (net of misses) needed to lock without a sync. */
+    static constexpr uint8_t clock_lock_score = 24;
+    static constexpr uint8_t clock_score_max = 32;
+
+    /* Bits the locked rate may go without a sync before another rate's
+     * sync can take over. Two batches, including sync codewords. */
+    static constexpr uint16_t lock_hold_bits = 2 * 17 * 32;
+
+    /* Clock recovery loop gains, as right shifts of the phase error. */
+    static constexpr uint8_t acquire_shift = 2;
+    static constexpr uint8_t track_shift = 4;
+
+    void on_bit(size_t rate, bool bit);
+    void lock(size_t rate);
+    bool is_fixed_rate() const;
+
+    /* Per-rate state, as a structure of arrays. Phase wraps once per bit. */
+    std::array<uint32_t, rate_count> phase_step_{};
+    std::array<uint32_t, rate_count> phase_{};
+    std::array<int16_t, rate_count> integrator_{};
+    std::array<uint32_t, rate_count> history_{};
+    std::array<uint8_t, rate_count> clock_score_{};
+    std::array<uint16_t, rate_count> bits_since_sync_{};
+
+    BitQueue& bits_;
+    int8_t baud_config_ = -1;
+    int8_t locked_ = no_rate;
+    int8_t last_sign_ = 0;
+};
+
+/* Extracts codeword batches from the BitQueue. */
+class CodewordExtractor {
+   public:
+    using batch_t = pocsag::batch_t;
+    using batch_handler_t = std::function<void(CodewordExtractor&)>;
+
+    CodewordExtractor(BitQueue& bits, batch_handler_t on_batch)
+        : bits_{bits}, on_batch_{on_batch} {}
+
+    /* Process the BitQueue to extract codeword batches. */
+    void process_bits();
+
+    /* Pad then send any pending frames. */
+    void flush();
+
+    /* Completely reset to prepare for a new message. */
+    void reset();
+
+    /* Gets the underlying batch array. */
+    const batch_t& batch() const { return batch_; }
+
+    /* Gets in-progress codeword. */
+    uint32_t current() const { return data_; }
+
+    /* Gets the count of completed codewords. */
+    uint8_t count() const { return word_count_; }
+
+    /* Returns true if the batch has as sync frame. */
+    bool has_sync() const { return has_sync_; }
+
+   private:
+    /* Sync frame codeword. */
+    static constexpr uint32_t sync_codeword = 0x7cd215d8;
+
+    /* Idle codeword used to pad a 16 codeword "batch". */
+    static constexpr uint32_t idle_codeword = 0x7a89c197;
+
+    /* Number of bits in 'data_' member. */
+    static constexpr uint8_t data_bit_count = sizeof(uint32_t) * 8;
+
+    /* Clears data_ and bit_count_ to prepare for next codeword. */
+    void clear_data_bits();
+
+    /* Pop a bit off the queue and add it to data_. */
+    void take_one_bit();
+
+    /* Handles receiving the sync frame codeword, start of batch. */
+    void handle_sync(bool inverted);
+
+    /* Saves the current codeword in data_ to the batch. */
+    void save_current_codeword();
+
+    /* Sends the batch to the handler, resets for next batch. */
+    void handle_batch_complete();
+
+    /* Fill the rest of the batch with 'idle' codewords. */
+    void pad_idle();
+
+    BitQueue& bits_;
+    batch_handler_t on_batch_{};
+
+    /* When true, sync frame has been received. */
+    bool has_sync_ = false;
+
+    /* When true, bit vales are flipped in the codewords. */
+    bool inverted_ = false;
+
+    uint32_t data_ = 0;
+    uint8_t bit_count_ = 0;
+    uint8_t word_count_ = 0;
+    batch_t batch_{};
+};
+
+#endif /*__POCSAG_DECODER_H__*/
@@ -27,6 +27,7 @@
 #include "sine_table_int8.hpp"
 #include "event_m4.hpp"
 #include "audio_dma.hpp"
+#include "utility.hpp"
 
 #include <cstdint>
 #include <cstddef>
@@ -55,7 +56,7 @@ void ADSBRXProcessor::execute(const buffer_c8_t& buffer) {
             // 1 bit == 2 samples, transition defines bit value.
             if ((sample_count & 1) == 1) {
                 if (bit_count >= msg_len) {
-                    const ADSBFrameMessage message(frame, amp);
+                    const ADSBFrameMessage message(frame, amp, frame_metadata(buffer.count - i));
                     shared_memory.application_queue.push(message);
                     decoding = false;
                     bit = (prev_mag > mag) ? 1 : 0;
@@ -127,6 +128,7 @@ void ADSBRXProcessor::execute(const buffer_c8_t& buffer) {
                 {
                     decoding = true;
                     amp = this_amp;
+                    noise = shifter[5] + shifter[6] + shifter[12] + shifter[13] + shifter[14];
                     sample_count = 0;
                     bit_count = 0;
                     frame.clear();
@@ -139,6 +141,20 @@ void ADSBRXProcessor::execute(const buffer_c8_t& buffer) {
     }
 }
 
+PacketMetadata ADSBRXProcessor::frame_metadata(const size_t samples_after_frame) const {
+    /* amp sums the four preamble pulses, noise the five quiet samples
+     * between and after them; both are |s|^2 of 8 bit samples. */
+    constexpr float full_scale_squared = 128.0f * 128.0f;
+    const float pulse_power = amp * (1.0f / 4.0f);
+
+    PacketMetadata metadata{};
+    metadata.sample_index = baseband_thread.sample_index() - samples_after_frame;
+    metadata.rssi = static_cast<int8_t>(mag2_to_dbv_norm(pulse_power / full_scale_squared));
+    if (noise > 0)
+        metadata.snr = static_cast<int8_t>(mag2_to_dbv_norm(pulse_power / (noise * (1.0f / 5.0f))));
+    return metadata;
+}
+
 void ADSBRXProcessor::on_message(const Message* const message) {
     switch (message->id) {
         case Message::ID::ADSBConfigure:
@@ -48,11 +48,13 @@ class ADSBRXProcessor : public BasebandProcessor {
 
     uint32_t prev_mag{0};
     int32_t amp{0};
+    uint32_t noise{0};
     size_t bit_count{0};
     size_t sample_count{0};
 
     uint32_t shifter[ADSB_PREAMBLE_LENGTH + 1];
 
+    PacketMetadata frame_metadata(const size_t samples_after_frame) const;
     void on_beep_message(const AudioBeepMessage& message);
 
     /* NB: Threads should be the last members in the class definition. */
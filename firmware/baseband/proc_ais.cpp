@@ -30,7 +30,6 @@
 
 AISProcessor::AISProcessor() {
     decim_0.configure(taps_11k0_decim_0.taps);
-    decim_1.configure(taps_11k0_decim_1.taps);
     baseband_thread.start();
 }
 
@@ -38,36 +37,106 @@ void AISProcessor::execute(const buffer_c8_t& buffer) {
     /* 2.4576MHz, 2048 samples */
 
     const auto decim_0_out = decim_0.execute(buffer, dst_buffer);
-    const auto decim_1_out = decim_1.execute(decim_0_out, dst_buffer);
-    const auto decimator_out = decim_1_out;
+
+    /* 307.2kHz, 256 samples */
+    const auto sample_index = baseband_thread.sample_index();
+    const auto channel_out = channels[0].execute(decim_0_out, mix_buffer, channel_out_buffer, sample_index);
+
+    /* 38.4kHz, 32 samples. In dual channel mode this is AIS1; read it before AIS2 reuses the buffer. */
+    feed_channel_stats(channel_out);
+
+    if (dual_channel) {
+        channels[1].execute(decim_0_out, mix_buffer, channel_out_buffer, sample_index);
+    }
+}
+
+void AISProcessor::configure(const AISConfigureMessage& message) {
+    dual_channel = message.dual_channel;
+    if (dual_channel) {
+        channels[0].configure(dual_channel_offset, AISPacketMessage::Channel::AIS1);
+        channels[1].configure(-dual_channel_offset, AISPacketMessage::Channel::AIS2);
+    } else {
+        channels[0].configure(0, AISPacketMessage::Channel::Tuned);
+    }
+}
+
+AISProcessor::Channel::Channel() {
+    decim_1.configure(taps_11k0_decim_1.taps);
+}
+
+void AISProcessor::Channel::configure(const int32_t offset_hz, const AISPacketMessage::Channel tag) {
+    /* Multiplying by exp(j*2*pi*offset/fs) moves a channel at -offset to DC. */
+    const float angle = 2.0f * pi * offset_hz / decim_0_output_fs;
+    this->tag = tag;
+    mixing = (offset_hz != 0);
+    phasor = {1.0f, 0.0f};
+    rotation = {std::cos(angle), std::sin(angle)};
+}
+
+buffer_c16_t AISProcessor::Channel::execute(const buffer_c16_t& src, const buffer_c16_t& mix_buffer, const buffer_c16_t& dst_buffer, const uint64_t sample_index) {
+    this->sample_index = sample_index;
+
+    if (mixing) {
+        for (size_t i = 0; i < src.count; i++) {
+            const std::complex<float> s{(float)src.p[i].real(), (float)src.p[i].imag()};
+            const auto m = s * phasor;
+            /* A full scale input can reach 3 dB over int16 at 45 degrees. */
+            mix_buffer.p[i] = {(int16_t)__SSAT((int32_t)m.real(), 16), (int16_t)__SSAT((int32_t)m.imag(), 16)};
+            phasor *= rotation;
+        }
+        /* Keep the recursive oscillator from drifting in amplitude. */
+        phasor /= std::abs(phasor);
+    }
+
+    const buffer_c16_t decim_1_in{mixing ? mix_buffer.p : src.p, src.count, src.sampling_rate};
+    const auto decim_1_out = decim_1.execute(decim_1_in, dst_buffer);
 
     /* 38.4kHz, 32 samples */
-    feed_channel_stats(decimator_out);
+    meter.feed(decim_1_out);
 
-    for (size_t i = 0; i < decimator_out.count; i++) {
-        if (mf.execute_once(decimator_out.p[i])) {
+    for (size_t i = 0; i < decim_1_out.count; i++) {
+        if (mf.execute_once(decim_1_out.p[i])) {
             clock_recovery(mf.get_output());
         }
     }
+
+    packet_builder.execute(symbols.data(), symbols_count);
+    symbols_count = 0;
+
+    return decim_1_out;
 }
 
-void AISProcessor::consume_symbol(
+void AISProcessor::Channel::consume_symbol(
     const float raw_symbol) {
     const uint_fast8_t sliced_symbol = (raw_symbol >= 0.0f) ? 1 : 0;
     const auto decoded_symbol = nrzi_decode(sliced_symbol);
 
-    packet_builder.execute(decoded_symbol);
+    if (symbols_count < symbols.size()) {
+        symbols[symbols_count++] = decoded_symbol;
+    }
 }
 
-void AISProcessor::payload_handler(
+void AISProcessor::Channel::payload_handler(
     const baseband::Packet& packet) {
-    const AISPacketMessage message{packet};
+    /* 4 samples per bit; the preamble and start flag add 24 bits. */
+    const auto metadata = meter.measure((packet.size() + 24) * 4, sample_index);
+    const AISPacketMessage message{packet, tag, metadata};
     shared_memory.application_queue.push(message);
 }
 
 void AISProcessor::on_message(const Message* const message) {
-    if (message->id == Message::ID::AudioBeep)
-        on_beep_message(*reinterpret_cast<const AudioBeepMessage*>(message));
+    switch (message->id) {
+        case Message::ID::AudioBeep:
+            on_beep_message(*reinterpret_cast<const AudioBeepMessage*>(message));
+            break;
+
+        case Message::ID::AISConfigure:
+            configure(*reinterpret_cast<const AISConfigureMessage*>(message));
+            break;
+
+        default:
+            break;
+    }
 }
 
 void AISProcessor::on_beep_message(const AudioBeepMessage& message) {
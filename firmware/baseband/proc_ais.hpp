@@ -33,12 +33,15 @@
 #include "symbol_coding.hpp"
 #include "packet_builder.hpp"
 #include "baseband_packet.hpp"
+#include "packet_signal_meter.hpp"
 
 #include "message.hpp"
 
 #include <cstdint>
 #include <cstddef>
+#include <array>
 #include <bitset>
+#include <complex>
 
 #include "ais_baseband.hpp"
 
@@ -50,34 +53,78 @@ class AISProcessor : public BasebandProcessor {
 
    private:
     static constexpr size_t baseband_fs = 2457600;
+    static constexpr size_t decim_0_output_fs = baseband_fs / 8;
+    /* Dual channel mode is tuned to 162.000 MHz, between AIS 1 and AIS 2. */
+    static constexpr int32_t dual_channel_offset = 25000;
+
+    /* Mixer, second decimator and demodulator for one AIS channel. */
+    class Channel {
+       public:
+        Channel();
+
+        Channel(const Channel&) = delete;
+        Channel& operator=(const Channel&) = delete;
+
+        void configure(const int32_t offset_hz, const AISPacketMessage::Channel tag);
+        /* Returns the 38.4 kHz channel samples, valid until dst_buffer is reused. */
+        buffer_c16_t execute(const buffer_c16_t& src, const buffer_c16_t& mix_buffer, const buffer_c16_t& dst_buffer, const uint64_t sample_index);
+
+       private:
+        AISPacketMessage::Channel tag{AISPacketMessage::Channel::Tuned};
+        bool mixing{false};
+        std::complex<float> phasor{1.0f, 0.0f};
+        std::complex<float> rotation{1.0f, 0.0f};
+
+        dsp::decimate::FIRC16xR16x32Decim8 decim_1{};
+        dsp::matched_filter::MatchedFilter mf{baseband::ais::square_taps_38k4_1t_p, 2};
+
+        PacketSignalMeter meter{};
+        uint64_t sample_index{0};
+
+        clock_recovery::ClockRecovery<clock_recovery::FixedErrorFilter> clock_recovery{
+            19200,
+            9600,
+            {0.0555f},
+            [this](const float symbol) { this->consume_symbol(symbol); }};
+        symbol_coding::NRZIDecoder nrzi_decode{};
+
+        /* Decoded symbols from one buffer, handed to the packet builder together. */
+        std::array<uint8_t, 16> symbols{};
+        size_t symbols_count{0};
+
+        void consume_symbol(const float symbol);
+        void payload_handler(const baseband::Packet& packet);
+
+        PacketBuilder<BitPattern, BitPattern, BitPattern, PacketHandler<Channel, &Channel::payload_handler>> packet_builder{
+            {0b0101010101111110, 16, 1},
+            {0b111110, 6},
+            {0b01111110, 8},
+            {this}};
+    };
 
     std::array<complex16_t, 512> dst{};
     const buffer_c16_t dst_buffer{
         dst.data(),
         dst.size()};
 
+    /* decim_0 output shifted to one channel, 256 samples at 307.2kHz */
+    std::array<complex16_t, 256> mix{};
+    const buffer_c16_t mix_buffer{
+        mix.data(),
+        mix.size()};
+
+    std::array<complex16_t, 32> channel_out{};
+    const buffer_c16_t channel_out_buffer{
+        channel_out.data(),
+        channel_out.size()};
+
     dsp::decimate::FIRC8xR16x24FS4Decim8 decim_0{};
-    dsp::decimate::FIRC16xR16x32Decim8 decim_1{};
-    dsp::matched_filter::MatchedFilter mf{baseband::ais::square_taps_38k4_1t_p, 2};
-
-    clock_recovery::ClockRecovery<clock_recovery::FixedErrorFilter> clock_recovery{
-        19200,
-        9600,
-        {0.0555f},
-        [this](const float symbol) { this->consume_symbol(symbol); }};
-    symbol_coding::NRZIDecoder nrzi_decode{};
-    PacketBuilder<BitPattern, BitPattern, BitPattern> packet_builder{
-        {0b0101010101111110, 16, 1},
-        {0b111110, 6},
-        {0b01111110, 8},
-        [this](const baseband::Packet& packet) {
-            this->payload_handler(packet);
-        }};
-
-    void consume_symbol(const float symbol);
-    void payload_handler(const baseband::Packet& packet);
+    std::array<Channel, 2> channels{};
+    bool dual_channel{false};
+
     void on_message(const Message* const message);
     void on_beep_message(const AudioBeepMessage& message);
+    void configure(const AISConfigureMessage& message);
 
     /* NB: Threads should be the last members in the class definition. */
     BasebandThread baseband_thread{
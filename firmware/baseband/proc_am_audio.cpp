@@ -25,6 +25,8 @@
 #include "audio_dma.hpp"
 
 #include "event_m4.hpp"
+#include "portapack_shared_memory.hpp"
+#include "baseband_profiler.hpp"
 
 #include <array>
 #include "dsp_hilbert.hpp"
@@ -34,19 +36,28 @@ void NarrowbandAMAudio::execute(const buffer_c8_t& buffer) {
         return;
     }
 
+    using Stage = baseband::profile::Stage;
+    baseband::profile::StageTimer timer{shared_memory.m4_profile, Stage::Decim0};
+
     const auto decim_0_out = decim_0.execute(buffer, dst_buffer);
+    timer.lap(Stage::Decim1);
     const auto decim_1_out = decim_1.execute(decim_0_out, dst_buffer);
 
+    timer.lap(Stage::Spectrum);
     channel_spectrum.feed(decim_1_out, channel_filter_low_f, channel_filter_high_f, channel_filter_transition);
 
+    // decim_2 is counted as part of the channel filter
+    timer.lap(Stage::ChannelFilter);
     const auto decim_2_out = decim_2.execute(decim_1_out, dst_buffer);
     const auto channel_out = channel_filter.execute(decim_2_out, dst_buffer);
 
     // TODO: Feed channel_stats post-decimation data?
     feed_channel_stats(channel_out);
 
+    timer.lap(Stage::Demod);
     auto audio = demodulate(channel_out);  // now 3 AM demodulation types : demod_am, demod_ssb, demod_ssb_fm (for Wefax)
     audio_compressor.execute_in_place(audio);
+    timer.lap(Stage::AudioOutput);
     audio_output.write(audio);
 }
 
@@ -40,6 +40,7 @@ void APRSRxProcessor::execute(const buffer_c8_t& buffer) {
     const auto channel_out = channel_filter.execute(decim_1_out, dst_buffer);  // 32 / 2 = 16 (32 I/Q samples)
 
     feed_channel_stats(channel_out);
+    meter.feed(channel_out);
 
     auto audio = demod.execute(channel_out, audio_buffer);
 
@@ -133,7 +134,10 @@ void APRSRxProcessor::parse_ax25() {
         aprs_packet.set(i, packet_buffer[i]);
     }
 
-    APRSPacketMessage packet_message{aprs_packet};
+    /* Bit stuffing and flags make the frame slightly longer; close enough. */
+    const auto metadata = meter.measure(packet_buffer_size * 8 * samples_per_bit, baseband_thread.sample_index());
+
+    APRSPacketMessage packet_message{aprs_packet, metadata};
     shared_memory.application_queue.push(packet_message);
 }
 
@@ -35,6 +35,7 @@
 
 #include "fifo.hpp"
 #include "message.hpp"
+#include "packet_signal_meter.hpp"
 
 #include "aprs_packet.hpp"
 
@@ -130,6 +131,7 @@ class APRSRxProcessor : public BasebandProcessor {
     bool bit_value{0};
 
     aprs::APRSPacket aprs_packet{};
+    PacketSignalMeter meter{};
 
     /* NB: Threads should be the last members in the class definition. */
     BasebandThread baseband_thread{baseband_fs, this, baseband::Direction::Receive};
@@ -48,6 +48,7 @@ void EPIRBProcessor::execute(const buffer_c8_t& buffer) {
 
     /* 38.4kHz, 32 samples (approximately) */
     feed_channel_stats(decimator_out);
+    meter.feed(decimator_out);
 
     // Process each decimated sample through the matched filter
     for (size_t i = 0; i < decimator_out.count; i++) {
@@ -80,7 +81,9 @@ void EPIRBProcessor::payload_handler(const baseband::Packet& packet) {
         last_packet_timestamp = Timestamp::now();
 
         // Create and send EPIRB packet message to application layer
-        const EPIRBPacketMessage message{packet};
+        // 96 samples per bit, plus 22 bits of preamble and frame sync
+        const auto metadata = meter.measure((packet.size() + 22) * 96, baseband_thread.sample_index());
+        const EPIRBPacketMessage message{packet, metadata};
         shared_memory.application_queue.push(message);
     }
 }
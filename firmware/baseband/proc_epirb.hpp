@@ -36,6 +36,7 @@
 #include "symbol_coding.hpp"
 #include "packet_builder.hpp"
 #include "baseband_packet.hpp"
+#include "packet_signal_meter.hpp"
 #include "message.hpp"
 #include "buffer.hpp"
 
@@ -111,16 +112,16 @@ class EPIRBProcessor : public BasebandProcessor {
     // - Data: 112 bits
     // - BCH error correction: 10 bits
     // Total: 144 bits
-    PacketBuilder<BitPattern, BitPattern, BitPattern> packet_builder{
+    void consume_symbol(const float symbol);
+    void payload_handler(const baseband::Packet& packet);
+
+    PacketBuilder<BitPattern, BitPattern, BitPattern, PacketHandler<EPIRBProcessor, &EPIRBProcessor::payload_handler>> packet_builder{
         {0b010101010101010, 15, 1},  // Preamble pattern
         {0b0111110, 7},              // Frame sync pattern
         {0b0111110, 7},              // End pattern (same as sync for simplicity)
-        [this](const baseband::Packet& packet) {
-            this->payload_handler(packet);
-        }};
+        {this}};
 
-    void consume_symbol(const float symbol);
-    void payload_handler(const baseband::Packet& packet);
+    PacketSignalMeter meter{};
 
     // Statistics
     uint32_t packets_received = 0;
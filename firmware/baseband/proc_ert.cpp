@@ -61,6 +61,8 @@ void ERTProcessor::execute(const buffer_c8_t& buffer) {
 
     const float gain = 128 * samples_per_symbol;
     const float k = 1.0f / gain;
+    const float half_period_k = 2.0f / samples_per_symbol;
+    float power_sum = 0.0f;
 
     while (src < src_end) {
         float sum = 0.0f;
@@ -69,6 +71,9 @@ void ERTProcessor::execute(const buffer_c8_t& buffer) {
         }
         sum_half_period[1] = sum_half_period[0];
         sum_half_period[0] = sum;
+        /* Mean magnitude squared over the half period, cheaper than
+         * summing |s|^2 and close enough for a carrier. */
+        power_sum += sum * sum * half_period_k;
 
         sum_period[2] = sum_period[1];
         sum_period[1] = sum_period[0];
@@ -82,34 +87,44 @@ void ERTProcessor::execute(const buffer_c8_t& buffer) {
 
         clock_recovery(data);
     }
+
+    meter.feed_power(power_sum * (1.0f / (128.0f * 128.0f)), buffer.count, baseband_sampling_rate);
+
+    scm_builder.execute(symbols.data(), symbols_count);
+    scmplus_builder.execute(symbols.data(), symbols_count);
+    idm_builder.execute(symbols.data(), symbols_count);
+    symbols_count = 0;
 }
 
 void ERTProcessor::consume_symbol(
     const float raw_symbol) {
-    const uint_fast8_t sliced_symbol = (raw_symbol >= 0.0f) ? 1 : 0;
-    scm_builder.execute(sliced_symbol);
-    scmplus_builder.execute(sliced_symbol);
-    idm_builder.execute(sliced_symbol);
+    if (symbols_count < symbols.size()) {
+        symbols[symbols_count++] = (raw_symbol >= 0.0f) ? 1 : 0;
+    }
 }
 
 void ERTProcessor::scm_handler(
     const baseband::Packet& packet) {
-    const ERTPacketMessage message{ert::Packet::Type::SCM, packet};
+    const ERTPacketMessage message{ert::Packet::Type::SCM, packet, frame_metadata(packet.size() + scm_preamble_and_sync_length)};
     shared_memory.application_queue.push(message);
 }
 
 void ERTProcessor::scmplus_handler(
     const baseband::Packet& packet) {
-    const ERTPacketMessage message{ert::Packet::Type::SCMPLUS, packet};
+    const ERTPacketMessage message{ert::Packet::Type::SCMPLUS, packet, frame_metadata(packet.size() + scmplus_preamble_and_sync_length)};
     shared_memory.application_queue.push(message);
 }
 
 void ERTProcessor::idm_handler(
     const baseband::Packet& packet) {
-    const ERTPacketMessage message{ert::Packet::Type::IDM, packet};
+    const ERTPacketMessage message{ert::Packet::Type::IDM, packet, frame_metadata(packet.size() + idm_preamble_and_sync_length)};
     shared_memory.application_queue.push(message);
 }
 
+PacketMetadata ERTProcessor::frame_metadata(const size_t symbols) const {
+    return meter.measure(symbols * samples_per_symbol, baseband_thread.sample_index());
+}
+
 void ERTProcessor::on_message(const Message* const msg) {
     if (msg->id == Message::ID::AudioBeep)
         on_beep_message(*reinterpret_cast<const AudioBeepMessage*>(msg));
@@ -33,11 +33,13 @@
 #include "symbol_coding.hpp"
 #include "packet_builder.hpp"
 #include "baseband_packet.hpp"
+#include "packet_signal_meter.hpp"
 
 #include "message.hpp"
 
 #include <cstdint>
 #include <cstddef>
+#include <array>
 #include <bitset>
 
 // ''.join(['%d%d' % (c, 1-c) for c in map(int, bin(0x1f2a60)[2:].zfill(21))])
@@ -74,34 +76,36 @@ class ERTProcessor : public BasebandProcessor {
         {1.0f / 18.0f},
         [this](const float symbol) { this->consume_symbol(symbol); }};
 
-    PacketBuilder<BitPattern, NeverMatch, FixedLength> scm_builder{
+    /* Sliced symbols from one buffer, fed to all three builders afterwards. */
+    std::array<uint8_t, 64> symbols{};
+    size_t symbols_count{0};
+
+    void scm_handler(const baseband::Packet& packet);
+    void scmplus_handler(const baseband::Packet& packet);
+    void idm_handler(const baseband::Packet& packet);
+
+    PacketBuilder<BitPattern, NeverMatch, FixedLength, PacketHandler<ERTProcessor, &ERTProcessor::scm_handler>> scm_builder{
         {scm_preamble_and_sync_manchester, scm_preamble_and_sync_length, 1},
         {},
         {scm_payload_length_max},
-        [this](const baseband::Packet& packet) {
-            this->scm_handler(packet);
-        }};
+        {this}};
 
-    PacketBuilder<BitPattern, NeverMatch, FixedLength> scmplus_builder{
+    PacketBuilder<BitPattern, NeverMatch, FixedLength, PacketHandler<ERTProcessor, &ERTProcessor::scmplus_handler>> scmplus_builder{
         {scmplus_preamble_and_sync_manchester, scmplus_preamble_and_sync_length, 1},
         {},
         {scmplus_payload_length_max},
-        [this](const baseband::Packet& packet) {
-            this->scmplus_handler(packet);
-        }};
+        {this}};
 
-    PacketBuilder<BitPattern, NeverMatch, FixedLength> idm_builder{
+    PacketBuilder<BitPattern, NeverMatch, FixedLength, PacketHandler<ERTProcessor, &ERTProcessor::idm_handler>> idm_builder{
         {idm_preamble_and_sync_manchester, idm_preamble_and_sync_length, 1},
         {},
         {idm_payload_length_max},
-        [this](const baseband::Packet& packet) {
-            this->idm_handler(packet);
-        }};
+        {this}};
+
+    PacketSignalMeter meter{};
 
     void consume_symbol(const float symbol);
-    void scm_handler(const baseband::Packet& packet);
-    void scmplus_handler(const baseband::Packet& packet);
-    void idm_handler(const baseband::Packet& packet);
+    PacketMetadata frame_metadata(const size_t symbols) const;
     void on_message(const Message* const msg);
     void on_beep_message(const AudioBeepMessage& message);
 
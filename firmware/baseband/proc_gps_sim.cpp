@@ -29,6 +29,8 @@
 
 #include "utility.hpp"
 
+#include <cstring>
+
 GPSReplayProcessor::GPSReplayProcessor() {
     channel_filter_low_f = taps_200k_decim_1.low_frequency_normalized * 1000000;
     channel_filter_high_f = taps_200k_decim_1.high_frequency_normalized * 1000000;
@@ -51,19 +53,14 @@ void GPSReplayProcessor::execute(const buffer_c8_t& buffer) {
     // File samplerate is 2.6MHz, which is what we need
     // To fill up the 2048-sample C8 buffer @ 2 bytes per sample = 4096 bytes
     const size_t bytes_to_read = sizeof(*buffer.p) * 1 * (buffer.count);
-    size_t bytes_read_this_iteration = stream->read(iq_buffer.p, bytes_to_read);
+    size_t bytes_read_this_iteration = stream->read(buffer.p, bytes_to_read);
     size_t samples_read_this_iteration = bytes_read_this_iteration / sizeof(*buffer.p);
 
     bytes_read += bytes_read_this_iteration;
 
-    // NB: Couldn't we have just read the data into buffer.p to start with, or some DMA/cache coherency concern?
-    //
-    // for (size_t i = 0; i < buffer.count; i++) {
-    //     auto re_out = iq_buffer.p[i].real();
-    //     auto im_out = iq_buffer.p[i].imag();
-    //     buffer.p[i] = {(int8_t)re_out, (int8_t)im_out};
-    // }
-    memcpy(buffer.p, iq_buffer.p, bytes_read_this_iteration);  // memcpy should be more efficient than 1 byte at a time
+    // A short read is an underrun (counted by the stream), send silence rather than the previous block.
+    if (bytes_read_this_iteration < bytes_to_read)
+        memset(reinterpret_cast<uint8_t*>(buffer.p) + bytes_read_this_iteration, 0, bytes_to_read - bytes_read_this_iteration);
 
     spectrum_samples += samples_read_this_iteration;
     if (spectrum_samples >= spectrum_interval_samples) {
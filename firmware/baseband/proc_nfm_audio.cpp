@@ -27,6 +27,7 @@
 #include "audio_dma.hpp"
 
 #include "event_m4.hpp"
+#include "baseband_profiler.hpp"
 
 #include <cstdint>
 #include <cstddef>
@@ -38,19 +39,30 @@ void NarrowbandFMAudio::execute(const buffer_c8_t& buffer) {
         return;
     }
 
+    using Stage = baseband::profile::Stage;
+    baseband::profile::StageTimer timer{shared_memory.m4_profile, Stage::Decim0};
+
     const auto decim_0_out = decim_0.execute(buffer, dst_buffer);
+    channel_activity.feed(decim_0_out);
+
+    timer.lap(Stage::Decim1);
     const auto decim_1_out = decim_1.execute(decim_0_out, dst_buffer);
 
+    timer.lap(Stage::Spectrum);
     channel_spectrum.feed(decim_1_out, channel_filter_low_f, channel_filter_high_f, channel_filter_transition);
 
+    timer.lap(Stage::ChannelFilter);
     const auto channel_out = channel_filter.execute(decim_1_out, dst_buffer);
 
     feed_channel_stats(channel_out);
 
     if (!pitch_rssi_enabled) {
         // Normal mode, output demodulated audio
+        timer.lap(Stage::Demod);
         auto audio = demod.execute(channel_out, audio_buffer);
+        timer.lap(Stage::AudioOutput);
         audio_output.write(audio);
+        timer.stop();
 
         if (ctcss_detect_enabled) {
             /* 24kHz int16_t[16]
@@ -60,36 +72,17 @@ void NarrowbandFMAudio::execute(const buffer_c8_t& buffer) {
              * Note we're only processing a small section of the wave each time this fn is called */
             auto audio_ctcss = ctcss_filter.execute(audio, work_audio_buffer);
 
-            // s16 to f32 for hpf
-            std::array<float, 8> audio_f;
-            for (size_t i = 0; i < audio_ctcss.count; i++) {
-                audio_f[i] = audio_ctcss.p[i] * ki;
-            }
-
-            hpf.execute_in_place(buffer_f32_t{
-                audio_f.data(),
-                audio_ctcss.count,
-                audio_ctcss.sampling_rate});
-
-            // Zero-crossing detection
-            for (size_t c = 0; c < audio_ctcss.count; c++) {
-                cur_sample = audio_f[c];
-                if (cur_sample * prev_sample < 0.0) {
-                    z_acc += z_timer;
-                    z_timer = 1;
-                    z_count++;
-                } else
-                    z_timer++;
-                prev_sample = cur_sample;
-            }
-
-            z_filter_count++;
-            if ((z_filter_count >= Z_MIN_FILTER_COUNT) && (z_count >= Z_MIN_ZERO_CROSSINGS)) {
-                ctcss_message.value = (100 * 12000 / 2 * z_count) / z_acc;
-                shared_memory.application_queue.push(ctcss_message);
-                z_filter_count = 0;
-                z_count = 0;
-                z_acc = 0;
+            coded_squelch.execute(audio_ctcss);
+
+            dsp::CodedSquelchDetector::Result result;
+            while (coded_squelch.pop(result)) {
+                coded_squelch_message.type = (result.type == dsp::CodedSquelchDetector::Result::Type::DCS)
+                                                 ? CodedSquelchMessage::Type::DCS
+                                                 : CodedSquelchMessage::Type::CTCSS;
+                coded_squelch_message.value = result.value;
+                coded_squelch_message.inverted = result.inverted;
+                coded_squelch_message.confidence = result.confidence;
+                shared_memory.application_queue.push(coded_squelch_message);
             }
         }
     } else {
@@ -113,10 +106,18 @@ void NarrowbandFMAudio::execute(const buffer_c8_t& buffer) {
 void NarrowbandFMAudio::on_message(const Message* const message) {
     switch (message->id) {
         case Message::ID::UpdateSpectrum:
+            channel_spectrum.on_message(message);
+            channel_activity.on_message(message);
+            break;
+
         case Message::ID::SpectrumStreamingConfig:
             channel_spectrum.on_message(message);
             break;
 
+        case Message::ID::ChannelActivityConfig:
+            channel_activity.on_message(message);
+            break;
+
         case Message::ID::NBFMConfigure:
             configure(*reinterpret_cast<const NBFMConfigureMessage*>(message));
             break;
@@ -156,8 +157,8 @@ void NarrowbandFMAudio::configure(const NBFMConfigureMessage& message) {
     channel_spectrum.set_decimation_factor(1.0f);
     audio_output.configure(message.audio_hpf_config, message.audio_deemph_config, (float)message.squelch_level / 100.0);
 
-    hpf.configure(audio_24k_hpf_30hz_config);
     ctcss_filter.configure(taps_64_lp_025_025.taps);
+    coded_squelch.reset();
 
     configured = true;
 }
@@ -30,15 +30,14 @@
 #include "dsp_decimate.hpp"
 #include "dsp_demodulate.hpp"
 #include "dsp_iir.hpp"
+#include "dsp_coded_squelch.hpp"
 
 #include "audio_output.hpp"
 #include "spectrum_collector.hpp"
+#include "channel_activity_collector.hpp"
 
 #include <cstdint>
 
-#define Z_MIN_FILTER_COUNT 224
-#define Z_MIN_ZERO_CROSSINGS 20
-
 class NarrowbandFMAudio : public BasebandProcessor {
    public:
     void execute(const buffer_c8_t& buffer) override;
@@ -72,29 +71,26 @@ class NarrowbandFMAudio : public BasebandProcessor {
     int32_t channel_filter_high_f = 0;
     int32_t channel_filter_transition = 0;
 
-    // For CTCSS decoding
+    // For CTCSS/DCS decoding
     dsp::decimate::FIR64AndDecimateBy2Real ctcss_filter{};
-    IIRBiquadFilter hpf{};
+    dsp::CodedSquelchDetector coded_squelch{};
 
     dsp::demodulate::FM demod{};
 
     AudioOutput audio_output{};
 
     SpectrumCollector channel_spectrum{};
+    ChannelActivityCollector channel_activity{};
 
     uint32_t tone_phase{0};
     uint32_t tone_delta{0};
     bool pitch_rssi_enabled{false};
 
-    float cur_sample{}, prev_sample{};
-    uint32_t z_acc{0}, z_timer{0}, z_count{0}, z_filter_count{0};
     bool ctcss_detect_enabled{true};
-    static constexpr float k = 32768.0f;
-    static constexpr float ki = 1.0f / k;
 
     bool configured{false};
     // RequestSignalMessage sig_message { RequestSignalMessage::Signal::Squelched };
-    CodedSquelchMessage ctcss_message{0};
+    CodedSquelchMessage coded_squelch_message{0};
 
     /* NB: Threads should be the last members in the class definition. */
     BasebandThread baseband_thread{baseband_fs, this, baseband::Direction::Receive};
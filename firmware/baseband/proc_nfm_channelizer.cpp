@@ -0,0 +1,361 @@
+/*
+ * Copyright (C) 2026
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "proc_nfm_channelizer.hpp"
+
+#include "portapack_shared_memory.hpp"
+#include "audio_dma.hpp"
+#include "dsp_fir_taps.hpp"
+#include "dsp_iir_config.hpp"
+#include "event_m4.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+constexpr float power_reference = 32768.0f * 32768.0f;
+
+int8_t power_to_db(const float power) {
+    if (power <= 0.0f) return -128;
+    const float db = 10.0f * std::log10(power / power_reference);
+    return static_cast<int8_t>(std::max(-128.0f, std::min(127.0f, db)));
+}
+
+int16_t saturate_s16(const float value) {
+    return static_cast<int16_t>(std::max(-32768.0f, std::min(32767.0f, value)));
+}
+
+/* atan2 to about 0.3 degrees. Folding into the first octant keeps it accurate
+ * for the large per sample phase steps of a channel sampled at its spacing.
+ */
+float fast_atan2(const float y, const float x) {
+    const float ax = std::abs(x);
+    const float ay = std::abs(y);
+    if ((ax == 0.0f) && (ay == 0.0f)) return 0.0f;
+
+    const bool steep = ay > ax;
+    const float r = steep ? (ax / ay) : (ay / ax);
+    float angle = r / (1.0f + 0.28086f * r * r);
+    if (steep) angle = pi / 2 - angle;
+    if (x < 0.0f) angle = pi - angle;
+    return (y < 0.0f) ? -angle : angle;
+}
+
+} /* namespace */
+
+void NFMChannelizerProcessor::execute(const buffer_c8_t& buffer) {
+    if (!configured) return;
+
+    /* 2048 samples at spacing * 32 * 8 -> 256 samples at spacing * 32, centered on the tuned frequency.
+     * The filter bank then produces 8 samples per channel per buffer.
+     */
+    const auto decim_0_out = decim_0.execute(buffer, dst_buffer);
+
+    monitor_sample = 0;
+    channelizer.execute(
+        decim_0_out,
+        [this](const dsp::channelize::PolyphaseChannelizer<channel_count, 8>::output_t& outputs) {
+            on_channels(outputs);
+        });
+
+    update_slots();
+    update_channels();
+
+    if (monitor_index >= channel_count) return;
+
+    const buffer_c16_t monitor_buffer{monitor_samples.data(), monitor_sample, channel_fs};
+    feed_channel_stats(monitor_buffer);
+
+    /* Keep demodulating while closed so the discriminator state stays continuous, output silence. */
+    const auto demod_out = demod.execute(monitor_buffer, buffer_f32_t{demod_audio.data(), demod_audio.size(), channel_fs});
+    const bool open = channels[monitor_index].active;
+
+    size_t audio_count = 0;
+    for (size_t i = 0; i < demod_out.count; i++) {
+        audio_resampler(open ? demod_out.p[i] : 0.0f, [this, &audio_count](const float sample) {
+            if (audio_count < audio.size()) audio[audio_count++] = sample;
+        });
+    }
+    audio_output.write(buffer_f32_t{audio.data(), audio_count, 24000});
+}
+
+void NFMChannelizerProcessor::on_channels(const dsp::channelize::PolyphaseChannelizer<channel_count, 8>::output_t& outputs) {
+    for (size_t c = 0; c < channel_count; c++) {
+        auto& channel = channels[c];
+        const auto sample = outputs[c];
+        channel.energy += std::norm(sample);
+        if (channel.active) {
+            /* Power weighted phase rotation, its angle gives the mean carrier offset. */
+            channel.rotation += sample * std::conj(channel.last);
+        }
+        channel.last = sample;
+    }
+
+    for (auto& slot : slots) {
+        if (slot.index < channel_count) feed_slot(slot, outputs[slot.index]);
+    }
+
+    if ((monitor_index < channel_count) && (monitor_sample < monitor_samples.size())) {
+        const auto sample = outputs[monitor_index];
+        monitor_samples[monitor_sample++] = {saturate_s16(sample.real()), saturate_s16(sample.imag())};
+    }
+}
+
+void NFMChannelizerProcessor::update_channels() {
+    block_count++;
+
+    for (size_t c = 0; c < channel_count; c++) {
+        auto& channel = channels[c];
+        const float power = channel.energy / samples_per_channel;
+        channel.energy = 0.0f;
+
+        if (block_count <= settle_blocks) {
+            /* Seed the floor from the first blocks; a carrier already present at start is treated as noise. */
+            channel.power = power;
+            channel.floor += power / settle_blocks;
+            continue;
+        }
+
+        channel.power += (power - channel.power) * 0.25f;
+
+        if (!channel.active) {
+            if (channel.power > channel.floor * open_ratio) {
+                channel.active = true;
+                channel.peak = channel.power;
+                channel.rotation = {0.0f, 0.0f};
+                channel.open_blocks = 0;
+                channel.quiet_blocks = 0;
+                channel.code_type = NFMChannelEvent::Code::None;
+                assign_slot(c, channel);
+            } else {
+                /* Track down quickly, up slowly. */
+                const float rate = (channel.power < channel.floor) ? 0.05f : 0.0005f;
+                channel.floor += (channel.power - channel.floor) * rate;
+            }
+        } else {
+            channel.open_blocks++;
+            channel.peak = std::max(channel.peak, channel.power);
+            if (channel.power < channel.floor * close_ratio) {
+                if (++channel.quiet_blocks >= hold_blocks) {
+                    channel.active = false;
+                    release_slot(channel);
+                }
+            } else {
+                channel.quiet_blocks = 0;
+            }
+        }
+
+        if (channel.active != channel.reported) {
+            channel.reported = report(c, channel) ? channel.active : channel.reported;
+        }
+    }
+
+    if ((block_count % level_blocks) == 0) send_levels();
+}
+
+bool NFMChannelizerProcessor::report(const size_t index, Channel& channel) {
+    NFMChannelEvent event{};
+    event.channel = channel_number(index);
+    event.active = channel.active;
+    event.db = power_to_db(channel.peak);
+    event.snr = power_to_db(channel.peak * power_reference / channel.floor);
+
+    if (!channel.active) {
+        event.offset_hz = std::atan2(channel.rotation.imag(), channel.rotation.real()) * channel_fs / (2.0f * pi);
+        event.duration_ms = (uint64_t)channel.open_blocks * 2048 * 1000 / baseband_fs;
+        event.code_type = channel.code_type;
+        event.code_inverted = channel.code_inverted;
+        event.code_value = channel.code_value;
+    }
+
+    const NFMChannelEventMessage message{event};
+    return shared_memory.application_queue.push(message);
+}
+
+int8_t NFMChannelizerProcessor::channel_number(const size_t index) {
+    return static_cast<int32_t>(index) - ((index < channel_count / 2) ? 0 : static_cast<int32_t>(channel_count));
+}
+
+void NFMChannelizerProcessor::assign_slot(const size_t index, Channel& channel) {
+    for (size_t s = 0; s < slots.size(); s++) {
+        auto& slot = slots[s];
+        if (slot.index < channel_count) continue;
+
+        slot.index = index;
+        slot.last = channel.last;
+        slot.code_lp_0 = 0.0f;
+        slot.code_lp_1 = 0.0f;
+        slot.code_count = 0;
+        slot.coded_squelch.reset();
+        slot.snippet_acc = 0.0f;
+        slot.snippet_odd = false;
+        slot.frame.slot = s;
+        slot.frame.channel = channel_number(index);
+        slot.frame.flags = NFMChannelAudioFrame::Start;
+        slot.frame.count = 0;
+
+        channel.slot = s;
+        return;
+    }
+}
+
+void NFMChannelizerProcessor::release_slot(Channel& channel) {
+    if (channel.slot >= slot_count) return;
+
+    auto& slot = slots[channel.slot];
+    if (snippet_stream) {
+        slot.frame.flags |= NFMChannelAudioFrame::End;
+        send_frame(slot);
+    }
+    slot.index = channel_count;
+    channel.slot = slot_count;
+}
+
+void NFMChannelizerProcessor::feed_slot(VoiceSlot& slot, const std::complex<float> sample) {
+    const auto delta = sample * std::conj(slot.last);
+    slot.last = sample;
+    const float audio = fast_atan2(delta.imag(), delta.real()) * discriminator_gain;
+
+    /* Tones and DCS sit below 300 Hz, two one-pole sections keep most of the voice out of the detector. */
+    slot.code_lp_0 += (audio - slot.code_lp_0) * code_lp_alpha;
+    slot.code_lp_1 += (slot.code_lp_0 - slot.code_lp_1) * code_lp_alpha;
+    slot.code_resampler(slot.code_lp_1, [&slot](const float value) {
+        if (slot.code_count < slot.code_audio.size()) slot.code_audio[slot.code_count++] = saturate_s16(value);
+    });
+
+    if (!snippet_stream) return;
+
+    /* Half the channel rate is plenty for voice and halves the SD card traffic. */
+    slot.snippet_acc += audio;
+    slot.snippet_odd = !slot.snippet_odd;
+    if (slot.snippet_odd) return;
+
+    slot.frame.samples[slot.frame.count++] = saturate_s16(slot.snippet_acc * 0.5f);
+    slot.snippet_acc = 0.0f;
+    if (slot.frame.count == slot.frame.samples.size()) send_frame(slot);
+}
+
+void NFMChannelizerProcessor::update_slots() {
+    using Result = dsp::CodedSquelchDetector::Result;
+
+    for (auto& slot : slots) {
+        if (slot.index >= channel_count) continue;
+
+        slot.coded_squelch.execute({slot.code_audio.data(), slot.code_count, dsp::CodedSquelchDetector::input_rate});
+        slot.code_count = 0;
+
+        auto& channel = channels[slot.index];
+        Result result;
+        while (slot.coded_squelch.pop(result)) {
+            channel.code_type = (result.type == Result::Type::DCS) ? NFMChannelEvent::Code::DCS : NFMChannelEvent::Code::CTCSS;
+            channel.code_inverted = result.inverted;
+            channel.code_value = result.value;
+        }
+    }
+}
+
+void NFMChannelizerProcessor::send_frame(VoiceSlot& slot) {
+    /* Frames never straddle a buffer, so a dropped write loses whole frames only. */
+    snippet_stream->write(&slot.frame, sizeof(slot.frame));
+    slot.frame.flags = 0;
+    slot.frame.count = 0;
+}
+
+void NFMChannelizerProcessor::send_levels() {
+    /* Levels in ascending frequency order: entry i is channel number i - 16. */
+    ChannelActivity levels{};
+    levels.channel_count = channel_count;
+    for (size_t i = 0; i < channel_count; i++) {
+        const auto& channel = channels[(i + channel_count / 2) % channel_count];
+        levels.db[i] = power_to_db(channel.power);
+        if (channel.active) levels.active |= (1U << i);
+    }
+
+    const ChannelActivityMessage message{levels};
+    shared_memory.application_queue.push(message);
+}
+
+void NFMChannelizerProcessor::on_message(const Message* const message) {
+    switch (message->id) {
+        case Message::ID::NFMChannelizerConfigure:
+            configure(*reinterpret_cast<const NFMChannelizerConfigureMessage*>(message));
+            break;
+
+        case Message::ID::CaptureConfig:
+            capture_config(*reinterpret_cast<const CaptureConfigMessage*>(message));
+            break;
+
+        default:
+            break;
+    }
+}
+
+void NFMChannelizerProcessor::configure(const NFMChannelizerConfigureMessage& message) {
+    baseband_fs = message.sampling_rate;
+    baseband_thread.set_sampling_rate(baseband_fs);
+    channel_fs = baseband_fs / 8 / channel_count;
+
+    decim_0.configure(taps_16k0_decim_0.taps);
+    channelizer.configure();
+    demod.configure(channel_fs, message.deviation);
+    audio_resampler.configure(channel_fs, 24000);
+    audio_output.configure(audio_24k_hpf_300hz_config, audio_24k_deemph_300_6_config, 0.0f);
+
+    /* Slot discriminators output s16 full scale at the nominal deviation. */
+    discriminator_gain = 32767.0f * channel_fs / (2.0f * pi * message.deviation);
+    code_lp_alpha = 1.0f - std::exp(-2.0f * pi * 300.0f / channel_fs);
+
+    const int32_t monitor = message.monitor_channel;
+    const int32_t half = channel_count / 2;
+    monitor_index = ((monitor >= -half) && (monitor < half)) ? (monitor + channel_count) % channel_count : channel_count;
+
+    open_ratio = std::pow(10.0f, message.squelch_db / 10.0f);
+    close_ratio = std::pow(10.0f, (message.squelch_db - close_hysteresis_db) / 10.0f);
+
+    const uint32_t blocks_per_second = baseband_fs / 2048;
+    hold_blocks = std::max<uint32_t>(blocks_per_second / 4, 1);
+    level_blocks = std::max<uint32_t>(blocks_per_second / 10, 1);
+
+    /* Reconfiguring changes the channel raster: start over. */
+    for (auto& channel : channels) release_slot(channel);
+    for (auto& slot : slots) slot.code_resampler.configure(channel_fs, dsp::CodedSquelchDetector::input_rate);
+    channels = {};
+    block_count = 0;
+
+    configured = true;
+}
+
+void NFMChannelizerProcessor::capture_config(const CaptureConfigMessage& message) {
+    if (message.config) {
+        snippet_stream = std::make_unique<StreamInput>(message.config);
+    } else {
+        snippet_stream.reset();
+    }
+}
+
+int main() {
+    audio::dma::init_audio_out();
+
+    EventDispatcher event_dispatcher{std::make_unique<NFMChannelizerProcessor>()};
+    event_dispatcher.run();
+    return 0;
+}
@@ -0,0 +1,142 @@
+/*
+ * Copyright (C) 2026
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __PROC_NFM_CHANNELIZER_H__
+#define __PROC_NFM_CHANNELIZER_H__
+
+#include "baseband_processor.hpp"
+#include "baseband_thread.hpp"
+#include "rssi_thread.hpp"
+
+#include "dsp_decimate.hpp"
+#include "dsp_demodulate.hpp"
+#include "dsp_channelizer.hpp"
+#include "dsp_coded_squelch.hpp"
+#include "linear_resampler.hpp"
+
+#include "audio_output.hpp"
+#include "stream_input.hpp"
+#include "message.hpp"
+
+#include <array>
+#include <complex>
+#include <memory>
+
+class NFMChannelizerProcessor : public BasebandProcessor {
+   public:
+    void execute(const buffer_c8_t& buffer) override;
+    void on_message(const Message* const message) override;
+
+   private:
+    static constexpr size_t channel_count = NFMChannelizerConfigureMessage::channel_count;
+    static constexpr size_t decim_0_output_count = 2048 / 8;
+    static constexpr size_t samples_per_channel = decim_0_output_count / channel_count;
+    static constexpr size_t settle_blocks = 16;
+    static constexpr int32_t close_hysteresis_db = 3;
+    /* Open channels beyond this get no CTCSS/DCS decoding and no snippet. */
+    static constexpr size_t slot_count = NFMChannelAudioFrame::slot_count;
+
+    size_t baseband_fs = 3200000;
+    uint32_t channel_fs = 0;
+    float discriminator_gain{0.0f};
+    float code_lp_alpha{0.0f};
+    bool configured{false};
+
+    std::array<complex16_t, 512> dst{};
+    const buffer_c16_t dst_buffer{
+        dst.data(),
+        dst.size()};
+
+    std::array<complex16_t, samples_per_channel> monitor_samples{};
+    std::array<float, samples_per_channel> demod_audio{};
+    std::array<float, samples_per_channel * 2> audio{};
+
+    dsp::decimate::FIRC8xR16x24FS4Decim8 decim_0{};
+    dsp::channelize::PolyphaseChannelizer<channel_count, 8> channelizer{};
+    dsp::demodulate::FM demod{};
+    dsp::interpolation::LinearResampler audio_resampler{};
+
+    AudioOutput audio_output{};
+
+    struct Channel {
+        float energy{0.0f};      // accumulated over the current block
+        float power{0.0f};       // smoothed block power
+        float floor{0.0f};       // noise floor while closed
+        float peak{0.0f};        // peak power while open
+        std::complex<float> last{0.0f, 0.0f};
+        std::complex<float> rotation{0.0f, 0.0f};
+        uint32_t open_blocks{0};
+        uint32_t quiet_blocks{0};
+        bool active{false};
+        bool reported{false};
+        size_t slot{slot_count};
+        NFMChannelEvent::Code code_type{NFMChannelEvent::Code::None};
+        bool code_inverted{false};
+        uint16_t code_value{0};
+    };
+    std::array<Channel, channel_count> channels{};
+
+    /* Per channel discriminator feeding a coded squelch detector and the snippet stream. */
+    struct VoiceSlot {
+        size_t index{channel_count};  // channel_count while free
+        std::complex<float> last{0.0f, 0.0f};
+        float code_lp_0{0.0f};
+        float code_lp_1{0.0f};
+        dsp::interpolation::LinearResampler code_resampler{};
+        std::array<int16_t, 32> code_audio{};
+        size_t code_count{0};
+        dsp::CodedSquelchDetector coded_squelch{};
+        float snippet_acc{0.0f};
+        bool snippet_odd{false};
+        NFMChannelAudioFrame frame{};
+    };
+    std::array<VoiceSlot, slot_count> slots{};
+    std::unique_ptr<StreamInput> snippet_stream{};
+
+    size_t monitor_index{channel_count};
+    size_t monitor_sample{0};
+    float open_ratio{0.0f};
+    float close_ratio{0.0f};
+    uint32_t hold_blocks{0};
+    uint32_t level_blocks{0};
+    uint32_t block_count{0};
+
+    void on_channels(const dsp::channelize::PolyphaseChannelizer<channel_count, 8>::output_t& outputs);
+    void update_channels();
+    bool report(const size_t index, Channel& channel);
+    static int8_t channel_number(const size_t index);
+    void send_levels();
+
+    void assign_slot(const size_t index, Channel& channel);
+    void release_slot(Channel& channel);
+    void feed_slot(VoiceSlot& slot, const std::complex<float> sample);
+    void update_slots();
+    void send_frame(VoiceSlot& slot);
+
+    void configure(const NFMChannelizerConfigureMessage& message);
+    void capture_config(const CaptureConfigMessage& message);
+
+    /* NB: Threads should be the last members in the class definition. */
+    BasebandThread baseband_thread{baseband_fs, this, baseband::Direction::Receive};
+    RSSIThread rssi_thread{};
+};
+
+#endif /*__PROC_NFM_CHANNELIZER_H__*/
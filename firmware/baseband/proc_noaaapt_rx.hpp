@@ -67,11 +67,6 @@ class NoaaAptRx : public BasebandProcessor {
         (int16_t*)dst.data(),
         sizeof(dst) / sizeof(int16_t)};
 
-    std::array<complex16_t, 64> complex_audio{};
-    const buffer_c16_t complex_audio_buffer{
-        complex_audio.data(),
-        complex_audio.size()};
-
     dsp::decimate::FIRC8xR16x24FS4Decim4 decim_0{};
     // dsp::decimate::FIRC16xR16x16Decim2 decim_1{};   //original condition , before adding wfmam
 
@@ -91,19 +86,6 @@ class NoaaAptRx : public BasebandProcessor {
 
     AudioOutput audio_output{};
 
-    // For fs=96kHz FFT streaming
-    BlockDecimator<complex16_t, 256> audio_spectrum_decimator{1};
-    std::array<std::complex<float>, 256> audio_spectrum{};
-    uint32_t audio_spectrum_timer{0};
-    enum AudioSpectrumState {
-        IDLE = 0,
-        FEED,
-        FFT
-    };
-    AudioSpectrumState audio_spectrum_state{IDLE};
-    AudioSpectrum spectrum{};
-    uint32_t fft_step{0};
-
     // SpectrumCollector channel_spectrum{};
     // size_t spectrum_interval_samples = 0;
     // size_t spectrum_samples = 0;
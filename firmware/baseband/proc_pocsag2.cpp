@@ -35,280 +35,6 @@
 
 using namespace std;
 
-namespace {
-/* Count of bits that differ between the two values. */
-uint8_t diff_bit_count(uint32_t left, uint32_t right) {
-    uint32_t diff = left ^ right;
-    uint8_t count = 0;
-    for (size_t i = 0; i < sizeof(diff) * 8; ++i) {
-        if (((diff >> i) & 0x1) == 1)
-            ++count;
-    }
-
-    return count;
-}
-}  // namespace
-
-/* AudioNormalizer ***************************************/
-
-void AudioNormalizer::execute_in_place(const buffer_f32_t& audio) {
-    // Decay min/max every second (@24kHz).
-    if (counter_ >= 24'000) {
-        // 90% decay factor seems to work well.
-        // This keeps large transients from wrecking the filter.
-        max_ *= 0.9f;
-        min_ *= 0.9f;
-        counter_ = 0;
-        calculate_thresholds();
-    }
-
-    counter_ += audio.count;
-
-    for (size_t i = 0; i < audio.count; ++i) {
-        auto& val = audio.p[i];
-
-        if (val > max_) {
-            max_ = val;
-            calculate_thresholds();
-        }
-        if (val < min_) {
-            min_ = val;
-            calculate_thresholds();
-        }
-
-        if (val >= t_hi_)
-            val = 1.0f;
-        else if (val <= t_lo_)
-            val = -1.0f;
-        else
-            val = 0.0;
-    }
-}
-
-void AudioNormalizer::calculate_thresholds() {
-    auto center = (max_ + min_) / 2.0f;
-    auto range = (max_ - min_) / 2.0f;
-
-    // 10% off center force either +/-1.0f.
-    // Higher == larger dead zone.
-    // Lower == more false positives.
-    auto threshold = range * 0.1;
-    t_hi_ = center + threshold;
-    t_lo_ = center - threshold;
-}
-
-/* BitQueue **********************************************/
-
-void BitQueue::push(bool bit) {
-    data_ = (data_ << 1) | (bit ? 1 : 0);
-    if (count_ < max_size_) ++count_;
-}
-
-bool BitQueue::pop() {
-    if (count_ == 0) return false;
-
-    --count_;
-    return (data_ & (1 << count_)) != 0;
-}
-
-void BitQueue::reset() {
-    data_ = 0;
-    count_ = 0;
-}
-
-uint8_t BitQueue::size() const {
-    return count_;
-}
-
-uint32_t BitQueue::data() const {
-    return data_;
-}
-
-/* BitExtractor ******************************************/
-
-void BitExtractor::extract_bits(const buffer_f32_t& audio) {
-    // Assumes input has been normalized +/- 1.0f.
-    // Positive == 0, Negative == 1.
-    for (size_t i = 0; i < audio.count; ++i) {
-        auto sample = audio.p[i];
-
-        if (current_rate_) {
-            if (current_rate_->handle_sample(sample)) {
-                auto value = (current_rate_->bits.data() & 1) == 1;
-                bits_.push(value);
-            }
-        } else {
-            // Feed sample to all known rates for clock detection.
-            for (auto& rate : known_rates_) {
-                if (rate.handle_sample(sample) &&
-                    diff_bit_count(rate.bits.data(), clock_magic_number) <= 3) {
-                    // Clock detected, continue with this rate.
-                    rate.is_stable = true;
-                    current_rate_ = &rate;
-                }
-            }
-        }
-    }
-}
-
-void BitExtractor::configure(uint32_t sample_rate) {
-    sample_rate_ = sample_rate;
-
-    // Build the baud rate info table based on the sample rate.
-    // Sampling at 2x the baud rate to synchronize to bit transitions
-    // without needing to know exact transition boundaries.
-    for (auto& rate : known_rates_)
-        rate.sample_interval = sample_rate / (2.0 * rate.baud_rate);
-
-    if (baud_config_ >= 0 && baud_config_ < static_cast<int8_t>(known_rates_.size())) {
-        current_rate_ = &known_rates_[baud_config_];
-    } else {
-        current_rate_ = nullptr;
-    }
-}
-
-void BitExtractor::reset() {
-    for (auto& rate : known_rates_)
-        rate.reset();
-
-    if (baud_config_ >= 0 && baud_config_ < static_cast<int8_t>(known_rates_.size())) {
-        current_rate_ = &known_rates_[baud_config_];
-    } else {
-        current_rate_ = nullptr;
-    }
-}
-
-void BitExtractor::set_baud_config(int8_t baud_config) {
-    baud_config_ = baud_config;
-}
-
-uint16_t BitExtractor::baud_rate() const {
-    return current_rate_ ? current_rate_->baud_rate : 0;
-}
-
-bool BitExtractor::RateInfo::handle_sample(float sample) {
-    samples_until_next -= 1;
-
-    // Time to process a sample?
-    if (samples_until_next > 0)
-        return false;
-
-    bool value = signbit(sample);  // NB: negative == '1'
-    bool bit_pushed = false;
-
-    switch (state) {
-        case State::WaitForSample:
-            // Just need to wait for the first sample of the bit.
-            state = State::ReadyToSend;
-            break;
-
-        case State::ReadyToSend:
-            if (!is_stable && prev_value != value) {
-                // Still looking for the clock signal but found a transition.
-                // Nudge the next sample a bit to try avoiding pulse edges.
-                samples_until_next += (sample_interval / 8.0);
-            } else {
-                // Either the clock has been found or both samples were
-                // (probably) in the same pulse. Send the bit.
-                // TODO: Wider/more samples for noise reduction?
-                state = State::WaitForSample;
-                bit_pushed = true;
-                bits.push(value);
-            }
-            break;
-    }
-
-    // How long until the next sample?
-    samples_until_next += sample_interval;
-    prev_value = value;
-
-    return bit_pushed;
-}
-
-void BitExtractor::RateInfo::reset() {
-    state = State::WaitForSample;
-    samples_until_next = 0.0;
-    prev_value = false;
-    is_stable = false;
-    bits.reset();
-}
-
-/* CodewordExtractor *************************************/
-
-void CodewordExtractor::process_bits() {
-    // Process all of the bits in the bits queue.
-    while (bits_.size() > 0) {
-        take_one_bit();
-
-        // Wait until data_ is full.
-        if (bit_count_ < data_bit_count)
-            continue;
-
-        // Wait for the sync frame.
-        if (!has_sync_) {
-            if (diff_bit_count(data_, sync_codeword) <= 2)
-                handle_sync(/*inverted=*/false);
-            else if (diff_bit_count(data_, ~sync_codeword) <= 2)
-                handle_sync(/*inverted=*/true);
-            continue;
-        }
-
-        save_current_codeword();
-
-        if (word_count_ == pocsag::batch_size)
-            handle_batch_complete();
-    }
-}
-
-void CodewordExtractor::flush() {
-    // Don't bother flushing if there's no pending data.
-    if (word_count_ == 0) return;
-
-    pad_idle();
-    handle_batch_complete();
-}
-
-void CodewordExtractor::reset() {
-    clear_data_bits();
-    has_sync_ = false;
-    inverted_ = false;
-    word_count_ = 0;
-}
-
-void CodewordExtractor::clear_data_bits() {
-    data_ = 0;
-    bit_count_ = 0;
-}
-
-void CodewordExtractor::take_one_bit() {
-    data_ = (data_ << 1) | bits_.pop();
-    if (bit_count_ < data_bit_count)
-        ++bit_count_;
-}
-
-void CodewordExtractor::handle_sync(bool inverted) {
-    clear_data_bits();
-    has_sync_ = true;
-    inverted_ = inverted;
-    word_count_ = 0;
-}
-
-void CodewordExtractor::save_current_codeword() {
-    batch_[word_count_++] = inverted_ ? ~data_ : data_;
-    clear_data_bits();
-}
-
-void CodewordExtractor::handle_batch_complete() {
-    on_batch_(*this);
-    has_sync_ = false;
-    word_count_ = 0;
-}
-
-void CodewordExtractor::pad_idle() {
-    while (word_count_ < pocsag::batch_size)
-        batch_[word_count_++] = idle_codeword;
-}
-
 /* POCSAGProcessor ***************************************/
 
 void POCSAGProcessor::execute(const buffer_c8_t& buffer) {
@@ -324,10 +50,15 @@ void POCSAGProcessor::execute(const buffer_c8_t& buffer) {
     const auto decim_1_out = decim_1.execute(decim_0_out, dst_buffer);
     const auto channel_out = channel_filter.execute(decim_1_out, dst_buffer);
     auto audio = demod.execute(channel_out, audio_buffer);
+    meter.feed(channel_out);
 
     // Check if there's any signal in the audio buffer.
     bool has_audio = squelch.execute(audio);
     squelch_history = (squelch_history << 1) | (has_audio ? 1 : 0);
+    if (has_audio)
+        idle_samples = 0;
+    else if (idle_samples < baseband_fs)
+        idle_samples += buffer.count;
 
     // Has there been any signal recently?
     if (squelch_history == 0) {
@@ -428,7 +159,14 @@ void POCSAGProcessor::send_packet() {
     packet.set_bitrate(bit_extractor.baud_rate());
     packet.set(word_extractor.batch());
 
-    POCSAGPacketMessage message(packet);
+    const auto baud = bit_extractor.baud_rate();
+    const size_t batch_samples = baud ? (POCSAG_BATCH_LENGTH * channel_fs) / baud : 0;
+    const auto metadata = meter.measure(
+        batch_samples,
+        baseband_thread.sample_index() - idle_samples,
+        idle_samples / channel_decimation);
+
+    POCSAGPacketMessage message(packet, metadata);
     shared_memory.application_queue.push(message);
 }
 
@@ -35,166 +35,15 @@
 #include "dsp_demodulate.hpp"
 #include "dsp_iir_config.hpp"
 #include "message.hpp"
+#include "packet_signal_meter.hpp"
 #include "pocsag.hpp"
+#include "pocsag_decoder.hpp"
 #include "pocsag_packet.hpp"
 #include "portapack_shared_memory.hpp"
 #include "rssi_thread.hpp"
 
 #include <array>
 #include <cstdint>
-#include <functional>
-
-/* Normalizes audio stream to +/-1.0f */
-class AudioNormalizer {
-   public:
-    void execute_in_place(const buffer_f32_t& audio);
-
-   private:
-    void calculate_thresholds();
-
-    uint32_t counter_ = 0;
-    float min_ = 99.0f;
-    float max_ = -99.0f;
-    float t_hi_ = 1.0;
-    float t_lo_ = 1.0;
-};
-
-/* FIFO wrapper over a uint32_t's bits. */
-class BitQueue {
-   public:
-    void push(bool bit);
-    bool pop();
-    void reset();
-    uint8_t size() const;
-    uint32_t data() const;
-
-   private:
-    uint32_t data_ = 0;
-    uint8_t count_ = 0;
-
-    static constexpr uint8_t max_size_ = sizeof(data_) * 8;
-};
-
-/* Extracts bits and bitrate from audio stream. */
-class BitExtractor {
-   public:
-    BitExtractor(BitQueue& bits)
-        : bits_{bits} {}
-
-    void extract_bits(const buffer_f32_t& audio);
-    void configure(uint32_t sample_rate);
-    void reset();
-    void set_baud_config(int8_t baud_config);
-    uint16_t baud_rate() const;
-
-   private:
-    /* Clock signal detection magic number. */
-    static constexpr uint32_t clock_magic_number = 0xAAAAAAAA;
-
-    struct RateInfo {
-        enum class State : uint8_t {
-            WaitForSample,
-            ReadyToSend
-        };
-
-        const int16_t baud_rate = 0;
-        float sample_interval = 0.0;
-
-        State state = State::WaitForSample;
-        float samples_until_next = 0.0;
-        bool prev_value = false;
-        bool is_stable = false;
-        BitQueue bits{};
-
-        /* Updates a rate info with the given sample.
-         * Returns true if the rate info has a new bit in its queue. */
-        bool handle_sample(float sample);
-        void reset();
-    };
-
-    std::array<RateInfo, 3> known_rates_{
-        RateInfo{512},
-        RateInfo{1200},
-        RateInfo{2400}};
-
-    BitQueue& bits_;
-    int8_t baud_config_ = -1;
-    uint32_t sample_rate_ = 0;
-    RateInfo* current_rate_ = nullptr;
-};
-
-/* Extracts codeword batches from the BitQueue. */
-class CodewordExtractor {
-   public:
-    using batch_t = pocsag::batch_t;
-    using batch_handler_t = std::function<void(CodewordExtractor&)>;
-
-    CodewordExtractor(BitQueue& bits, batch_handler_t on_batch)
-        : bits_{bits}, on_batch_{on_batch} {}
-
-    /* Process the BitQueue to extract codeword batches. */
-    void process_bits();
-
-    /* Pad then send any pending frames. */
-    void flush();
-
-    /* Completely reset to prepare for a new message. */
-    void reset();
-
-    /* Gets the underlying batch array. */
-    const batch_t& batch() const { return batch_; }
-
-    /* Gets in-progress codeword. */
-    uint32_t current() const { return data_; }
-
-    /* Gets the count of completed codewords. */
-    uint8_t count() const { return word_count_; }
-
-    /* Returns true if the batch has as sync frame. */
-    bool has_sync() const { return has_sync_; }
-
-   private:
-    /* Sync frame codeword. */
-    static constexpr uint32_t sync_codeword = 0x7cd215d8;
-
-    /* Idle codeword used to pad a 16 codeword "batch". */
-    static constexpr uint32_t idle_codeword = 0x7a89c197;
-
-    /* Number of bits in 'data_' member. */
-    static constexpr uint8_t data_bit_count = sizeof(uint32_t) * 8;
-
-    /* Clears data_ and bit_count_ to prepare for next codeword. */
-    void clear_data_bits();
-
-    /* Pop a bit off the queue and add it to data_. */
-    void take_one_bit();
-
-    /* Handles receiving the sync frame codeword, start of batch. */
-    void handle_sync(bool inverted);
-
-    /* Saves the current codeword in data_ to the batch. */
-    void save_current_codeword();
-
-    /* Sends the batch to the handler, resets for next batch. */
-    void handle_batch_complete();
-
-    /* Fill the rest of the batch with 'idle' codewords. */
-    void pad_idle();
-
-    BitQueue& bits_;
-    batch_handler_t on_batch_{};
-
-    /* When true, sync frame has been received. */
-    bool has_sync_ = false;
-
-    /* When true, bit vales are flipped in the codewords. */
-    bool inverted_ = false;
-
-    uint32_t data_ = 0;
-    uint8_t bit_count_ = 0;
-    uint8_t word_count_ = 0;
-    batch_t batch_{};
-};
 
 /* Processes POCSAG signal into codeword batches. */
 class POCSAGProcessor : public BasebandProcessor {
@@ -207,6 +56,8 @@ class POCSAGProcessor : public BasebandProcessor {
     static constexpr uint8_t stat_update_interval = 10;
     static constexpr uint32_t stat_update_threshold =
         baseband_fs / stat_update_interval;
+    static constexpr size_t channel_decimation = 8 * 8 * 2;
+    static constexpr uint32_t channel_fs = baseband_fs / channel_decimation;
 
     void configure(int8_t baud_config = -1);
     void flush();
@@ -247,6 +98,11 @@ class POCSAGProcessor : public BasebandProcessor {
     /* Attempts to de-noise and normalize signal. */
     AudioNormalizer normalizer{};
 
+    /* Measures each batch on the channel. Batches flushed when the squelch
+     * closes ended idle_samples ago. */
+    PacketSignalMeter meter{};
+    uint32_t idle_samples = 0;
+
     /* Handles writing audio stream to hardware. */
     AudioOutput audio_output{};
 
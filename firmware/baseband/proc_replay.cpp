@@ -27,6 +27,10 @@
 #include "event_m4.hpp"
 
 #include "utility.hpp"
+#include "baseband_profiler.hpp"
+#include "hackrf_hal.hpp"
+
+#include <algorithm>
 
 ReplayProcessor::ReplayProcessor() {
     channel_filter_low_f = taps_200k_decim_1.low_frequency_normalized * 1000000;
@@ -36,6 +40,7 @@ ReplayProcessor::ReplayProcessor() {
     spectrum_samples = 0;
 
     channel_spectrum.set_decimation_factor(1);
+    interpolator.configure(toUType(oversample_rate), 8);
 
     configured = false;
     baseband_thread.start();
@@ -49,19 +54,16 @@ void ReplayProcessor::execute(const buffer_c8_t& buffer) {
 
     // Because this is actually adding samples, alias
     // oversample_rate so the math below is more clear.
-    const size_t interpolation_factor = toUType(oversample_rate);
-
-    // Wrap the IQ data array in a buffer with the correct sample_rate.
-    buffer_c16_t iq_buffer{iq.data(), iq.size(), baseband_fs / interpolation_factor};
-
-    // The IQ data in stream is C16 format and needs to be converted to C8 (N * 2).
-    // The data also needs to be interpolated so the effective sample rate is closer
-    // to 4Mhz. Because interpolation repeats a sample multiple times, fewer bytes
-    // are needed from the source stream in order to fill the buffer (count / oversample).
-    // Together the C16->C8 conversion and the interpolation give the number of
-    // bytes that need to be read from the source stream.
+    const size_t interpolation_factor = interpolator.factor();
+    const size_t input_fs = baseband_fs / interpolation_factor;
+
+    // Interpolation produces interpolation_factor output samples per source sample,
+    // so fewer samples are needed from the stream in order to fill the buffer.
+    // C8 streams are sent as-is, C16 streams are scaled down by the interpolator.
+    const bool c8 = stream->c8_samples();
+    const size_t sample_size = c8 ? sizeof(buffer_c8_t::Type) : sizeof(buffer_c16_t::Type);
     const size_t samples_to_read = buffer.count / interpolation_factor;
-    const size_t bytes_to_read = samples_to_read * sizeof(buffer_c16_t::Type);
+    const size_t bytes_to_read = samples_to_read * sample_size;
 
 #if BUFFER_SIZE_ASSERT
     // Verify the output buffer size is divisible by the interpolation factor.
@@ -69,43 +71,52 @@ void ReplayProcessor::execute(const buffer_c8_t& buffer) {
         chDbgPanic("Output not div.");
 
     // Is the input smaple buffer big enough?
-    if (samples_to_read > iq_buffer.count)
+    if (samples_to_read > iq.size())
         chDbgPanic("IQ buf ovf.");
 #endif
 
-    // Read the C16 IQ data from the source stream.
-    size_t current_bytes_read = stream->read(iq_buffer.p, bytes_to_read);
+    // Interpolate straight out of the stream buffer when the whole block is in it,
+    // otherwise gather it (across a buffer boundary, or short on underrun) into iq.
+    uint8_t* source = reinterpret_cast<uint8_t*>(iq.data());
+    size_t samples_read = samples_to_read;
+    const auto view = stream->view();
 
-    // Compute the number of samples were actually read from the source.
-    size_t samples_read = current_bytes_read / sizeof(buffer_c16_t::Type);
+    if (view.size < bytes_to_read) {
+        // An empty view has already been counted as an underrun.
+        const size_t current_bytes_read = view.size ? stream->read(iq.data(), bytes_to_read) : 0;
 
-    // Write converted source samples to the output buffer with interpolation.
-    for (auto i = 0u; i < samples_read; ++i) {
-        int8_t re_out = iq_buffer.p[i].real() >> 8;
-        int8_t im_out = iq_buffer.p[i].imag() >> 8;
-        auto out_value = buffer_c8_t::Type{re_out, im_out};
+        // Compute the number of samples were actually read from the source.
+        samples_read = current_bytes_read / sample_size;
 
-        // Interpolate sample.
-        for (auto j = 0u; j < interpolation_factor; ++j) {
-            size_t index = i * interpolation_factor + j;
-            buffer.p[index] = out_value;
+        // A short read is an underrun (counted by the stream), send silence rather than stale samples.
+        if (samples_read < samples_to_read)
+            std::fill(source + samples_read * sample_size, source + bytes_to_read, 0);
+    } else {
+        source = view.data;
+    }
 
-#if BUFFER_SIZE_ASSERT
-            // Verify the index is within bounds.
-            if (index >= buffer.count)
-                chDbgPanic("Output bounds");
-#endif
-        }
+    // The interpolator copies its input, so the view can be released right after.
+    const uint32_t interpolate_start = baseband::profile::cycle_count();
+    if (c8) {
+        interpolator.execute(buffer_c8_t{reinterpret_cast<complex8_t*>(source), samples_to_read, input_fs}, buffer);
+    } else {
+        interpolator.execute(buffer_c16_t{reinterpret_cast<complex16_t*>(source), samples_to_read, input_fs}, buffer);
     }
+    interpolate_cycles += baseband::profile::cycle_count() - interpolate_start;
+    if (++interpolate_blocks == interpolate_measure_blocks)
+        check_interpolator_budget(buffer.count);
+
+    if (source == view.data)
+        stream->consume(bytes_to_read);
 
-    // Update tracking stats.
-    bytes_read += current_bytes_read;
+    // Update tracking stats. Progress is in C16 bytes whatever the stream format.
+    bytes_read += samples_read * sizeof(buffer_c16_t::Type);
     spectrum_samples += samples_read * interpolation_factor;
 
     if (spectrum_samples >= spectrum_interval_samples) {
         spectrum_samples -= spectrum_interval_samples;
         channel_spectrum.feed(
-            iq_buffer, channel_filter_low_f,
+            interpolator.last_input(), channel_filter_low_f,
             channel_filter_high_f, channel_filter_transition);
 
         // Inform UI about progress.
@@ -147,9 +158,29 @@ void ReplayProcessor::sample_rate_config(const SampleRateConfigMessage& message)
     oversample_rate = message.oversample_rate;
     baseband_thread.set_sampling_rate(baseband_fs);
 
+    // Fewer taps at high output rates to stay inside the M4 cycle budget, see check_interpolator_budget().
+    const size_t taps_per_phase = (baseband_fs <= 4'000'000) ? 8 : (baseband_fs <= 8'000'000) ? 4 : 2;
+    interpolator.configure(toUType(oversample_rate), taps_per_phase);
+    interpolate_cycles = 0;
+    interpolate_blocks = 0;
+
     spectrum_interval_samples = baseband_fs / spectrum_rate_hz;
 }
 
+// The tap count picked from the rate is a starting point; what the filter
+// actually costs is measured here. Past half the M4's time per block, halve
+// the taps, down to a zero-order hold.
+void ReplayProcessor::check_interpolator_budget(const size_t block_samples) {
+    const uint64_t block_cycles = (uint64_t)block_samples * hackrf::one::base_m4_clk_f / baseband_fs;
+    const uint64_t budget = block_cycles * interpolate_measure_blocks / 2;
+
+    if (interpolate_cycles > budget && interpolator.taps_per_phase() > 1)
+        interpolator.configure(interpolator.factor(), interpolator.taps_per_phase() / 2);
+
+    interpolate_cycles = 0;
+    interpolate_blocks = 0;
+}
+
 void ReplayProcessor::replay_config(const ReplayConfigMessage& message) {
     if (message.config) {
         stream = std::make_unique<StreamOutput>(message.config);
@@ -27,6 +27,7 @@
 #include "baseband_thread.hpp"
 
 #include "spectrum_collector.hpp"
+#include "dsp_interpolate.hpp"
 
 #include "stream_output.hpp"
 
@@ -44,9 +45,14 @@ class ReplayProcessor : public BasebandProcessor {
     size_t baseband_fs = 3072000;
     static constexpr auto spectrum_rate_hz = 50.0f;
 
-    // Holds the read IQ data chunk from the file to send.
+    // Holds the read IQ data chunk from the file to send, C16 or C8.
     std::array<complex16_t, 512> iq{};
 
+    dsp::interpolate::PolyphaseInterpolatorC8 interpolator{};
+    static constexpr size_t interpolate_measure_blocks = 32;
+    uint32_t interpolate_cycles{0};
+    size_t interpolate_blocks{0};
+
     int32_t channel_filter_low_f = 0;
     int32_t channel_filter_high_f = 0;
     int32_t channel_filter_transition = 0;
@@ -63,6 +69,7 @@ class ReplayProcessor : public BasebandProcessor {
 
     void sample_rate_config(const SampleRateConfigMessage& message);
     void replay_config(const ReplayConfigMessage& message);
+    void check_interpolator_budget(const size_t block_samples);
 
     TXProgressMessage txprogress_message{};
     RequestSignalMessage sig_message{RequestSignalMessage::Signal::FillRequest};
@@ -45,6 +45,7 @@ void SondeProcessor::execute(const buffer_c8_t& buffer) {
 
     /* 38.4kHz, 32 samples */
     feed_channel_stats(decimator_out);
+    meter.feed(decimator_out);
 
     for (size_t i = 0; i < decimator_out.count; i++) {
         if (mf.execute_once(decimator_out.p[i])) {
@@ -54,6 +55,20 @@ void SondeProcessor::execute(const buffer_c8_t& buffer) {
     }
 }
 
+void SondeProcessor::meteomodem_handler(const baseband::Packet& packet) {
+    const SondePacketMessage message{sonde::Packet::Type::Meteomodem_unknown, packet, frame_metadata(packet.size() + 32, 9600)};
+    shared_memory.application_queue.push(message);
+}
+
+void SondeProcessor::vaisala_handler(const baseband::Packet& packet) {
+    const SondePacketMessage message{sonde::Packet::Type::Vaisala_RS41_SG, packet, frame_metadata(packet.size() + 32, 4800)};
+    shared_memory.application_queue.push(message);
+}
+
+PacketMetadata SondeProcessor::frame_metadata(const size_t symbols, const size_t symbol_rate) const {
+    return meter.measure(symbols * (38400 / symbol_rate), baseband_thread.sample_index());
+}
+
 void SondeProcessor::on_message(const Message* const msg) {
     switch (msg->id) {
         case Message::ID::RequestSignal:
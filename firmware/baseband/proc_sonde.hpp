@@ -84,6 +84,7 @@
 #include "clock_recovery.hpp"
 #include "symbol_coding.hpp"
 #include "packet_builder.hpp"
+#include "packet_signal_meter.hpp"
 #include "baseband_packet.hpp"
 
 #include "message.hpp"
@@ -138,14 +139,14 @@ class SondeProcessor : public BasebandProcessor {
             const uint_fast8_t sliced_symbol = (raw_symbol >= 0.0f) ? 1 : 0;
             this->packet_builder_fsk_9600_Meteomodem.execute(sliced_symbol);
         }};
-    PacketBuilder<BitPattern, NeverMatch, FixedLength> packet_builder_fsk_9600_Meteomodem{
+    void meteomodem_handler(const baseband::Packet& packet);
+    void vaisala_handler(const baseband::Packet& packet);
+
+    PacketBuilder<BitPattern, NeverMatch, FixedLength, PacketHandler<SondeProcessor, &SondeProcessor::meteomodem_handler>> packet_builder_fsk_9600_Meteomodem{
         {0b00110011001100110101100110110011, 32, 1},
         {},
         {88 * 2 * 8},
-        [this](const baseband::Packet& packet) {
-            const SondePacketMessage message{sonde::Packet::Type::Meteomodem_unknown, packet};
-            shared_memory.application_queue.push(message);
-        }};
+        {this}};
 
     clock_recovery::ClockRecovery<clock_recovery::FixedErrorFilter> clock_recovery_fsk_4800{
         19200,
@@ -155,15 +156,15 @@ class SondeProcessor : public BasebandProcessor {
             const uint_fast8_t sliced_symbol = (raw_symbol >= 0.0f) ? 1 : 0;
             this->packet_builder_fsk_4800_Vaisala.execute(sliced_symbol);
         }};
-    PacketBuilder<BitPattern, NeverMatch, FixedLength> packet_builder_fsk_4800_Vaisala{
+    PacketBuilder<BitPattern, NeverMatch, FixedLength, PacketHandler<SondeProcessor, &SondeProcessor::vaisala_handler>> packet_builder_fsk_4800_Vaisala{
         {0b00001000011011010101001110001000, 32, 1},  // euquiq Header detects 4 of 8 bytes 0x10B6CA11 /this is in raw format) (these bits are not passed at the beginning of packet)
         //{ 0b0000100001101101010100111000100001000100011010010100100000011111, 64, 1 }, //euquiq whole header detection would be 8 bytes.
         {},
         {320 * 8},
-        [this](const baseband::Packet& packet) {
-            const SondePacketMessage message{sonde::Packet::Type::Vaisala_RS41_SG, packet};
-            shared_memory.application_queue.push(message);
-        }};
+        {this}};
+
+    PacketSignalMeter meter{};
+    PacketMetadata frame_metadata(const size_t symbols, const size_t symbol_rate) const;
 
     /* NB: Threads should be the last members in the class definition. */
     BasebandThread baseband_thread{
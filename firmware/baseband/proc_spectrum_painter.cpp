@@ -24,111 +24,101 @@
 #include "dsp_fft.hpp"
 #include "random.hpp"
 
+#include <algorithm>
 #include <cstdint>
+#include <cstdlib>
 #include <memory>
-#include <utility>
-
-// TODO move to class members SpectrumPainterProcessor
-std::unique_ptr<complex16_t[]> current_line_data;
-std::unique_ptr<complex16_t[]> next_line_data;
-uint32_t current_line_index = 0;
-uint32_t current_line_width = 0;
-int32_t current_bw = 0;
 
 std::vector<uint8_t> fifo_data[1 << SpectrumPainterBufferConfigureResponseMessage::fifo_k]{};
 SpectrumPainterFIFO fifo{fifo_data, SpectrumPainterBufferConfigureResponseMessage::fifo_k};
 
-int max_val = 127;
-
 // This is called at 3072000/2048 = 1500Hz
 void SpectrumPainterProcessor::execute(const buffer_c8_t& buffer) {
+    const auto line = lines[playing];
+    const auto length = line_length[playing];
+
     for (uint32_t i = 0; i < buffer.count; i++) {
-        if (current_line_data) {
-            auto data = current_line_data[(current_line_index++ * current_bw / 3072) % current_line_width];
-            buffer.p[i] = {(int8_t)data.real(), (int8_t)data.imag()};
-        } else
+        if (have_line && length)
+            buffer.p[i] = line[(sample_index++ * bw / 3072) % length];
+        else
             buffer.p[i] = {0, 0};
     }
 
-    // Move "next line" into "current line" if set.
-    if (next_line_data) {
-        current_line_data = std::move(next_line_data);
-        next_line_data.reset();
+    // Switch to the next line if it has been rendered.
+    if (next_ready) {
+        playing = playing ^ 1;
+        have_line = true;
+        next_ready = false;
     }
 }
 
-WORKING_AREA(thread_wa, 4096);
+void SpectrumPainterProcessor::render_line(const std::vector<uint8_t>& pixels, complex8_t* line, uint32_t& length) {
+    if (pixels.empty()) {
+        length = 0;
+        return;
+    }
 
-void SpectrumPainterProcessor::run() {
-    int ui = 0;
-    init_genrand(22267);
+    size_t fft_size = 2;
+    while (fft_size < pixels.size() * 2 && fft_size < max_fft_size)
+        fft_size <<= 1;
+    const size_t bins = fft_size / 2;
+    const size_t qu = fft_size / 4;
 
-    while (true) {
-        if (fifo.is_empty() == false && !next_line_data) {
-            std::vector<uint8_t> data;
-            fifo.out(data);
+    if (twiddle_size != fft_size) {
+        ifft_q15_twiddles(twiddles, fft_size);
+        twiddle_size = fft_size;
+    }
 
-            auto picture_width = data.size();
+    for (size_t i = 0; i < fft_size; i++)
+        fft_work[i] = {0, 0};
 
-            auto fft_width = picture_width * 2;
-            auto qu = fft_width / 4;
+    // The picture fills the middle half of the spectrum, fftshifted.
+    for (size_t bin = 0; bin < bins; bin++) {
+        const int32_t bin_power = pixels[bin * pixels.size() / bins];  // 0 to 255
 
-            // TODO: can these be statically allocated?
-            auto v = std::make_unique<complex16_t[]>(fft_width);
-            auto tmp = std::make_unique<complex16_t[]>(fft_width);
+        // Rotate by a random angle in 2 * PI / fft_size steps
+        const size_t bin_phase = genrand_int31() & (fft_size - 1);
+        const auto w = twiddles[bin_phase & (bins - 1)];
+        const int32_t sign = bin_phase < bins ? 1 : -1;
 
-            for (uint32_t fft_index = 0; fft_index < fft_width; fft_index++) {
-                if (fft_index < qu) {
-                } else if (fft_index < qu * 3) {
-                    // TODO: Improve index handling
-                    auto image_index = fft_index - qu;
+        const size_t fftshift_index = bin < qu ? bin + fft_size - qu : bin - qu;
+        fft_work[fftshift_index] = {(int16_t)(sign * w.real() * bin_power / 255), (int16_t)(sign * w.imag() * bin_power / 255)};
+    }
 
-                    auto bin_power = data[image_index];  // 0 to 255
-                    auto bin_phase = genrand_int31();    // 0 to 255
+    ifft_q15(fft_work, fft_size, twiddles);
 
-                    // rotate by random angle
-                    auto phase_cos = (sine_table_i8[((int)(bin_phase + 0x40)) & 0xFF]);  // -127 to 127
-                    auto phase_sin = (sine_table_i8[((int)(bin_phase)) & 0xFF]);
+    // normalize
+    int32_t maximum = 1;
+    for (size_t i = 0; i < fft_size; i++) {
+        maximum = std::max<int32_t>(maximum, std::abs(fft_work[i].real()));
+        maximum = std::max<int32_t>(maximum, std::abs(fft_work[i].imag()));
+    }
 
-                    auto real = (int16_t)((int16_t)phase_cos * bin_power / 255);  // -127 to 127
-                    auto imag = (int16_t)((int16_t)phase_sin * bin_power / 255);  // -127 to 127
+    if (maximum == 1) {  // a black line
+        for (size_t i = 0; i < fft_size; i++)
+            line[i] = {0, 0};
+    } else {
+        for (size_t i = 0; i < fft_size; i++)
+            line[i] = {(int8_t)((int32_t)fft_work[i].real() * 120 / maximum), (int8_t)((int32_t)fft_work[i].imag() * 120 / maximum)};
+    }
 
-                    auto fftshift_index = 0;
-                    if (fft_index < qu * 2)                   // first half (fft_index = qu; fft_index < qu*2)
-                        fftshift_index = fft_index + 2 * qu;  // goes to back
-                    else                                      // 2nd half (fft_index =  qu*2; fft_index < qu*3)
-                        fftshift_index = fft_index - 2 * qu;  // goes to front
+    length = bins;
+}
 
-                    v[fftshift_index] = {real, imag};
-                }
-            }
+WORKING_AREA(thread_wa, 4096);
 
-            ifft<complex16_t>(v.get(), fft_width, tmp.get());
-
-            // normalize
-            int32_t maximum = 1;
-            for (uint32_t i = 0; i < fft_width; i++) {
-                if (v[i].real() > maximum)
-                    maximum = v[i].real();
-                if (v[i].real() < -maximum)
-                    maximum = -v[i].real();
-                if (v[i].imag() > maximum)
-                    maximum = v[i].imag();
-                if (v[i].imag() < -maximum)
-                    maximum = -v[i].imag();
-            }
+void SpectrumPainterProcessor::run() {
+    init_genrand(22267);
 
-            if (maximum == 1) {  // a black line
-                for (uint32_t i = 0; i < fft_width; i++)
-                    v[i] = {0, 0};
-            } else {
-                for (uint32_t i = 0; i < fft_width; i++) {
-                    v[i] = {(int8_t)((int32_t)v[i].real() * 120 / maximum), (int8_t)((int32_t)v[i].imag() * 120 / maximum)};
-                }
-            }
+    while (true) {
+        if (fifo.is_empty() == false && !next_ready) {
+            std::vector<uint8_t> data;
+            fifo.out(data);
 
-            next_line_data = std::move(v);
-            ui++;
+            // Render while the other line is being transmitted.
+            const auto next = playing ^ 1;
+            render_line(data, lines[next], line_length[next]);
+            next_ready = true;
         } else {
             chThdSleepMilliseconds(1);
         }
@@ -139,8 +129,7 @@ void SpectrumPainterProcessor::on_message(const Message* const msg) {
     switch (msg->id) {
         case Message::ID::SpectrumPainterBufferRequestConfigure: {
             const auto message = *reinterpret_cast<const SpectrumPainterBufferConfigureRequestMessage*>(msg);
-            current_line_width = message.width;
-            current_bw = message.bw / 500;
+            bw = message.bw / 500;
 
             if (message.update == false) {
                 SpectrumPainterBufferConfigureResponseMessage response{&fifo};
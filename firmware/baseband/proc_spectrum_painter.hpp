@@ -26,6 +26,9 @@
 #include "baseband_processor.hpp"
 #include "baseband_thread.hpp"
 
+#include <cstdint>
+#include <vector>
+
 class SpectrumPainterProcessor : public BasebandProcessor {
    public:
     void execute(const buffer_c8_t& buffer) override;
@@ -33,7 +36,25 @@ class SpectrumPainterProcessor : public BasebandProcessor {
     void run();
 
    private:
+    /* Lines wider than max_fft_size / 2 pixels are downsampled. */
+    static constexpr size_t max_fft_size = 1024;
+
     bool configured{false};
+    int32_t bw{0};
+
+    /* The worker thread renders into the line that isn't playing and then
+     * sets next_ready; execute() switches lines between buffers. */
+    complex16_t fft_work[max_fft_size]{};
+    complex16_t twiddles[max_fft_size / 2]{};
+    size_t twiddle_size{0};
+    complex8_t lines[2][max_fft_size]{};
+    uint32_t line_length[2]{};
+    volatile uint32_t playing{0};
+    volatile bool next_ready{false};
+    bool have_line{false};
+    uint32_t sample_index{0};
+
+    void render_line(const std::vector<uint8_t>& pixels, complex8_t* line, uint32_t& length);
 
     /* NB: Threads should be the last members in the class definition. */
     BasebandThread baseband_thread{3072000, this, baseband::Direction::Transmit};
@@ -49,6 +49,11 @@ void TestProcessor::execute(const buffer_c8_t& buffer) {
     }
 }
 
+void TestProcessor::payload_handler(const baseband::Packet& packet) {
+    const TestAppPacketMessage message{packet};
+    shared_memory.application_queue.push(message);
+}
+
 int main() {
     EventDispatcher event_dispatcher{std::make_unique<TestProcessor>()};
     event_dispatcher.run();
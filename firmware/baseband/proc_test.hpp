@@ -69,14 +69,13 @@ class TestProcessor : public BasebandProcessor {
             const uint_fast8_t sliced_symbol = (raw_symbol >= 0.0f) ? 1 : 0;
             this->packet_builder_fsk_9600_CC1101.execute(sliced_symbol);
         }};
-    PacketBuilder<BitPattern, NeverMatch, FixedLength> packet_builder_fsk_9600_CC1101{
+    void payload_handler(const baseband::Packet& packet);
+
+    PacketBuilder<BitPattern, NeverMatch, FixedLength, PacketHandler<TestProcessor, &TestProcessor::payload_handler>> packet_builder_fsk_9600_CC1101{
         {0b01010110010110100101101001101010, 32, 1},  // Manchester 0x1337
         {},
         {22 * 8},
-        [this](const baseband::Packet& packet) {
-            const TestAppPacketMessage message{packet};
-            shared_memory.application_queue.push(message);
-        }};
+        {this}};
 
     /* NB: Threads should be the last members in the class definition. */
     BasebandThread baseband_thread{
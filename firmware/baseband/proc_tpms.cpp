@@ -41,6 +41,7 @@ void TPMSProcessor::execute(const buffer_c8_t& buffer) {
 
     /* 307.2kHz, 256 samples */
     feed_channel_stats(decimator_out);
+    meter.feed(decimator_out);
 
     for (size_t i = 0; i < decimator_out.count; i++) {
         if (mf_38k4_1t_19k2.execute_once(decimator_out.p[i])) {
@@ -61,6 +62,25 @@ void TPMSProcessor::execute(const buffer_c8_t& buffer) {
     }
 }
 
+void TPMSProcessor::fsk_19k2_schrader_handler(const baseband::Packet& packet) {
+    const TPMSPacketMessage message{tpms::SignalType::FSK_19k2_Schrader, packet, frame_metadata(packet.size() + 30, 19200.0f)};
+    shared_memory.application_queue.push(message);
+}
+
+void TPMSProcessor::ook_8k192_schrader_handler(const baseband::Packet& packet) {
+    const TPMSPacketMessage message{tpms::SignalType::OOK_8k192_Schrader, packet, frame_metadata(packet.size() + 24, 8192.0f)};
+    shared_memory.application_queue.push(message);
+}
+
+void TPMSProcessor::ook_8k4_schrader_handler(const baseband::Packet& packet) {
+    const TPMSPacketMessage message{tpms::SignalType::OOK_8k4_Schrader, packet, frame_metadata(packet.size() + 32, 8400.0f)};
+    shared_memory.application_queue.push(message);
+}
+
+PacketMetadata TPMSProcessor::frame_metadata(const size_t symbols, const float symbol_rate) const {
+    return meter.measure(symbols * (channel_rate_in / symbol_rate), baseband_thread.sample_index());
+}
+
 void TPMSProcessor::on_message(const Message* const msg) {
     if (msg->id == Message::ID::AudioBeep)
         on_beep_message(*reinterpret_cast<const AudioBeepMessage*>(msg));
@@ -34,6 +34,7 @@
 #include "symbol_coding.hpp"
 #include "packet_builder.hpp"
 #include "baseband_packet.hpp"
+#include "packet_signal_meter.hpp"
 
 #include "ook.hpp"
 
@@ -93,14 +94,15 @@ class TPMSProcessor : public BasebandProcessor {
             const uint_fast8_t sliced_symbol = (raw_symbol >= 0.0f) ? 1 : 0;
             this->packet_builder_fsk_19k2_schrader.execute(sliced_symbol);
         }};
-    PacketBuilder<BitPattern, NeverMatch, FixedLength> packet_builder_fsk_19k2_schrader{
+    void fsk_19k2_schrader_handler(const baseband::Packet& packet);
+    void ook_8k192_schrader_handler(const baseband::Packet& packet);
+    void ook_8k4_schrader_handler(const baseband::Packet& packet);
+
+    PacketBuilder<BitPattern, NeverMatch, FixedLength, PacketHandler<TPMSProcessor, &TPMSProcessor::fsk_19k2_schrader_handler>> packet_builder_fsk_19k2_schrader{
         {0b010101010101010101010101010110, 30, 1},
         {},
         {160},
-        [this](const baseband::Packet& packet) {
-            const TPMSPacketMessage message{tpms::SignalType::FSK_19k2_Schrader, packet};
-            shared_memory.application_queue.push(message);
-        }};
+        {this}};
 
     static constexpr float channel_rate_in = 307200.0f;
     static constexpr size_t channel_decimation = 2;
@@ -111,7 +113,7 @@ class TPMSProcessor : public BasebandProcessor {
     OOKClockRecovery clock_recovery_ook_8k192{
         channel_sample_rate / 8192.0f};
 
-    PacketBuilder<BitPattern, NeverMatch, FixedLength> packet_builder_ook_8k192_schrader{
+    PacketBuilder<BitPattern, NeverMatch, FixedLength, PacketHandler<TPMSProcessor, &TPMSProcessor::ook_8k192_schrader_handler>> packet_builder_ook_8k192_schrader{
         /* Preamble: 11*2, 01*14, 11, 10
          * Payload: 37 Manchester-encoded bits
          * Bit rate: 4096 Hz
@@ -119,15 +121,12 @@ class TPMSProcessor : public BasebandProcessor {
         {0b010101010101010101011110, 24, 0},
         {},
         {37 * 2},
-        [](const baseband::Packet& packet) {
-            const TPMSPacketMessage message{tpms::SignalType::OOK_8k192_Schrader, packet};
-            shared_memory.application_queue.push(message);
-        }};
+        {this}};
 
     OOKClockRecovery clock_recovery_ook_8k4{
         channel_sample_rate / 8400.0f};
 
-    PacketBuilder<BitPattern, NeverMatch, FixedLength> packet_builder_ook_8k4_schrader{
+    PacketBuilder<BitPattern, NeverMatch, FixedLength, PacketHandler<TPMSProcessor, &TPMSProcessor::ook_8k4_schrader_handler>> packet_builder_ook_8k4_schrader{
         /* Preamble: 01*40, 01, 10, 01, 01
          * Payload: 76 Manchester-encoded bits
          * Bit rate: 4200 Hz
@@ -135,10 +134,11 @@ class TPMSProcessor : public BasebandProcessor {
         {0b01010101010101010101010101100101, 32, 0},
         {},
         {76 * 2},
-        [](const baseband::Packet& packet) {
-            const TPMSPacketMessage message{tpms::SignalType::OOK_8k4_Schrader, packet};
-            shared_memory.application_queue.push(message);
-        }};
+        {this}};
+
+    PacketSignalMeter meter{};
+    /* symbols counts preamble and payload, sent at symbol_rate. */
+    PacketMetadata frame_metadata(const size_t symbols, const float symbol_rate) const;
 
     void on_message(const Message* const message);
     void on_beep_message(const AudioBeepMessage& message);
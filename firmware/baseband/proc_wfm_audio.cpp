@@ -24,7 +24,6 @@
 
 #include "portapack_shared_memory.hpp"
 #include "audio_output.hpp"
-#include "dsp_fft.hpp"
 #include "event_m4.hpp"
 #include "audio_dma.hpp"
 
@@ -80,57 +79,10 @@ void WidebandFMAudio::execute(const buffer_c8_t& buffer) {
 
     auto audio_2fs = audio_dec_2.execute(audio_4fs, work_audio_buffer);
 
-    // Input: 96kHz int16_t[64]
-    // audio_spectrum_decimator piles up 256 samples before doing FFT computation
-    // This sends an AudioSpectrum every: sample rate/buffer size/refresh period = 3072000/2048/50 = 30 Hz
-    // When audio_spectrum_timer expires, the audio spectrum computation is triggered
-
-    // 0~3: feed continuous audio
-    // 4~31: ignore, wrap at 31
-
-    audio_spectrum_timer++;
-    if (audio_spectrum_timer == 50) {
-        audio_spectrum_timer = 0;
-        audio_spectrum_state = FEED;
-    }
-
-    switch (audio_spectrum_state) {
-        case FEED:
-            // Convert audio to "complex" just so the FFT can be done :/
-            for (size_t i = 0; i < 64; i++) {
-                complex_audio[i] = {(int16_t)(work_audio_buffer.p[i] / 32), (int16_t)0};
-            }
-            audio_spectrum_decimator.feed(
-                complex_audio_buffer,
-                [this](const buffer_c16_t& data) {
-                    this->post_message(data);
-                });
-            break;
-        case FFT:
-            // Spread the FFT workload in time to avoid making the audio skip
-            // "8" comes from the log2() of the size of audio_spectrum: log2(256) = 8
-            if (fft_step < 8) {
-                fft_c_preswapped(audio_spectrum, fft_step, fft_step + 1);
-                fft_step++;
-            } else {
-                const size_t spectrum_end = spectrum.db.size();
-                for (size_t i = 0; i < spectrum_end; i++) {
-                    // const auto corrected_sample = spectrum_window_hamming_3(audio_spectrum, i);
-                    const auto corrected_sample = audio_spectrum[i];
-                    const auto mag2 = magnitude_squared(corrected_sample * (1.0f / 32768.0f));
-                    const float db = mag2_to_dbv_norm(mag2);
-                    constexpr float mag_scale = 5.0f;
-                    const unsigned int v = (db * mag_scale) + 255.0f;
-                    spectrum.db[i] = std::max(0U, std::min(255U, v));
-                }
-                AudioSpectrumMessage message{&spectrum};
-                shared_memory.application_queue.push(message);
-                audio_spectrum_state = IDLE;
-            }
-            break;
-        default:
-            break;
-    }
+    // Input: 96kHz int16_t[64] (24kHz int16_t[16] for wfmam)
+    // audio_spectrum gathers 256 samples every 50 buffers, then spreads the FFT over the
+    // following buffers. This sends an AudioSpectrum every: 3072000/2048/50 = 30 Hz
+    audio_spectrum.feed(audio_2fs);
 
     /* 96kHz int16_t[64]         for wfm
      * -> FIR filter, <15kHz (0.156fs) pass, >19kHz (0.198fs) stop, gain of 1
@@ -152,13 +104,6 @@ void WidebandFMAudio::execute(const buffer_c8_t& buffer) {
     }
 }
 
-void WidebandFMAudio::post_message(const buffer_c16_t& data) {
-    // This is called when audio_spectrum_decimator is filled up to 256 samples
-    fft_swap(data, audio_spectrum);
-    audio_spectrum_state = FFT;
-    fft_step = 0;
-}
-
 void WidebandFMAudio::on_message(const Message* const message) {
     switch (message->id) {
         case Message::ID::UpdateSpectrum:
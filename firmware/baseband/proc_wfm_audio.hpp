@@ -34,6 +34,7 @@
 
 #include "audio_output.hpp"
 #include "spectrum_collector.hpp"
+#include "audio_spectrum_collector.hpp"
 
 #include <array>
 #include <memory>
@@ -93,11 +94,6 @@ class WidebandFMAudio : public BasebandProcessor {
         (int16_t*)dst.data(),
         sizeof(dst) / sizeof(int16_t)};
 
-    std::array<complex16_t, 64> complex_audio{};
-    const buffer_c16_t complex_audio_buffer{
-        complex_audio.data(),
-        complex_audio.size()};
-
     dsp::decimate::FIRC8xR16x24FS4Decim4 decim_0{};
     // dsp::decimate::FIRC16xR16x16Decim2 decim_1{};   //original condition , before adding wfmam
 
@@ -120,18 +116,8 @@ class WidebandFMAudio : public BasebandProcessor {
 
     AudioOutput audio_output{};
 
-    // For fs=96kHz FFT streaming
-    BlockDecimator<complex16_t, 256> audio_spectrum_decimator{1};
-    std::array<std::complex<float>, 256> audio_spectrum{};
-    uint32_t audio_spectrum_timer{0};
-    enum AudioSpectrumState {
-        IDLE = 0,
-        FEED,
-        FFT
-    };
-    AudioSpectrumState audio_spectrum_state{IDLE};
-    AudioSpectrum spectrum{};
-    uint32_t fft_step{0};
+    // For fs=96kHz FFT streaming. Audio is scaled by 1/32 and normalised to full scale.
+    AudioSpectrumCollector audio_spectrum{50, 1.0f / (32.0f * 32768.0f)};
 
     SpectrumCollector channel_spectrum{};
     size_t spectrum_interval_samples = 0;
@@ -146,7 +132,6 @@ class WidebandFMAudio : public BasebandProcessor {
     void configure_wfm(const WFMConfigureMessage& message);
     void configure_wfmam(const WFMAMConfigureMessage& message);
     void capture_config(const CaptureConfigMessage& message);
-    void post_message(const buffer_c16_t& data);
 };
 
 #endif /*__PROC_WFM_AUDIO_H__*/
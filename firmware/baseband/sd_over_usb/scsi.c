@@ -21,6 +21,7 @@
  */
 
 #include "scsi.h"
+#include "scsi_pipeline.h"
 #include "diskio.h"
 #include <libopencm3/lpc43xx/scu.h>
 #include <libopencm3/lpc43xx/rgu.h>
@@ -35,7 +36,7 @@ void usb_bulk_block_cb(void* user_data, unsigned int bytes_transferred) {
     (void)bytes_transferred;
 }
 
-void usb_send_bulk(void* const data, const uint32_t maximum_length) {
+static void usb_schedule_send_bulk(uint8_t* data, uint32_t maximum_length) {
     usb_bulk_block_done = false;
 
     usb_transfer_schedule_block(
@@ -44,11 +45,9 @@ void usb_send_bulk(void* const data, const uint32_t maximum_length) {
         maximum_length,
         usb_bulk_block_cb,
         NULL);
-
-    while (!usb_bulk_block_done);
 }
 
-void usb_receive_bulk(void* const data, const uint32_t maximum_length) {
+static void usb_schedule_receive_bulk(uint8_t* data, uint32_t maximum_length) {
     usb_bulk_block_done = false;
 
     usb_transfer_schedule_block(
@@ -57,10 +56,39 @@ void usb_receive_bulk(void* const data, const uint32_t maximum_length) {
         maximum_length,
         usb_bulk_block_cb,
         NULL);
+}
 
+static void usb_wait_bulk(void) {
     while (!usb_bulk_block_done);
 }
 
+void usb_send_bulk(void* const data, const uint32_t maximum_length) {
+    usb_schedule_send_bulk(data, maximum_length);
+    usb_wait_bulk();
+}
+
+static bool pipeline_block_read(uint32_t lba, uint8_t* buf, uint32_t n) {
+    return read_block(lba, buf, n);
+}
+
+static bool pipeline_block_write(uint32_t lba, uint8_t* buf, uint32_t n) {
+    return write_block(lba, buf, n);
+}
+
+static const scsi_pipeline_ops_t pipeline_ops = {
+    .block_read = pipeline_block_read,
+    .block_write = pipeline_block_write,
+    .usb_schedule_send = usb_schedule_send_bulk,
+    .usb_schedule_receive = usb_schedule_receive_bulk,
+    .usb_wait = usb_wait_bulk};
+
+/* Each half of the bulk buffer holds one SD transaction: the LPC43xx SDIO
+ * driver chains at most four 4 KiB DMA descriptors, i.e. 32 blocks. */
+static const scsi_pipeline_t pipeline = {
+    .ops = &pipeline_ops,
+    .buffer = usb_bulk_buffer,
+    .half_blocks = USB_BULK_BUFFER_SIZE / 2 / SCSI_BLOCK_SIZE};
+
 void usb_send_csw(msd_cbw_t* msd_cbw_data, uint8_t status) {
     msd_csw_t csw = {
         .signature = MSD_CSW_SIGNATURE,
@@ -209,28 +237,24 @@ static data_request_t decode_data_request(const uint8_t* cmd) {
 uint8_t data_read10(msd_cbw_t* msd_cbw_data) {
     data_request_t req = decode_data_request(msd_cbw_data->cmd_data);
 
-    for (size_t block_index = 0; block_index < req.blk_cnt; block_index++) {
-        read_block(req.first_lba + block_index, &usb_bulk_buffer[0], 1 /* n blocks */);
-        usb_send_bulk(&usb_bulk_buffer[0], 512);
-    }
-
-    return 0;
+    return scsi_pipeline_read(&pipeline, req.first_lba, req.blk_cnt);
 }
 
 uint8_t data_write10(msd_cbw_t* msd_cbw_data) {
     data_request_t req = decode_data_request(msd_cbw_data->cmd_data);
 
-    for (size_t block_index = 0; block_index < req.blk_cnt; block_index++) {
-        usb_receive_bulk(&usb_bulk_buffer[0], 512);
-        write_block(req.first_lba + block_index, &usb_bulk_buffer[0], 1 /* n blocks */);
-    }
-
-    return 0;
+    return scsi_pipeline_write(&pipeline, req.first_lba, req.blk_cnt);
 }
 
-void scsi_command(msd_cbw_t* msd_cbw_data) {
+void scsi_command(msd_cbw_t* msd_cbw) {
     uint8_t status = 1;
 
+    /* The CBW was received into the bulk buffer, which READ10/WRITE10 reuse
+     * in full; keep a copy for the CSW tag. */
+    msd_cbw_t cbw;
+    memcpy(&cbw, msd_cbw, sizeof(msd_cbw_t));
+    msd_cbw_t* msd_cbw_data = &cbw;
+
     switch (msd_cbw_data->cmd_data[0]) {
         case SCSI_CMD_INQUIRY:
             if ((msd_cbw_data->cmd_data[1] & 0b1) && msd_cbw_data->cmd_data[2] == 0x80) {
@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2026
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "scsi_pipeline.h"
+
+static uint8_t* half_buffer(const scsi_pipeline_t* pipeline, uint32_t chunk) {
+    return pipeline->buffer + (chunk & 1) * pipeline->half_blocks * SCSI_BLOCK_SIZE;
+}
+
+static uint32_t chunk_blocks(const scsi_pipeline_t* pipeline, uint32_t chunk, uint32_t blk_cnt) {
+    uint32_t remaining = blk_cnt - chunk * pipeline->half_blocks;
+    return remaining < pipeline->half_blocks ? remaining : pipeline->half_blocks;
+}
+
+uint8_t scsi_pipeline_read(const scsi_pipeline_t* pipeline, uint32_t first_lba, uint32_t blk_cnt) {
+    const scsi_pipeline_ops_t* ops = pipeline->ops;
+    const uint32_t chunks = (blk_cnt + pipeline->half_blocks - 1) / pipeline->half_blocks;
+    bool failed = false;
+
+    if (chunks == 0)
+        return 0;
+
+    failed |= ops->block_read(first_lba, half_buffer(pipeline, 0), chunk_blocks(pipeline, 0, blk_cnt));
+
+    for (uint32_t chunk = 0; chunk < chunks; chunk++) {
+        ops->usb_schedule_send(half_buffer(pipeline, chunk), chunk_blocks(pipeline, chunk, blk_cnt) * SCSI_BLOCK_SIZE);
+
+        /* Fill the other half while this one goes out. */
+        const uint32_t next = chunk + 1;
+        if (next < chunks)
+            failed |= ops->block_read(first_lba + next * pipeline->half_blocks, half_buffer(pipeline, next), chunk_blocks(pipeline, next, blk_cnt));
+
+        ops->usb_wait();
+    }
+
+    return failed ? 1 : 0;
+}
+
+uint8_t scsi_pipeline_write(const scsi_pipeline_t* pipeline, uint32_t first_lba, uint32_t blk_cnt) {
+    const scsi_pipeline_ops_t* ops = pipeline->ops;
+    const uint32_t chunks = (blk_cnt + pipeline->half_blocks - 1) / pipeline->half_blocks;
+    bool failed = false;
+
+    if (chunks == 0)
+        return 0;
+
+    ops->usb_schedule_receive(half_buffer(pipeline, 0), chunk_blocks(pipeline, 0, blk_cnt) * SCSI_BLOCK_SIZE);
+    ops->usb_wait();
+
+    for (uint32_t chunk = 0; chunk < chunks; chunk++) {
+        /* Receive into the other half while this one is written. */
+        const uint32_t next = chunk + 1;
+        if (next < chunks)
+            ops->usb_schedule_receive(half_buffer(pipeline, next), chunk_blocks(pipeline, next, blk_cnt) * SCSI_BLOCK_SIZE);
+
+        failed |= ops->block_write(first_lba + chunk * pipeline->half_blocks, half_buffer(pipeline, chunk), chunk_blocks(pipeline, chunk, blk_cnt));
+
+        if (next < chunks)
+            ops->usb_wait();
+    }
+
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2026
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __SCSI_PIPELINE_H__
+#define __SCSI_PIPELINE_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SCSI_BLOCK_SIZE 512
+
+/* READ10/WRITE10 move data through two halves of a buffer: while the SD card
+ * fills or drains one half, the USB controller works on the other.
+ * The block callbacks are blocking and return true on failure (like sdcRead),
+ * the USB callbacks only schedule a transfer and usb_wait blocks until the
+ * scheduled one has finished. Only one USB transfer is ever in flight.
+ */
+typedef struct {
+    bool (*block_read)(uint32_t lba, uint8_t* buf, uint32_t n);
+    bool (*block_write)(uint32_t lba, uint8_t* buf, uint32_t n);
+    void (*usb_schedule_send)(uint8_t* data, uint32_t length);
+    void (*usb_schedule_receive)(uint8_t* data, uint32_t length);
+    void (*usb_wait)(void);
+} scsi_pipeline_ops_t;
+
+typedef struct {
+    const scsi_pipeline_ops_t* ops;
+    uint8_t* buffer;
+    uint32_t half_blocks;
+} scsi_pipeline_t;
+
+/* Returns the CSW status: 0 on success, 1 if any SD transfer failed. The data
+ * phase always runs to completion so the host and device stay in step. */
+uint8_t scsi_pipeline_read(const scsi_pipeline_t* pipeline, uint32_t first_lba, uint32_t blk_cnt);
+uint8_t scsi_pipeline_write(const scsi_pipeline_t* pipeline, uint32_t first_lba, uint32_t blk_cnt);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SCSI_PIPELINE_H__ */
@@ -22,6 +22,9 @@
 
 #include "stream_output.hpp"
 
+#include <algorithm>
+#include <cstring>
+
 #include "lpc43xx_cpp.hpp"
 using namespace lpc43xx;
 
@@ -46,31 +49,66 @@ size_t StreamOutput::read(void* const data, const size_t length) {
     size_t read = 0;
 
     while (read < length) {
-        if (!active_buffer) {
-            // We need a full buffer...
-            if (!fifo_buffers_full.out(active_buffer)) {
-                // ...but none are available. Hole in transmission (inform app and stop ?)
-                break;
-            }
-        }
+        const auto next = view();
+        if (next.size == 0)
+            break;
 
-        const auto remaining = length - read;
-        read += active_buffer->read(&p[read], remaining);
-
-        if (active_buffer->is_empty()) {
-            if (!fifo_buffers_empty.in(active_buffer)) {
-                // Empty buffers FIFO is already full.
-                // This should never happen if the number of buffers is less
-                // than the capacity of the FIFO.
-                break;
-            }
-            // Tell M0 (IRQ) that a buffer has been consumed.
-            active_buffer = nullptr;
-            creg::m4txevent::assert_event();
-        }
+        const auto count = std::min(next.size, length - read);
+        memcpy(&p[read], next.data, count);
+        active_buffer->skip(count);
+        read += count;
+
+        if (!release_if_empty())
+            break;
     }
 
     config->baseband_bytes_received += length;
 
     return read;
 }
+
+StreamView StreamOutput::view() {
+    if (active_buffer && !release_if_empty())
+        return {nullptr, 0};
+
+    if (!active_buffer) {
+        // We need a full buffer...
+        if (!fifo_buffers_full.out(active_buffer)) {
+            // ...but none are available. Hole in transmission, counted for the app,
+            // unless the source has simply run out.
+            if (!config->end_of_stream)
+                config->underruns++;
+            return {nullptr, 0};
+        }
+    }
+
+    return {active_buffer->read_data(), active_buffer->size()};
+}
+
+void StreamOutput::consume(const size_t length) {
+    if (!active_buffer)
+        return;
+
+    active_buffer->skip(length);
+    release_if_empty();
+
+    config->baseband_bytes_received += length;
+}
+
+bool StreamOutput::release_if_empty() {
+    if (!active_buffer->is_empty())
+        return true;
+
+    if (!fifo_buffers_empty.in(active_buffer)) {
+        // Empty buffers FIFO is already full.
+        // This should never happen if the number of buffers is less
+        // than the capacity of the FIFO.
+        config->overruns++;
+        return false;
+    }
+
+    // Tell M0 (IRQ) that a buffer has been consumed.
+    active_buffer = nullptr;
+    creg::m4txevent::assert_event();
+    return true;
+}
@@ -31,6 +31,13 @@
 #include <array>
 #include <memory>
 
+/* Unread bytes of the StreamBuffer at the head of the stream. They stay
+ * valid until StreamOutput::consume() moves past them. */
+struct StreamView {
+    uint8_t* data;
+    size_t size;
+};
+
 class StreamOutput {
    public:
     StreamOutput(ReplayConfig* const config);
@@ -42,7 +49,20 @@ class StreamOutput {
 
     size_t read(void* const data, const size_t length);
 
+    /* Zero-copy access: view() returns the unread part of the current buffer
+     * (empty, and counted as an underrun before end of stream, if no filled buffer is available)
+     * and consume() marks bytes of it as used. A buffer goes back to the M0
+     * once all of it has been consumed. */
+    StreamView view();
+    void consume(const size_t length);
+
+    bool c8_samples() const { return config->c8_samples; }
+    uint32_t underruns() const { return config->underruns; }
+    uint32_t overruns() const { return config->overruns; }
+
    private:
+    bool release_if_empty();
+
     static constexpr size_t buffer_count_max_log2 = 3;
     static constexpr size_t buffer_count_max = 1U << buffer_count_max_log2;
 
@@ -1,6 +1,7 @@
 # FATFS files.
 set(FATFSSRC
 	${CHIBIOS_PORTAPACK}/os/various/fatfs_bindings/fatfs_diskio.c
+	${CHIBIOS_PORTAPACK}/os/various/fatfs_bindings/fatfs_cache.c
 	${CHIBIOS_PORTAPACK}/os/various/fatfs_bindings/fatfs_syscall.c
 	${CHIBIOS_PORTAPACK}/ext/fatfs/src/ff.c
 	${CHIBIOS_PORTAPACK}/ext/fatfs/src/option/unicode.c
@@ -8,4 +9,5 @@ set(FATFSSRC
 
 set(FATFSINC
 	${CHIBIOS_PORTAPACK}/ext/fatfs/src
+	${CHIBIOS_PORTAPACK}/os/various/fatfs_bindings
 )
@@ -0,0 +1,264 @@
+/*
+ * Copyright (C) 2026
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "fatfs_cache.h"
+
+#include <string.h>
+
+typedef struct {
+  uint32_t sector;
+  uint32_t last_use;
+  bool valid;
+  bool dirty;
+} cache_slot_t;
+
+static const fatfs_cache_ops_t *cache_ops;
+static cache_slot_t slots[FATFS_CACHE_SLOTS];
+static uint8_t slot_data[FATFS_CACHE_SLOTS][FATFS_CACHE_SECTOR_SIZE] __attribute__((aligned(4)));
+static uint32_t use_clock;
+
+/* Also the staging buffer for coalesced writes, which empties it. */
+static uint8_t readahead_data[FATFS_CACHE_READAHEAD * FATFS_CACHE_SECTOR_SIZE] __attribute__((aligned(4)));
+static uint32_t readahead_first;
+static uint32_t readahead_count;
+
+static uint32_t next_sequential;
+static fatfs_cache_stats_t stats;
+
+static bool in_range(uint32_t sector, uint32_t first, uint32_t count) {
+  return sector >= first && sector - first < count;
+}
+
+static cache_slot_t *find_slot(uint32_t sector) {
+  for (int i = 0; i < FATFS_CACHE_SLOTS; i++) {
+    if (slots[i].valid && slots[i].sector == sector)
+      return &slots[i];
+  }
+  return NULL;
+}
+
+static uint8_t *slot_buffer(const cache_slot_t *slot) {
+  return slot_data[slot - slots];
+}
+
+/* Copies the newest data of any cached sector in the range into buf. */
+static void overlay_slots(uint8_t *buf, uint32_t sector, uint32_t count) {
+  for (int i = 0; i < FATFS_CACHE_SLOTS; i++) {
+    if (slots[i].valid && in_range(slots[i].sector, sector, count))
+      memcpy(buf + (slots[i].sector - sector) * FATFS_CACHE_SECTOR_SIZE, slot_data[i], FATFS_CACHE_SECTOR_SIZE);
+  }
+}
+
+/* Keeps cached copies of sectors written around the slots up to date. */
+static void update_copies(const uint8_t *buf, uint32_t sector, uint32_t count, bool clean) {
+  for (int i = 0; i < FATFS_CACHE_SLOTS; i++) {
+    if (slots[i].valid && in_range(slots[i].sector, sector, count)) {
+      memcpy(slot_data[i], buf + (slots[i].sector - sector) * FATFS_CACHE_SECTOR_SIZE, FATFS_CACHE_SECTOR_SIZE);
+      if (clean)
+        slots[i].dirty = false;
+    }
+  }
+  for (uint32_t s = sector; s < sector + count; s++) {
+    if (in_range(s, readahead_first, readahead_count))
+      memcpy(readahead_data + (s - readahead_first) * FATFS_CACHE_SECTOR_SIZE,
+             buf + (s - sector) * FATFS_CACHE_SECTOR_SIZE, FATFS_CACHE_SECTOR_SIZE);
+  }
+}
+
+/* Returns a free or least recently used slot, writing it back if dirty. */
+static cache_slot_t *evict_slot(void) {
+  cache_slot_t *victim = &slots[0];
+  for (int i = 0; i < FATFS_CACHE_SLOTS; i++) {
+    if (!slots[i].valid)
+      return &slots[i];
+    if (slots[i].last_use < victim->last_use)
+      victim = &slots[i];
+  }
+
+  if (victim->dirty) {
+    if (cache_ops->write(victim->sector, slot_buffer(victim), 1))
+      return NULL;
+    stats.write_backs++;
+  }
+  victim->valid = false;
+  return victim;
+}
+
+static bool read_ahead(uint32_t sector) {
+  uint32_t count = FATFS_CACHE_READAHEAD;
+  const uint32_t capacity = cache_ops->sector_count();
+  if (sector >= capacity)
+    return true;
+  if (capacity - sector < count)
+    count = capacity - sector;
+
+  readahead_count = 0;
+  if (cache_ops->read(sector, readahead_data, count))
+    return true;
+
+  overlay_slots(readahead_data, sector, count);
+  readahead_first = sector;
+  readahead_count = count;
+  stats.readaheads++;
+  return false;
+}
+
+static bool read_single(uint8_t *buf, uint32_t sector) {
+  const bool sequential = (sector == next_sequential);
+  next_sequential = sector + 1;
+
+  cache_slot_t *slot = find_slot(sector);
+  if (slot) {
+    slot->last_use = ++use_clock;
+    memcpy(buf, slot_buffer(slot), FATFS_CACHE_SECTOR_SIZE);
+    stats.hits++;
+    return false;
+  }
+
+  if (in_range(sector, readahead_first, readahead_count)) {
+    memcpy(buf, readahead_data + (sector - readahead_first) * FATFS_CACHE_SECTOR_SIZE, FATFS_CACHE_SECTOR_SIZE);
+    stats.hits++;
+    stats.readahead_hits++;
+    return false;
+  }
+
+  stats.misses++;
+
+  /* Streams go through the read-ahead so they don't push FAT and
+   * directory sectors out of the slots. */
+  if (sequential && FATFS_CACHE_READAHEAD > 1 && !read_ahead(sector)) {
+    memcpy(buf, readahead_data, FATFS_CACHE_SECTOR_SIZE);
+    return false;
+  }
+
+  slot = evict_slot();
+  if (!slot)
+    return true;
+  if (cache_ops->read(sector, slot_buffer(slot), 1))
+    return true;
+
+  slot->sector = sector;
+  slot->valid = true;
+  slot->dirty = false;
+  slot->last_use = ++use_clock;
+  memcpy(buf, slot_buffer(slot), FATFS_CACHE_SECTOR_SIZE);
+  return false;
+}
+
+static bool write_single(const uint8_t *buf, uint32_t sector) {
+  cache_slot_t *slot = find_slot(sector);
+  if (slot) {
+    stats.write_hits++;
+  } else {
+    slot = evict_slot();
+    if (!slot)
+      return true;
+    slot->sector = sector;
+    slot->valid = true;
+  }
+
+  slot->dirty = true;
+  slot->last_use = ++use_clock;
+  memcpy(slot_buffer(slot), buf, FATFS_CACHE_SECTOR_SIZE);
+  update_copies(buf, sector, 1, false);
+  return false;
+}
+
+void fatfs_cache_init(const fatfs_cache_ops_t *ops) {
+  cache_ops = ops;
+  memset(slots, 0, sizeof(slots));
+  use_clock = 0;
+  readahead_count = 0;
+  next_sequential = UINT32_MAX;
+}
+
+bool fatfs_cache_read(uint8_t *buf, uint32_t sector, uint32_t count) {
+  if (count == 1)
+    return read_single(buf, sector);
+
+  if (cache_ops->read(sector, buf, count))
+    return true;
+  overlay_slots(buf, sector, count);
+  next_sequential = sector + count;
+  return false;
+}
+
+bool fatfs_cache_write(const uint8_t *buf, uint32_t sector, uint32_t count) {
+  if (count == 1)
+    return write_single(buf, sector);
+
+  if (cache_ops->write(sector, buf, count))
+    return true;
+  update_copies(buf, sector, count, true);
+  return false;
+}
+
+bool fatfs_cache_flush(void) {
+  bool flushed = false;
+
+  for (;;) {
+    /* Lowest dirty sector first, then extend the run while the next
+     * sector is dirty too. */
+    cache_slot_t *first = NULL;
+    for (int i = 0; i < FATFS_CACHE_SLOTS; i++) {
+      if (slots[i].valid && slots[i].dirty && (!first || slots[i].sector < first->sector))
+        first = &slots[i];
+    }
+    if (!first)
+      break;
+
+    if (!flushed) {
+      flushed = true;
+      stats.flushes++;
+    }
+
+    cache_slot_t *run[FATFS_CACHE_READAHEAD > 1 ? FATFS_CACHE_READAHEAD : 1];
+    uint32_t length = 1;
+    run[0] = first;
+    while (length < FATFS_CACHE_READAHEAD) {
+      cache_slot_t *next = find_slot(first->sector + length);
+      if (!next || !next->dirty)
+        break;
+      run[length++] = next;
+    }
+
+    if (length == 1) {
+      if (cache_ops->write(first->sector, slot_buffer(first), 1))
+        return true;
+    } else {
+      readahead_count = 0;
+      for (uint32_t i = 0; i < length; i++)
+        memcpy(readahead_data + i * FATFS_CACHE_SECTOR_SIZE, slot_buffer(run[i]), FATFS_CACHE_SECTOR_SIZE);
+      if (cache_ops->write(first->sector, readahead_data, length))
+        return true;
+      stats.coalesced++;
+    }
+
+    for (uint32_t i = 0; i < length; i++)
+      run[i]->dirty = false;
+  }
+
+  return false;
+}
+
+const fatfs_cache_stats_t *fatfs_cache_stats(void) {
+  return &stats;
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2026
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*-----------------------------------------------------------------------*/
+/* Sector cache between FatFs and the block driver.                      */
+/*                                                                       */
+/* Single sector reads and writes, which is how FatFs touches FAT and    */
+/* directory sectors and partial file sectors, go through a small LRU of */
+/* write-back slots. A single sector read that continues the previous    */
+/* one is upgraded into a multi-block read-ahead. Dirty slots are only   */
+/* written out on eviction or on fatfs_cache_flush(), which coalesces    */
+/* runs of consecutive sectors into multi-block writes. Multi-sector     */
+/* transfers bypass the cache but stay coherent with it.                 */
+/*-----------------------------------------------------------------------*/
+
+#ifndef __FATFS_CACHE_H__
+#define __FATFS_CACHE_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define FATFS_CACHE_SECTOR_SIZE 512
+
+#if !defined(FATFS_CACHE_SLOTS)
+#define FATFS_CACHE_SLOTS 4
+#endif
+
+#if !defined(FATFS_CACHE_READAHEAD)
+#define FATFS_CACHE_READAHEAD 4
+#endif
+
+/* Block device callbacks. read and write return true on failure. */
+typedef struct {
+  bool (*read)(uint32_t sector, uint8_t *buf, uint32_t count);
+  bool (*write)(uint32_t sector, const uint8_t *buf, uint32_t count);
+  uint32_t (*sector_count)(void);
+} fatfs_cache_ops_t;
+
+typedef struct {
+  uint32_t hits;            /* Single sector reads served from a slot or the read-ahead. */
+  uint32_t misses;          /* Single sector reads that went to the card. */
+  uint32_t readaheads;      /* Multi-block reads issued for sequential single reads. */
+  uint32_t readahead_hits;  /* Hits served by the read-ahead buffer. */
+  uint32_t write_hits;      /* Single sector writes absorbed by a slot. */
+  uint32_t write_backs;     /* Dirty slots written out on eviction. */
+  uint32_t flushes;         /* fatfs_cache_flush() calls with dirty slots. */
+  uint32_t coalesced;       /* Multi-block writes issued by flushes. */
+} fatfs_cache_stats_t;
+
+/* Binds the cache to a device and drops everything cached, dirty or not. */
+void fatfs_cache_init(const fatfs_cache_ops_t *ops);
+
+/* All of these return true on failure, like the block driver. */
+bool fatfs_cache_read(uint8_t *buf, uint32_t sector, uint32_t count);
+bool fatfs_cache_write(const uint8_t *buf, uint32_t sector, uint32_t count);
+bool fatfs_cache_flush(void);
+
+const fatfs_cache_stats_t *fatfs_cache_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __FATFS_CACHE_H__ */
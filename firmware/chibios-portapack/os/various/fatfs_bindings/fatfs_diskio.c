@@ -13,6 +13,7 @@
 #include <string.h>
 
 #include "diskio.h"
+#include "fatfs_cache.h"
 
 #if HAL_USE_MMC_SPI && HAL_USE_SDC
 #error "cannot specify both MMC_SPI and SDC drivers"
@@ -35,6 +36,26 @@ extern RTCDriver RTCD1;
 #define MMC     0
 #define SDC     0
 
+#if HAL_USE_SDC
+static bool sdc_cache_read(uint32_t sector, uint8_t *buf, uint32_t count) {
+  return sdcRead(&SDCD1, sector, buf, count);
+}
+
+static bool sdc_cache_write(uint32_t sector, const uint8_t *buf, uint32_t count) {
+  return sdcWrite(&SDCD1, sector, buf, count);
+}
+
+static uint32_t sdc_cache_sector_count(void) {
+  return mmcsdGetCardCapacity(&SDCD1);
+}
+
+static const fatfs_cache_ops_t sdc_cache_ops = {
+  sdc_cache_read,
+  sdc_cache_write,
+  sdc_cache_sector_count
+};
+#endif
+
 
 /*-----------------------------------------------------------------------*/
 /* Get Drive Status                                                      */
@@ -100,6 +121,8 @@ DSTATUS disk_initialize (
       stat |= STA_NOINIT;
     if (sdcIsWriteProtected(&SDCD1))
       stat |= STA_PROTECT;
+    /* Called when a volume is mounted, possibly on a different card.*/
+    fatfs_cache_init(&sdc_cache_ops);
     return stat;
 #endif
   }
@@ -139,7 +162,7 @@ DRESULT disk_read (
   case SDC:
     if (blkGetDriverState(&SDCD1) != BLK_READY)
       return RES_NOTRDY;
-    if (sdcRead(&SDCD1, sector, buff, count))
+    if (fatfs_cache_read(buff, sector, count))
       return RES_ERROR;
     return RES_OK;
 #endif
@@ -182,7 +205,7 @@ DRESULT disk_write (
   case SDC:
     if (blkGetDriverState(&SDCD1) != BLK_READY)
       return RES_NOTRDY;
-    if (sdcWrite(&SDCD1, sector, buff, count))
+    if (fatfs_cache_write(buff, sector, count))
       return RES_ERROR;
     return RES_OK;
 #endif
@@ -229,6 +252,10 @@ DRESULT disk_ioctl (
   case SDC:
     switch (cmd) {
     case CTRL_SYNC:
+        if (blkGetDriverState(&SDCD1) != BLK_READY)
+          return RES_NOTRDY;
+        if (fatfs_cache_flush())
+          return RES_ERROR;
         return RES_OK;
     case GET_SECTOR_COUNT:
         *((DWORD *)buff) = mmcsdGetCardCapacity(&SDCD1);
@@ -0,0 +1,150 @@
+/*
+ * Copyright (C) 2026
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __BASEBAND_PROFILE_H__
+#define __BASEBAND_PROFILE_H__
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include <algorithm>
+
+namespace baseband {
+namespace profile {
+
+/* Processing stages timed per baseband block. Execute covers the whole
+ * processor execute() call and is filled for every image.
+ */
+enum class Stage : uint8_t {
+    Execute = 0,
+    Decim0,
+    Decim1,
+    ChannelFilter,
+    Demod,
+    Spectrum,
+    AudioOutput,
+    Count
+};
+
+constexpr size_t stage_count = static_cast<size_t>(Stage::Count);
+
+constexpr std::array<const char*, stage_count> stage_names{
+    "execute",
+    "decim_0",
+    "decim_1",
+    "channel_filter",
+    "demod",
+    "spectrum",
+    "audio_output",
+};
+
+/* Quarter-octave histogram: bucket 0 holds everything below 2^bucket_min_log2
+ * cycles, the last bucket everything from its lower bound up. */
+constexpr size_t bucket_min_log2 = 6;
+constexpr size_t buckets_per_octave = 4;
+constexpr size_t bucket_count = 1 + 14 * buckets_per_octave;
+
+struct StageStats {
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;
+    std::array<uint16_t, bucket_count> histogram;
+};
+
+struct Profile {
+    std::array<StageStats, stage_count> stages;
+};
+
+constexpr size_t bucket_index(const uint32_t cycles) {
+    if (cycles < (1U << bucket_min_log2)) return 0;
+
+    const size_t log2 = 31 - __builtin_clz(cycles);
+    const size_t fraction = (cycles >> (log2 - 2)) & (buckets_per_octave - 1);
+    return std::min(1 + (log2 - bucket_min_log2) * buckets_per_octave + fraction, bucket_count - 1);
+}
+
+/* Exclusive upper bound of a bucket. */
+constexpr uint32_t bucket_upper(const size_t index) {
+    if (index == 0) return 1U << bucket_min_log2;
+
+    const size_t log2 = (index - 1) / buckets_per_octave + bucket_min_log2;
+    const size_t fraction = (index - 1) % buckets_per_octave;
+    return (1U << log2) + ((fraction + 1) << (log2 - 2));
+}
+
+inline void reset(StageStats& stats) {
+    stats.count = 0;
+    stats.min = UINT32_MAX;
+    stats.max = 0;
+    stats.total = 0;
+    stats.histogram.fill(0);
+}
+
+inline void reset(Profile& profile) {
+    for (auto& stats : profile.stages) {
+        reset(stats);
+    }
+}
+
+inline void record(StageStats& stats, const uint32_t cycles) {
+    stats.count++;
+    stats.total += cycles;
+    stats.min = std::min(stats.min, cycles);
+    stats.max = std::max(stats.max, cycles);
+
+    auto& bucket = stats.histogram[bucket_index(cycles)];
+    if (bucket == UINT16_MAX) {
+        /* Halve everything instead of saturating so the shape stays usable. */
+        for (auto& b : stats.histogram) {
+            b >>= 1;
+        }
+    }
+    bucket++;
+}
+
+inline uint32_t mean(const StageStats& stats) {
+    return stats.count ? stats.total / stats.count : 0;
+}
+
+/* Upper bound of the bucket holding the given percentile, capped at max. */
+inline uint32_t percentile(const StageStats& stats, const uint32_t percent) {
+    uint32_t samples = 0;
+    for (const auto b : stats.histogram) {
+        samples += b;
+    }
+    if (samples == 0) return 0;
+
+    const uint32_t target = (samples * percent + 99) / 100;
+    uint32_t cumulative = 0;
+    for (size_t i = 0; i < bucket_count; i++) {
+        cumulative += stats.histogram[i];
+        if (cumulative >= target) {
+            return (i == bucket_count - 1) ? stats.max : std::min(bucket_upper(i), stats.max);
+        }
+    }
+    return stats.max;
+}
+
+} /* namespace profile */
+} /* namespace baseband */
+
+#endif /*__BASEBAND_PROFILE_H__*/
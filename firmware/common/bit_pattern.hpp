@@ -52,12 +52,17 @@ class BitPattern {
         const size_t code_length,
         const size_t maximum_hanning_distance = 0)
         : code_{code},
-          mask_{(1ULL << code_length) - 1ULL},
+          mask_{(code_length >= 64) ? ~0ULL : (1ULL << code_length) - 1ULL},
           maximum_hanning_distance_{maximum_hanning_distance} {
     }
 
     bool operator()(const BitHistory& history, const size_t) const {
-        const auto delta_bits = (history.value() ^ code_) & mask_;
+        return matches(history.value());
+    }
+
+    /* Whole sync word against the shift register in one XOR and popcount. */
+    bool matches(const uint64_t history) const {
+        const auto delta_bits = (history ^ code_) & mask_;
         const size_t count = __builtin_popcountll(delta_bits);
         return (count <= maximum_hanning_distance_);
     }
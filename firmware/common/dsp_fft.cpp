@@ -21,3 +21,46 @@
 
 #include "dsp_fft.hpp"
 #include "complex.hpp"
+
+#include <cmath>
+#include <utility>
+
+void ifft_q15_twiddles(complex16_t* w, size_t n) {
+    for (size_t m = 0; m < n / 2; m++) {
+        const float angle = 2.0f * pi * m / n;
+        w[m] = {(int16_t)std::lround(std::cos(angle) * 32767.0f),
+                (int16_t)std::lround(std::sin(angle) * 32767.0f)};
+    }
+}
+
+void ifft_q15(complex16_t* v, size_t n, const complex16_t* w) {
+    /* Bit reversed reordering, so the butterflies can work in place. */
+    for (size_t i = 1, j = 0; i < n; i++) {
+        size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1)
+            j ^= bit;
+        j |= bit;
+        if (i < j)
+            std::swap(v[i], v[j]);
+    }
+
+    for (size_t len = 2, stride = n / 2; len <= n; len <<= 1, stride >>= 1) {
+        const size_t half = len / 2;
+        for (size_t i = 0; i < n; i += len) {
+            for (size_t k = 0; k < half; k++) {
+                const auto tw = w[k * stride];
+                auto& a = v[i + k];
+                auto& b = v[i + k + half];
+
+                /* Rounded Q15 product, then both outputs halved. */
+                const int32_t t_re = ((int32_t)tw.real() * b.real() - (int32_t)tw.imag() * b.imag() + (1 << 14)) >> 15;
+                const int32_t t_im = ((int32_t)tw.real() * b.imag() + (int32_t)tw.imag() * b.real() + (1 << 14)) >> 15;
+                const int32_t a_re = a.real();
+                const int32_t a_im = a.imag();
+
+                a = {(int16_t)((a_re + t_re) >> 1), (int16_t)((a_im + t_im) >> 1)};
+                b = {(int16_t)((a_re - t_re) >> 1), (int16_t)((a_im - t_im) >> 1)};
+            }
+        }
+    }
+}
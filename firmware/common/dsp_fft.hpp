@@ -133,6 +133,19 @@ void fft_c_preswapped(std::array<T, N>& data, const size_t from, const size_t to
     }
 }
 
+/* Split stage of a real input FFT. Pack 2N real samples as
+ * z[n] = x[2n] + i*x[2n+1] and run an N point complex FFT on z to get Z;
+ * this returns bin k < N of the 2N point FFT of x. w is exp(-i*PI*k/N). */
+template <typename T, size_t N>
+T fft_r_split_bin(const std::array<T, N>& Z, const size_t k, const T w) {
+    static_assert(power_of_two(N), "only defined for N == power of two");
+    const T a = Z[k];
+    const T b = std::conj(Z[(N - k) & (N - 1)]);
+    const T even{(a.real() + b.real()) * 0.5f, (a.imag() + b.imag()) * 0.5f};
+    const T odd{(a.imag() - b.imag()) * 0.5f, (b.real() - a.real()) * 0.5f};
+    return even + w * odd;
+}
+
 /*
    ifft(v,N):
    [0] If N==1 then return.
@@ -174,4 +187,13 @@ void ifft(T* v, int n, T* tmp) {
     return;
 }
 
+/* Q15 twiddle factors for an n point inverse FFT: w[m] = exp(2*PI*i*m/n) for
+ * m < n/2. Compute once per size and pass to ifft_q15(). */
+void ifft_q15_twiddles(complex16_t* w, size_t n);
+
+/* In-place iterative radix-2 inverse FFT on n (a power of two) Q15 points.
+ * Every stage halves its outputs, so the result is the inverse DFT divided
+ * by n and can't overflow as long as no input exceeds a magnitude of 32767. */
+void ifft_q15(complex16_t* v, size_t n, const complex16_t* w);
+
 #endif /*__DSP_FFT_H__*/
@@ -73,6 +73,7 @@ class Packet {
     TamperFlags tamper_flags() const;
 
     FormattedSymbols symbols_formatted() const;
+    size_t symbols_packed(uint8_t* const data, uint8_t* const errors, const size_t capacity) const;
 
     bool crc_ok() const;
 
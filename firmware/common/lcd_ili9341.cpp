@@ -35,6 +35,7 @@ using namespace portapack;
 
 #include "portapack_persistent_memory.hpp"
 
+#include <algorithm>
 #include <complex>
 
 #include <cstring>
@@ -743,10 +744,12 @@ void ILI9341::draw_bitmap(
         if (ui::Color::magenta().v != background.v) {
             lcd_start_ram_write(p, size);
 
+            const auto fg = io.lcd_output_color(foreground);
+            const auto bg = io.lcd_output_color(background);
             const size_t count = size.width() * size.height();
             for (size_t i = 0; i < count; i++) {
                 const auto pixel = pixels[i >> 3] & (1U << (i & 0x7));
-                io.lcd_write_pixel(pixel ? foreground : background);
+                io.lcd_write_output_pixel(pixel ? fg : bg);
             }
         } else {
             // transparent bg
@@ -802,6 +805,32 @@ void ILI9341::draw_glyph(
     draw_bitmap(p, glyph.size(), glyph.pixels(), foreground, background, zoom_level);
 }
 
+void ILI9341::draw_glyph_run(
+    const ui::Point p,
+    const ui::GlyphRun& run) {
+    draw_glyph_run(p, run, screen_rect());
+}
+
+void ILI9341::draw_glyph_run(
+    const ui::Point p,
+    const ui::GlyphRun& run,
+    const ui::Rect clip) {
+    const auto r_clipped = ui::Rect{p, run.size()}.intersect(clip).intersect(screen_rect());
+    if (r_clipped.is_empty()) return;
+
+    lcd_start_ram_write(r_clipped);
+
+    // Rows wider than the buffer are streamed in pieces, the window stays the same.
+    std::array<ui::Color, 64> line;
+    for (int y = r_clipped.top(); y < r_clipped.bottom(); y++) {
+        for (int x = r_clipped.left(); x < r_clipped.right(); x += line.size()) {
+            const int count = std::min<int>(line.size(), r_clipped.right() - x);
+            run.render_scanline(y - p.y(), x - p.x(), count, line.data());
+            io.lcd_write_pixels(line.data(), count);
+        }
+    }
+}
+
 void ILI9341::scroll_set_area(
     const ui::Coord top_y,
     const ui::Coord bottom_y) {
@@ -106,6 +106,17 @@ class ILI9341 {
         const ui::Color background,
         uint8_t zoom_level = 1);
 
+    /* Draws a whole text run through one address window. Background must be opaque. */
+    void draw_glyph_run(
+        const ui::Point p,
+        const ui::GlyphRun& run);
+
+    /* Same, limited to the part of the run inside clip. */
+    void draw_glyph_run(
+        const ui::Point p,
+        const ui::GlyphRun& run,
+        const ui::Rect clip);
+
     /*** Scrolling ***
      * Scrolling support is implemented in the ILI9341 driver. Basically a region
      * of the screen is set up to act as a circular buffer. The VSA (vertical scroll
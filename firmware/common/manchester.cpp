@@ -23,6 +23,8 @@
 
 #include "string_format.hpp"
 
+#include <algorithm>
+
 size_t ManchesterBase::symbols_count() const {
     return packet.size() / 2;
 }
@@ -80,6 +82,26 @@ FormattedSymbols format_symbols(
     return {hex_data, hex_error};
 }
 
+size_t pack_symbols(
+    const ManchesterBase& decoder,
+    uint8_t* const data,
+    uint8_t* const errors,
+    const size_t capacity) {
+    const size_t symbols = std::min((decoder.symbols_count() + 3) & ~size_t(3), capacity * 8);
+    const size_t bytes = (symbols + 7) / 8;
+    std::fill(data, data + bytes, 0);
+    std::fill(errors, errors + bytes, 0);
+
+    for (size_t i = 0; i < symbols; i++) {
+        const auto symbol = decoder[i];
+        const uint8_t mask = 0x80 >> (i & 7);
+        if (symbol.value) data[i >> 3] |= mask;
+        if (symbol.error) errors[i >> 3] |= mask;
+    }
+
+    return symbols;
+}
+
 void manchester_encode(uint8_t* dest, uint8_t* src, const size_t length, const size_t sense) {
     uint8_t part = sense ? 0 : 0xFF;
 
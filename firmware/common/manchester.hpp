@@ -79,6 +79,14 @@ struct FormattedSymbols {
 FormattedSymbols format_symbols(
     const ManchesterBase& decoder);
 
+/* Packs decoded symbols MSB-first into data/errors, rounded up to whole
+ * nibbles like format_symbols(). Returns the number of symbols packed. */
+size_t pack_symbols(
+    const ManchesterBase& decoder,
+    uint8_t* const data,
+    uint8_t* const errors,
+    const size_t capacity);
+
 void manchester_encode(uint8_t* dest, uint8_t* src, const size_t length, const size_t sense = 0);
 
 #endif /*__MANCHESTER_H__*/
@@ -31,6 +31,7 @@
 #include <algorithm>
 
 #include "baseband_packet.hpp"
+#include "packet_metadata.hpp"
 
 #include "adsb_frame.hpp"
 #include "ert_packet.hpp"
@@ -146,6 +147,11 @@ class Message {
         SSTVRXPhaseSlant = 88,
         SSTVRXCalibration = 89,
         SubCarData = 90,
+        ChannelActivityConfig = 91,
+        ChannelActivity = 92,
+        NFMChannelizerConfigure = 93,
+        NFMChannelEvent = 94,
+        AISConfigure = 95,
         MAX
     };
 
@@ -300,6 +306,128 @@ class WidebandSpectrumConfigMessage : public Message {
     size_t trigger{0};
 };
 
+class ChannelActivityConfigMessage : public Message {
+   public:
+    static constexpr size_t max_channels = 32;
+
+    constexpr ChannelActivityConfigMessage(
+        const uint32_t config_id,
+        const uint32_t channel_bandwidth,
+        const int32_t threshold_db)
+        : Message{ID::ChannelActivityConfig},
+          config_id{config_id},
+          channel_bandwidth{channel_bandwidth},
+          threshold_db{threshold_db} {
+    }
+
+    uint32_t config_id;
+    uint32_t channel_bandwidth;
+    int32_t threshold_db;
+    /* Channel offsets in Hz relative to the tuned frequency. 0 channels disables measurement. */
+    size_t channel_count{0};
+    std::array<int32_t, max_channels> offsets{};
+};
+
+struct ChannelActivity {
+    uint32_t config_id{0};
+    /* Bit n set when channel n peak power is above the configured threshold. */
+    uint32_t active{0};
+    size_t channel_count{0};
+    std::array<int8_t, ChannelActivityConfigMessage::max_channels> db{};
+};
+
+class ChannelActivityMessage : public Message {
+   public:
+    constexpr ChannelActivityMessage(
+        const ChannelActivity& activity)
+        : Message{ID::ChannelActivity},
+          activity{activity} {
+    }
+
+    ChannelActivity activity;
+};
+
+class NFMChannelizerConfigureMessage : public Message {
+   public:
+    static constexpr size_t channel_count = 32;
+
+    constexpr NFMChannelizerConfigureMessage(
+        const uint32_t sampling_rate,
+        const uint32_t deviation,
+        const int32_t squelch_db,
+        const int32_t monitor_channel)
+        : Message{ID::NFMChannelizerConfigure},
+          sampling_rate{sampling_rate},
+          deviation{deviation},
+          squelch_db{squelch_db},
+          monitor_channel{monitor_channel} {
+    }
+
+    /* Channel spacing is sampling_rate / 8 / channel_count. */
+    uint32_t sampling_rate;
+    uint32_t deviation;
+    /* Open threshold above each channel's noise floor. */
+    int32_t squelch_db;
+    /* Channel sent to the audio output, outside -16..15 mutes audio. */
+    int32_t monitor_channel;
+};
+
+struct NFMChannelEvent {
+    /* Channel number relative to the tuned frequency, -16..15. */
+    int8_t channel{0};
+    bool active{false};
+    int8_t db{0};
+    int8_t snr{0};
+    /* Mean carrier offset from the channel center, filled on close. */
+    int32_t offset_hz{0};
+    uint32_t duration_ms{0};
+    /* Last CTCSS (0.01 Hz) or DCS (9 bit code) decoded on the channel, filled on close. */
+    enum class Code : uint8_t {
+        None,
+        CTCSS,
+        DCS,
+    };
+    Code code_type{Code::None};
+    bool code_inverted{false};
+    uint16_t code_value{0};
+};
+
+/* Discriminator audio of the channels holding a voice slot, multiplexed over
+ * the capture stream. Frames are fixed size so they never straddle a
+ * StreamBuffer; samples run at half the channel rate.
+ */
+struct NFMChannelAudioFrame {
+    static constexpr uint8_t magic_value = 0xA5;
+    static constexpr size_t sample_count = 29;
+    /* Channels decoded and recorded at the same time. */
+    static constexpr size_t slot_count = 4;
+
+    enum Flags : uint8_t {
+        Start = 1,
+        End = 2,
+    };
+
+    uint8_t magic{magic_value};
+    uint8_t slot{0};
+    int8_t channel{0};
+    uint8_t flags{0};
+    uint8_t count{0};
+    uint8_t reserved{0};
+    std::array<int16_t, sample_count> samples{};
+};
+static_assert(sizeof(NFMChannelAudioFrame) == 64, "NFMChannelAudioFrame must divide the capture write size");
+
+class NFMChannelEventMessage : public Message {
+   public:
+    constexpr NFMChannelEventMessage(
+        const NFMChannelEvent& event)
+        : Message{ID::NFMChannelEvent},
+          event{event} {
+    }
+
+    NFMChannelEvent event;
+};
+
 struct AudioSpectrum {
     std::array<uint8_t, 128> db{{0}};
     // uint32_t sampling_rate { 0 };
@@ -341,49 +469,82 @@ class ChannelSpectrumConfigMessage : public Message {
 
 class AISPacketMessage : public Message {
    public:
+    enum class Channel : uint8_t {
+        Tuned,  // Single channel mode, whatever the receiver is tuned to
+        AIS1,   // 161.975 MHz (87B)
+        AIS2,   // 162.025 MHz (88B)
+    };
+
     constexpr AISPacketMessage(
-        const baseband::Packet& packet)
+        const baseband::Packet& packet,
+        const Channel channel = Channel::Tuned,
+        const PacketMetadata& metadata = {})
         : Message{ID::AISPacket},
-          packet{packet} {
+          packet{packet},
+          channel{channel},
+          metadata{metadata} {
     }
 
     baseband::Packet packet;
+    Channel channel;
+    PacketMetadata metadata;
+};
+
+class AISConfigureMessage : public Message {
+   public:
+    constexpr AISConfigureMessage(
+        const bool dual_channel)
+        : Message{ID::AISConfigure},
+          dual_channel{dual_channel} {
+    }
+
+    /* Receiver tuned to 162.000 MHz, both AIS channels decoded at +/-25 kHz. */
+    bool dual_channel;
 };
 
 class EPIRBPacketMessage : public Message {
    public:
     constexpr EPIRBPacketMessage(
-        const baseband::Packet& packet)
+        const baseband::Packet& packet,
+        const PacketMetadata& metadata = {})
         : Message{ID::EPIRBPacket},
-          packet{packet} {
+          packet{packet},
+          metadata{metadata} {
     }
 
     baseband::Packet packet;
+    PacketMetadata metadata;
 };
 
 class TPMSPacketMessage : public Message {
    public:
     constexpr TPMSPacketMessage(
         const tpms::SignalType signal_type,
-        const baseband::Packet& packet)
+        const baseband::Packet& packet,
+        const PacketMetadata& metadata = {})
         : Message{ID::TPMSPacket},
           signal_type{signal_type},
-          packet{packet} {
+          packet{packet},
+          metadata{metadata} {
     }
 
     tpms::SignalType signal_type;
     baseband::Packet packet;
+    PacketMetadata metadata;
 };
 
 class POCSAGPacketMessage : public Message {
    public:
     constexpr POCSAGPacketMessage(
-        const pocsag::POCSAGPacket& packet)
+        const pocsag::POCSAGPacket& packet,
+        const PacketMetadata& metadata = {})
         : Message{ID::POCSAGPacket},
-          packet{packet} {
+          packet{packet},
+          metadata{metadata} {
     }
 
     pocsag::POCSAGPacket packet;
+    PacketMetadata metadata;
 };
 
 class POCSAGStatsMessage : public Message {
@@ -420,14 +581,17 @@ class ADSBFrameMessage : public Message {
    public:
     constexpr ADSBFrameMessage(
         const adsb::ADSBFrame& frame,
-        const uint32_t amp)
+        const uint32_t amp,
+        const PacketMetadata& metadata = {})
         : Message{ID::ADSBFrame},
           frame{frame},
-          amp(amp) {
+          amp(amp),
+          metadata{metadata} {
     }
 
     adsb::ADSBFrame frame;
     uint32_t amp;
+    PacketMetadata metadata;
 };
 
 class AFSKDataMessage : public Message {
@@ -510,13 +674,28 @@ class FSKRxPacketMessage : public Message {
 
 class CodedSquelchMessage : public Message {
    public:
+    enum class Type : uint8_t {
+        CTCSS,
+        DCS,
+    };
+
     constexpr CodedSquelchMessage(
-        const uint32_t value)
+        const uint32_t value,
+        const Type type = Type::CTCSS,
+        const bool inverted = false,
+        const uint8_t confidence = 0)
         : Message{ID::CodedSquelch},
-          value{value} {
+          value{value},
+          type{type},
+          inverted{inverted},
+          confidence{confidence} {
     }
 
+    /* CTCSS: tone in 0.01 Hz. DCS: 9 bit code. */
     uint32_t value;
+    Type type;
+    bool inverted;
+    uint8_t confidence;  // 0..100
 };
 
 class ShutdownMessage : public Message {
@@ -530,41 +709,50 @@ class ERTPacketMessage : public Message {
    public:
     constexpr ERTPacketMessage(
         const ert::Packet::Type type,
-        const baseband::Packet& packet)
+        const baseband::Packet& packet,
+        const PacketMetadata& metadata = {})
         : Message{ID::ERTPacket},
           type{type},
-          packet{packet} {
+          packet{packet},
+          metadata{metadata} {
     }
 
     ert::Packet::Type type;
 
     baseband::Packet packet;
+    PacketMetadata metadata;
 };
 
 class SondePacketMessage : public Message {
    public:
     constexpr SondePacketMessage(
         const sonde::Packet::Type type,
-        const baseband::Packet& packet)
+        const baseband::Packet& packet,
+        const PacketMetadata& metadata = {})
         : Message{ID::SondePacket},
           type{type},
-          packet{packet} {
+          packet{packet},
+          metadata{metadata} {
     }
 
     sonde::Packet::Type type;
 
     baseband::Packet packet;
+    PacketMetadata metadata;
 };
 
 class TestAppPacketMessage : public Message {
    public:
     constexpr TestAppPacketMessage(
-        const baseband::Packet& packet)
+        const baseband::Packet& packet,
+        const PacketMetadata& metadata = {})
         : Message{ID::TestAppPacket},
-          packet{packet} {
+          packet{packet},
+          metadata{metadata} {
     }
 
     baseband::Packet packet;
+    PacketMetadata metadata;
 };
 
 class UpdateSpectrumMessage : public Message {
@@ -727,6 +915,15 @@ class StreamBuffer {
         return copy_size;
     }
 
+    /* The unread bytes, as consumed by read(). */
+    uint8_t* read_data() const {
+        return &data_[capacity_ - used_];
+    }
+
+    void skip(const size_t count) {
+        used_ -= std::min(used_, count);
+    }
+
     bool is_full() const {
         return used_ >= capacity_;
     }
@@ -799,16 +996,28 @@ class CaptureConfigMessage : public Message {
 struct ReplayConfig {
     const size_t read_size;
     const size_t buffer_count;
+    /* Stream carries C8 samples instead of C16. */
+    const bool c8_samples;
     uint64_t baseband_bytes_received;
+    /* Reads that found no full buffer (SD too slow), and buffers that couldn't be returned. */
+    uint32_t underruns;
+    uint32_t overruns;
+    /* Set by the application once the source has no more data; reads past it aren't underruns. */
+    bool end_of_stream;
     FIFO<StreamBuffer*>* fifo_buffers_empty;
     FIFO<StreamBuffer*>* fifo_buffers_full;
 
     constexpr ReplayConfig(
         const size_t read_size,
-        const size_t buffer_count)
+        const size_t buffer_count,
+        const bool c8_samples = false)
         : read_size{read_size},
           buffer_count{buffer_count},
+          c8_samples{c8_samples},
           baseband_bytes_received{0},
+          underruns{0},
+          overruns{0},
+          end_of_stream{false},
           fifo_buffers_empty{nullptr},
           fifo_buffers_full{nullptr} {
     }
@@ -1262,12 +1471,15 @@ class POCSAGConfigureMessage : public Message {
 class APRSPacketMessage : public Message {
    public:
     constexpr APRSPacketMessage(
-        const aprs::APRSPacket& packet)
+        const aprs::APRSPacket& packet,
+        const PacketMetadata& metadata = {})
         : Message{ID::APRSPacket},
-          packet{packet} {
+          packet{packet},
+          metadata{metadata} {
     }
 
     aprs::APRSPacket packet;
+    PacketMetadata metadata;
 };
 
 class ADSBConfigureMessage : public Message {
@@ -0,0 +1,52 @@
+/*
+ * Copyright (C) 2026
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __PACKET_METADATA_H__
+#define __PACKET_METADATA_H__
+
+#include <cstdint>
+
+/* Reception details measured on the M4 when a decoder completes a frame,
+ * carried with the decoded packet to the application. */
+struct PacketMetadata {
+    static constexpr int8_t db_unknown = -128;
+    static constexpr int32_t frequency_offset_unknown = INT32_MIN;
+
+    /* Baseband samples received since the baseband thread started, up to
+     * the end of the frame. Differences give the time between frames with
+     * sample accuracy at the processor's baseband sampling rate. */
+    uint64_t sample_index{0};
+    /* Mean carrier offset over the frame in Hz, relative to the channel
+     * center. */
+    int32_t frequency_offset{frequency_offset_unknown};
+    /* Mean frame power in dB relative to full scale. */
+    int8_t rssi{db_unknown};
+    /* Frame power over the channel noise floor in dB. */
+    int8_t snr{db_unknown};
+    uint16_t reserved{0};
+
+    constexpr bool has_rssi() const { return rssi != db_unknown; }
+    constexpr bool has_snr() const { return snr != db_unknown; }
+    constexpr bool has_frequency_offset() const { return frequency_offset != frequency_offset_unknown; }
+};
+static_assert(sizeof(PacketMetadata) == 16);
+
+#endif /*__PACKET_METADATA_H__*/
@@ -27,6 +27,7 @@
 
 #include <cstdint>
 #include <cstddef>
+#include <algorithm>
 #include <array>
 
 #include "platform.hpp"
@@ -202,6 +203,7 @@ class IO {
         if (dark_cover_enabled) {
             pixel.v = DARKENED_PIXEL(pixel.v, brightness);
         }
+        pixels_written_++;
         lcd_write_data(pixel.v);
     }
 
@@ -209,12 +211,31 @@ class IO {
         return lcd_read_data();
     }
 
-    void lcd_write_pixels(ui::Color pixel, size_t n) {
+    /* Colour as it goes out on the bus, for loops that write it many times. */
+    ui::Color lcd_output_color(ui::Color pixel) const {
         if (dark_cover_enabled) {
             pixel.v = DARKENED_PIXEL(pixel.v, brightness);
         }
+        return pixel;
+    }
+
+    /* Writes a colour already passed through lcd_output_color(). */
+    void lcd_write_output_pixel(const ui::Color pixel) {
+        pixels_written_++;
+        lcd_write_data(pixel.v);
+    }
+
+    void lcd_write_pixels(ui::Color pixel, size_t n) {
+        const auto v = lcd_output_color(pixel).v;
+        pixels_written_ += n;
+        for (; n >= 4; n -= 4) {
+            lcd_write_data(v);
+            lcd_write_data(v);
+            lcd_write_data(v);
+            lcd_write_data(v);
+        }
         while (n--) {
-            lcd_write_data(pixel.v);
+            lcd_write_data(v);
         }
     }
 
@@ -223,6 +244,7 @@ class IO {
             pixel.v = DARKENED_PIXEL(pixel.v, brightness);
         }
         auto v = pixel.v;
+        pixels_written_ += n & ~7;
         n >>= 3;
         while (n--) {
             lcd_write_data(v);
@@ -236,9 +258,36 @@ class IO {
         }
     }
 
+    /* Streams a prepared buffer into the window set up by the caller. The
+     * dark cover test is made once; when it is on, pixels are darkened a
+     * chunk at a time, two per 32-bit word, ahead of the bus loop.
+     */
     void lcd_write_pixels(const ui::Color* const pixels, size_t n) {
-        for (size_t i = 0; i < n; i++) {
-            lcd_write_pixel(pixels[i]);
+        pixels_written_ += n;
+        if (!dark_cover_enabled) {
+            lcd_stream_pixels(pixels, n);
+            return;
+        }
+
+        std::array<ui::Color, 64> chunk;
+        for (size_t i = 0; i < n; i += chunk.size()) {
+            const size_t count = std::min(chunk.size(), n - i);
+            darken_pixels(&pixels[i], chunk.data(), count, brightness);
+            lcd_stream_pixels(chunk.data(), count);
+        }
+    }
+
+    static void darken_pixels(const ui::Color* const src, ui::Color* const dst, const size_t n, const uint8_t shift) {
+        const uint32_t mask = darken_mask[shift] * 0x00010001U;
+        size_t i = 0;
+        for (; i + 2 <= n; i += 2) {
+            const uint32_t pair = (uint32_t(src[i + 1].v) << 16) | src[i].v;
+            const uint32_t dark = (pair >> shift) & mask;
+            dst[i].v = dark;
+            dst[i + 1].v = dark >> 16;
+        }
+        if (i < n) {
+            dst[i].v = DARKENED_PIXEL(src[i].v, shift);
         }
     }
 
@@ -266,6 +315,11 @@ class IO {
 
     uint32_t io_update(const TouchPinsConfig write_value);
 
+    /* Pixels pushed over the LCD bus since boot, wraps around. */
+    uint32_t lcd_pixels_written() const {
+        return pixels_written_;
+    }
+
     uint32_t lcd_te() {
         return gpio_rot_a.read();
     }
@@ -275,6 +329,8 @@ class IO {
     }
 
    private:
+    uint32_t pixels_written_{0};
+
     const GPIO gpio_dir;
     const GPIO gpio_lcd_rdx;
     const GPIO gpio_lcd_wrx;
@@ -424,6 +480,19 @@ class IO {
         lcd_wr_deassert(); /* Complete write operation */
     }
 
+    void lcd_stream_pixels(const ui::Color* const pixels, const size_t n) {
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            lcd_write_data(pixels[i + 0].v);
+            lcd_write_data(pixels[i + 1].v);
+            lcd_write_data(pixels[i + 2].v);
+            lcd_write_data(pixels[i + 3].v);
+        }
+        for (; i < n; i++) {
+            lcd_write_data(pixels[i].v);
+        }
+    }
+
     uint32_t lcd_read_data() {
         dir_read();
         /* Start read operation */
@@ -27,6 +27,7 @@
 #include <cstddef>
 
 #include "message_queue.hpp"
+#include "baseband_profile.hpp"
 
 struct JammerChannel {
     bool enabled;
@@ -85,6 +86,10 @@ struct SharedMemory {
     uint16_t volatile m4_stack_usage{0};
     uint32_t volatile m4_heap_usage{0};
     uint16_t volatile m4_buffer_missed{0};
+
+    // Per-stage cycle histograms written by the M4, cleared on image start or on request.
+    uint8_t volatile request_m4_profile_reset{0};
+    baseband::profile::Profile m4_profile{};
 };
 
 extern SharedMemory& shared_memory;
@@ -0,0 +1,190 @@
+/*
+ * Copyright (C) 2026
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "reed_solomon.hpp"
+
+#include <array>
+#include <cstring>
+
+namespace reed_solomon {
+
+namespace {
+
+/* exp is doubled so products of two logs index it without a modulo. */
+struct GaloisTables {
+    std::array<uint8_t, 512> exp{};
+    std::array<uint8_t, 256> log{};
+
+    constexpr GaloisTables() {
+        uint32_t x = 1;
+        for (size_t i = 0; i < 255; i++) {
+            exp[i] = x;
+            exp[i + 255] = x;
+            log[x] = i;
+            x <<= 1;
+            if (x & 0x100) x ^= 0x11D;
+        }
+        exp[510] = exp[0];
+        exp[511] = exp[1];
+    }
+};
+
+constexpr GaloisTables gf{};
+
+uint8_t gf_mul(const uint8_t a, const uint8_t b) {
+    return (a && b) ? gf.exp[gf.log[a] + gf.log[b]] : 0;
+}
+
+uint8_t gf_div(const uint8_t a, const uint8_t b) {
+    return a ? gf.exp[gf.log[a] + 255 - gf.log[b]] : 0;
+}
+
+/* alpha^e for any non-negative e. */
+uint8_t pow_alpha(const size_t e) {
+    return gf.exp[e % 255];
+}
+
+/* p(x) at x, coefficients low order first. */
+uint8_t evaluate(const uint8_t* const p, const size_t count, const uint8_t x) {
+    uint8_t result = 0;
+    for (size_t i = count; i > 0; i--) {
+        result = gf_mul(result, x) ^ p[i - 1];
+    }
+    return result;
+}
+
+}  // namespace
+
+void RS255::encode(uint8_t* const cw) const {
+    /* g(x) = prod (x - alpha^(first_root + j)), low order first. */
+    std::array<uint8_t, parity_max + 1> g{};
+    g[0] = 1;
+    for (size_t j = 0; j < parity_; j++) {
+        const uint8_t root = pow_alpha(first_root_ + j);
+        for (size_t i = j + 1; i > 0; i--) {
+            g[i] = g[i - 1] ^ gf_mul(g[i], root);
+        }
+        g[0] = gf_mul(g[0], root);
+    }
+
+    /* Remainder of m(x) * x^parity divided by g(x), long division from the top. */
+    std::array<uint8_t, parity_max> r{};
+    for (size_t i = n; i > parity_; i--) {
+        const uint8_t feedback = cw[i - 1] ^ r[parity_ - 1];
+        for (size_t k = parity_ - 1; k > 0; k--) {
+            r[k] = r[k - 1] ^ gf_mul(feedback, g[k]);
+        }
+        r[0] = gf_mul(feedback, g[0]);
+    }
+    std::memcpy(cw, r.data(), parity_);
+}
+
+int RS255::decode(uint8_t* const cw) const {
+    std::array<uint8_t, parity_max> syndromes{};
+    bool clean = true;
+    for (size_t j = 0; j < parity_; j++) {
+        syndromes[j] = evaluate(cw, n, pow_alpha(first_root_ + j));
+        clean = clean && (syndromes[j] == 0);
+    }
+    if (clean) return 0;
+
+    /* Berlekamp-Massey: shortest LFSR lambda(x) generating the syndromes. */
+    std::array<uint8_t, parity_max + 1> lambda{};
+    std::array<uint8_t, parity_max + 1> prev{};
+    std::array<uint8_t, parity_max + 1> temp{};
+    lambda[0] = 1;
+    prev[0] = 1;
+    size_t length = 0;
+    size_t shift = 1;
+    uint8_t prev_discrepancy = 1;
+
+    for (size_t k = 0; k < parity_; k++) {
+        uint8_t discrepancy = syndromes[k];
+        for (size_t i = 1; i <= length; i++) {
+            discrepancy ^= gf_mul(lambda[i], syndromes[k - i]);
+        }
+
+        if (discrepancy == 0) {
+            shift++;
+            continue;
+        }
+
+        const uint8_t scale = gf_div(discrepancy, prev_discrepancy);
+        temp = lambda;
+        for (size_t i = 0; i + shift <= parity_; i++) {
+            lambda[i + shift] ^= gf_mul(scale, prev[i]);
+        }
+
+        if (2 * length <= k) {
+            length = k + 1 - length;
+            prev = temp;
+            prev_discrepancy = discrepancy;
+            shift = 1;
+        } else {
+            shift++;
+        }
+    }
+
+    if (length > parity_ / 2) return -1;
+
+    /* Chien search: an error at position i makes lambda(alpha^-i) zero. */
+    std::array<uint8_t, parity_max / 2> positions{};
+    size_t found = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (evaluate(lambda.data(), length + 1, pow_alpha(255 - i)) == 0) {
+            if (found == length) return -1;
+            positions[found++] = i;
+        }
+    }
+    if (found != length) return -1;
+
+    /* Forney: omega(x) = S(x) lambda(x) mod x^parity, and
+     * e = X^(1 - first_root) omega(X^-1) / lambda'(X^-1).
+     */
+    std::array<uint8_t, parity_max> omega{};
+    for (size_t i = 0; i < parity_; i++) {
+        for (size_t j = 0; j <= i && j <= length; j++) {
+            omega[i] ^= gf_mul(syndromes[i - j], lambda[j]);
+        }
+    }
+
+    std::array<uint8_t, parity_max / 2> magnitudes{};
+    for (size_t e = 0; e < found; e++) {
+        const uint8_t x_inv = pow_alpha(255 - positions[e]);
+
+        uint8_t derivative = 0;
+        for (size_t i = 1; i <= length; i += 2) {
+            derivative ^= gf_mul(lambda[i], pow_alpha(gf.log[x_inv] * (i - 1)));
+        }
+        if (derivative == 0) return -1;
+
+        const uint8_t numerator = gf_mul(evaluate(omega.data(), parity_, x_inv),
+                                      pow_alpha(positions[e] * (256 - first_root_)));
+        magnitudes[e] = gf_div(numerator, derivative);
+    }
+
+    for (size_t e = 0; e < found; e++) {
+        cw[positions[e]] ^= magnitudes[e];
+    }
+    return found;
+}
+
+} /* namespace reed_solomon */
@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2026
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __REED_SOLOMON_H__
+#define __REED_SOLOMON_H__
+
+#include <cstdint>
+#include <cstddef>
+
+namespace reed_solomon {
+
+/* RS(255, 255 - parity) over GF(256), primitive polynomial 0x11D, generator
+ * roots alpha^first_root .. alpha^(first_root + parity - 1).
+ *
+ * Codewords are 255 bytes with cw[i] the coefficient of x^i: parity in
+ * cw[0 .. parity), message in cw[parity .. 255). Shortened codes pass the
+ * unused message bytes as zero.
+ */
+class RS255 {
+   public:
+    static constexpr size_t n = 255;
+    static constexpr size_t parity_max = 32;
+
+    constexpr RS255(const size_t parity, const uint8_t first_root = 0)
+        : parity_{parity < parity_max ? parity : parity_max},
+          first_root_{first_root} {
+    }
+
+    size_t parity() const {
+        return parity_;
+    }
+
+    /* Fills in cw[0 .. parity) from the message part. */
+    void encode(uint8_t* const cw) const;
+
+    /* Corrects up to parity / 2 byte errors in place. Returns the number of
+     * bytes changed, or -1 if the codeword is not correctable; it is left
+     * untouched in that case.
+     */
+    int decode(uint8_t* const cw) const;
+
+   private:
+    const size_t parity_;
+    const uint8_t first_root_;
+};
+
+} /* namespace reed_solomon */
+
+#endif /*__REED_SOLOMON_H__*/
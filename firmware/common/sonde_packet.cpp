@@ -23,6 +23,8 @@
 
 #include "sonde_packet.hpp"
 #include "string_format.hpp"
+#include "reed_solomon.hpp"
+#include <algorithm>
 #include <cstring>
 // #include <complex>
 
@@ -46,6 +48,10 @@ static uint8_t calfrchk[51];        // so subframes are preserved while populate
 #define pos_GPSecefX 0x110  // 0x114  // 4 byte
 #define pos_GPSecefY 0x114  // 0x118  // 4 byte (not actually used since Y and Z are following X, and grabbed in that same loop)
 #define pos_GPSecefZ 0x118  // 0x11C  // 4 byte (same as Y)
+#define pos_RSparity 0x04   // 0x008  // 2 x 24 bytes
+#define pos_RSdata 0x34     // 0x038  // codeword bytes interleaved from here on
+#define rs41_frame_len 316  // 0x140  // standard frame, the rest of the codewords is zero
+#define rs41_parity 24
 
 #include "mathdef.hpp"
 
@@ -66,6 +72,8 @@ Packet::Packet(
             type_ = Type::Meteomodem_M2K2;
         else if (id_byte == 0x4520 || id_byte == 0x4320)  // https://raw.githubusercontent.com/projecthorus/radiosonde_auto_rx/master/demod/mod/m20mod.c
             type_ = Type::Meteomodem_M20;
+    } else if (type_ == Type::Vaisala_RS41_SG) {
+        rs41_correct();
     }
 }
 
@@ -86,20 +94,66 @@ Packet::Type Packet::type() const {
 // The raw data is xor-scrambled with the values in the 64 bytes vaisala_mask (see.hpp)
 // from 0x008 to 0x037 (48 bytes reed-solomon error correction data)
 
-uint8_t Packet::vaisala_descramble(const uint32_t pos) const {  // vaisala_descramble(const uint32_t pos) const {
-    // packet_[i]; its a bit;  packet_.size the total (should be 2560 bits)
-    uint8_t value = 0;
-    for (uint8_t i = 0; i < 8; i++)
-        value = (value << 1) | packet_[(pos * 8) + (7 - i)];  // get the byte from the bits collection
-
-    // packetReader reader { packet_ };				//This works just as above.
-    // value = reader.read(pos * 8,8);
-    // shift pos because first 4 bytes are consumed by proc_sonde in finding the vaisala signature
-    uint32_t mask_pos = pos + 4;
-    value = value ^ vaisala_mask[mask_pos % MASK_LEN];  // descramble with the xor pseudorandom table
-    return value;
+uint8_t Packet::vaisala_descramble(const uint32_t pos) const {
+    // Bytes are descrambled and error corrected once in rs41_correct()
+    return (pos < rs41_frame_.size()) ? rs41_frame_[pos] : 0;
 };
 
+// The 48 parity bytes protect two interleaved RS(255,231) codewords: codeword 1
+// takes the even data bytes from 0x038 on, codeword 2 the odd ones, see
+// https://github.com/rs1729/RS/blob/master/rs41/rs41sg.c
+void Packet::rs41_correct() {
+    const size_t bytes = std::min<size_t>(packet_.size() / 8, rs41_frame_.size());
+    for (size_t pos = 0; pos < bytes; pos++) {
+        uint8_t value = 0;
+        for (uint8_t i = 0; i < 8; i++)
+            value = (value << 1) | packet_[(pos * 8) + (7 - i)];  // get the byte from the bits collection
+
+        // shift pos because first 4 bytes are consumed by proc_sonde in finding the vaisala signature
+        rs41_frame_[pos] = value ^ vaisala_mask[(pos + 4) % MASK_LEN];
+    }
+
+    const size_t frame_len = std::min<size_t>(bytes, rs41_frame_len);
+    const reed_solomon::RS255 rs{rs41_parity};
+    std::array<uint8_t, reed_solomon::RS255::n> cw;
+    int fixed[2];
+
+    for (size_t c = 0; c < 2; c++) {
+        cw.fill(0);
+        for (size_t i = 0; i < rs41_parity; i++)
+            cw[i] = rs41_frame_[pos_RSparity + c * rs41_parity + i];
+        for (size_t i = 0; i < cw.size() - rs41_parity; i++) {
+            const size_t pos = pos_RSdata + c + 2 * i;
+            if (pos < frame_len)
+                cw[rs41_parity + i] = rs41_frame_[pos];
+        }
+
+        fixed[c] = rs.decode(cw.data());
+
+        // A "correction" in the zero padding past the frame means a miscorrection
+        for (size_t i = 0; fixed[c] > 0 && i < cw.size() - rs41_parity; i++) {
+            if (pos_RSdata + c + 2 * i >= frame_len && cw[rs41_parity + i] != 0)
+                fixed[c] = -1;
+        }
+        if (fixed[c] <= 0)
+            continue;
+
+        for (size_t i = 0; i < rs41_parity; i++)
+            rs41_frame_[pos_RSparity + c * rs41_parity + i] = cw[i];
+        for (size_t i = 0; i < cw.size() - rs41_parity; i++) {
+            const size_t pos = pos_RSdata + c + 2 * i;
+            if (pos < frame_len)
+                rs41_frame_[pos] = cw[rs41_parity + i];
+        }
+    }
+
+    rs41_ecc_errors_ = (fixed[0] < 0 || fixed[1] < 0) ? -1 : fixed[0] + fixed[1];
+}
+
+int Packet::ecc_errors() const {
+    return rs41_ecc_errors_;
+}
+
 GPS_data Packet::get_GPS_data() const {
     GPS_data result;
     if ((type_ == Type::Meteomodem_M10) || (type_ == Type::Meteomodem_M2K2)) {
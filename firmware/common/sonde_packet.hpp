@@ -25,6 +25,7 @@
 
 #include <cstdint>
 #include <cstddef>
+#include <array>
 
 #include "field_reader.hpp"
 #include "baseband_packet.hpp"
@@ -84,6 +85,9 @@ class Packet {
 
     bool crc_ok() const;
 
+    /* RS41 only: bytes repaired by Reed-Solomon, -1 if the frame was beyond repair. */
+    int ecc_errors() const;
+
    private:
     uint8_t getFwVerM20() const;
     static constexpr uint8_t vaisala_mask[64] = {
@@ -155,12 +159,17 @@ class Packet {
     GPS_data ecef_to_gps() const;
 
     uint8_t vaisala_descramble(uint32_t pos) const;
+    void rs41_correct();
 
     const baseband::Packet packet_;
     const BiphaseMDecoder decoder_;
     const FieldReader<BiphaseMDecoder, BitRemapNone> reader_bi_m;
     Type type_;
 
+    /* Descrambled RS41 frame, without the 4 sync bytes consumed by proc_sonde. */
+    std::array<uint8_t, 320> rs41_frame_{};
+    int rs41_ecc_errors_{0};
+
     using packetReader = FieldReader<baseband::Packet, BitRemapByteReverse>;  // baseband::Packet instead of BiphaseMDecoder
 
     bool crc_ok_M10() const;
@@ -120,6 +120,7 @@ constexpr image_tag_t image_tag_usb_sd{'P', 'U', 'S', 'B'};
 constexpr image_tag_t image_tag_weather{'P', 'W', 'T', 'H'};
 constexpr image_tag_t image_tag_subghzd{'P', 'S', 'G', 'D'};
 constexpr image_tag_t image_tag_subcar{'P', 'S', 'C', 'D'};
+constexpr image_tag_t image_tag_nfm_channelizer{'P', 'N', 'C', 'Z'};
 constexpr image_tag_t image_tag_protoview{'P', 'P', 'V', 'W'};
 constexpr image_tag_t image_tag_wefaxrx{'P', 'W', 'F', 'X'};
 constexpr image_tag_t image_tag_noaaapt_rx{'P', 'N', 'O', 'A'};
@@ -34,6 +34,10 @@ FormattedSymbols Packet::symbols_formatted() const {
     return format_symbols(decoder_);
 }
 
+size_t Packet::symbols_packed(uint8_t* const data, uint8_t* const errors, const size_t capacity) const {
+    return pack_symbols(decoder_, data, errors, capacity);
+}
+
 Optional<Reading> Packet::reading_fsk_19k2_schrader() const {
     const auto length = crc_valid_length();
 
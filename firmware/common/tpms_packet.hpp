@@ -147,6 +147,7 @@ class Packet {
     Timestamp received_at() const;
 
     FormattedSymbols symbols_formatted() const;
+    size_t symbols_packed(uint8_t* const data, uint8_t* const errors, const size_t capacity) const;
 
     Optional<Reading> reading() const;
 
@@ -29,6 +29,54 @@ using namespace portapack;
 
 namespace ui {
 
+static uint32_t frame_pixels = 0;
+
+/* DirtyRegion ***********************************************************/
+
+static bool overlaps(const Rect& a, const Rect& b) {
+    return (a.left() < b.right()) && (b.left() < a.right()) &&
+           (a.top() < b.bottom()) && (b.top() < a.bottom());
+}
+
+static bool covers(const Rect& outer, const Rect& inner) {
+    return (outer.left() <= inner.left()) && (outer.right() >= inner.right()) &&
+           (outer.top() <= inner.top()) && (outer.bottom() >= inner.bottom());
+}
+
+void DirtyRegion::add(Rect r) {
+    if (r.is_empty()) return;
+
+    // Swallow everything the new rectangle touches, repeat until stable.
+    for (size_t i = 0; i < count_;) {
+        if (overlaps(rects_[i], r)) {
+            r += rects_[i];
+            rects_[i] = rects_[--count_];
+            i = 0;
+        } else {
+            i++;
+        }
+    }
+
+    if (count_ == capacity) {
+        for (size_t i = 1; i < count_; i++) {
+            rects_[0] += rects_[i];
+        }
+        rects_[0] += r;
+        count_ = 1;
+    } else {
+        rects_[count_++] = r;
+    }
+}
+
+bool DirtyRegion::intersects(const Rect& r) const {
+    for (const auto& d : *this) {
+        if (overlaps(d, r)) return true;
+    }
+    return false;
+}
+
+/* Painter ***************************************************************/
+
 Style Style::invert() const {
     return {
         .font = font,
@@ -36,10 +84,20 @@ Style Style::invert() const {
         .foreground = background};
 }
 
+Rect Painter::clipped(const Rect r) const {
+    return clip_.is_empty() ? r : r.intersect(clip_);
+}
+
 int Painter::draw_char(Point p, const Style& style, char c, uint8_t zoom_level) {
     const auto glyph = style.font.glyph(c);
 
-    display.draw_glyph(p, glyph, style.foreground, style.background, zoom_level);
+    if (style.background.v == Color::magenta().v) {
+        // Transparent background, only set pixels are drawn
+        if (clipped({p, {glyph.size().width() * zoom_level, glyph.size().height() * zoom_level}}))
+            display.draw_glyph(p, glyph, style.foreground, style.background, zoom_level);
+    } else {
+        display.draw_glyph_run(p, GlyphRun{style.font, std::string_view{&c, 1}, style.foreground, style.background, zoom_level}, clipped(display.screen_rect()));
+    }
 
     return glyph.advance().x() * zoom_level;
 }
@@ -54,6 +112,13 @@ int Painter::draw_string(
     Color foreground,
     Color background,
     std::string_view text) {
+    if (background.v != Color::magenta().v) {
+        // Opaque background: whole string through one LCD window
+        const GlyphRun run{font, text, foreground, background};
+        display.draw_glyph_run(p, run, clipped(display.screen_rect()));
+        return run.advance();
+    }
+
     bool escape = false;
     size_t width = 0;
     Color pen = foreground;
@@ -70,7 +135,8 @@ int Painter::draw_string(
                 escape = true;
             } else {
                 const auto glyph = font.glyph(c);
-                display.draw_glyph(p, glyph, pen, background);
+                if (clipped({p, glyph.size()}))
+                    display.draw_glyph(p, glyph, pen, background);
                 const auto advance = glyph.advance();
                 p += advance;
                 width += advance.x();
@@ -86,15 +152,17 @@ void Painter::draw_bitmap(Point p, const Bitmap& bitmap, Color foreground, Color
     if ((background.v == ui::Color::white().v) && (foreground.to_greyscale() > 146))
         foreground = foreground.dark();
 
-    display.draw_bitmap(p, bitmap.size, bitmap.data, foreground, background);
+    // Bitmaps are not clipped, they only repaint their own pixels.
+    if (clipped({p, bitmap.size}))
+        display.draw_bitmap(p, bitmap.size, bitmap.data, foreground, background);
 }
 
 void Painter::draw_hline(Point p, int width, Color c) {
-    display.fill_rectangle({p, {width, 1}}, c);
+    fill_rectangle({p, {width, 1}}, c);
 }
 
 void Painter::draw_vline(Point p, int height, Color c) {
-    display.fill_rectangle({p, {1, height}}, c);
+    fill_rectangle({p, {1, height}}, c);
 }
 
 void Painter::draw_rectangle(Rect r, Color c) {
@@ -105,21 +173,70 @@ void Painter::draw_rectangle(Rect r, Color c) {
 }
 
 void Painter::fill_rectangle(Rect r, Color c) {
-    display.fill_rectangle(r, c);
+    r = clipped(r);
+    if (r) display.fill_rectangle(r, c);
 }
 
 void Painter::fill_rectangle_unrolled8(Rect r, Color c) {
-    display.fill_rectangle_unrolled8(r, c);
+    // The unrolled fill needs whole multiples of 8 pixels, fall back when clipping.
+    if (clip_.is_empty())
+        display.fill_rectangle_unrolled8(r, c);
+    else
+        fill_rectangle(r, c);
 }
 
 void Painter::paint_widget_tree(Widget* w) {
     if (ui::is_dirty()) {
-        paint_widget(w);
+        const auto pixels_before = io.lcd_pixels_written();
+        paint_widget(w, false);
         ui::dirty_clear();
+        frame_pixels = io.lcd_pixels_written() - pixels_before;
+    }
+}
+
+uint32_t Painter::last_frame_pixels() {
+    return frame_pixels;
+}
+
+/* Bounds of a widget and everything below it; children may stick out. */
+static Rect subtree_rect(Widget* w) {
+    auto r = w->screen_rect();
+    for (const auto child : w->children()) {
+        if (!child->hidden()) r += subtree_rect(child);
     }
+    return r;
 }
 
-void Painter::paint_widget(Widget* w) {
+/* True if a later, opaque sibling hides all of children[index]. */
+static bool covered_by_sibling(const std::vector<Widget*>& children, const size_t index) {
+    Rect r{};
+    for (size_t i = index + 1; i < children.size(); i++) {
+        const auto sibling = children[i];
+        if (sibling->hidden() || !sibling->opaque()) continue;
+
+        if (r.is_empty()) {
+            r = subtree_rect(children[index]);
+            if (r.is_empty()) return false;
+        }
+        if (covers(sibling->screen_rect(), r)) return true;
+    }
+    return false;
+}
+
+/* Culled widgets count as painted, the cover keeps the screen correct. */
+static void skip_widget(Widget* w) {
+    if (w->hidden()) {
+        w->visible(false);
+        return;
+    }
+    w->visible(true);
+    w->set_clean();
+    for (const auto child : w->children()) {
+        skip_widget(child);
+    }
+}
+
+void Painter::paint_widget(Widget* w, const bool force) {
     if (w->hidden()) {
         // Mark widget (and all children) as invisible.
         w->visible(false);
@@ -127,21 +244,36 @@ void Painter::paint_widget(Widget* w) {
         // Mark this widget as visible and recurse.
         w->visible(true);
 
-        if (w->dirty()) {
+        if (force || w->dirty()) {
             w->paint(*this);
             // Force-paint all children.
-            for (const auto child : w->children()) {
-                child->set_dirty();
-                paint_widget(child);
-            }
+            paint_children(w, true);
             w->set_clean();
         } else {
-            // Selectively paint all children.
-            for (const auto child : w->children()) {
-                paint_widget(child);
+            // Repaint only what a hidden widget uncovered, then selectively paint all children.
+            const auto& region = ui::dirty_region();
+            if (region.intersects(w->screen_rect())) {
+                for (const auto& d : region) {
+                    clip_ = d.intersect(w->screen_rect());
+                    if (clip_) w->paint(*this);
+                }
+                clip_ = {};
             }
+            paint_children(w, false);
         }
     }
 }
 
+void Painter::paint_children(Widget* w, const bool force) {
+    const auto& children = w->children();
+    for (size_t i = 0; i < children.size(); i++) {
+        const auto child = children[i];
+        // Only look for covers when the child would actually paint.
+        if ((force || child->dirty()) && covered_by_sibling(children, i))
+            skip_widget(child);
+        else
+            paint_widget(child, force);
+    }
+}
+
 } /* namespace ui */
@@ -26,6 +26,7 @@
 #include "ui.hpp"
 #include "ui_text.hpp"
 
+#include <array>
 #include <string_view>
 
 namespace ui {
@@ -63,6 +64,37 @@ struct MutableStyle {
 
 class Widget;
 
+/* Screen areas to repaint in the next paint pass. Overlapping rectangles are
+ * merged; once the list is full everything collapses into one bounding box.
+ */
+class DirtyRegion {
+   public:
+    static constexpr size_t capacity = 8;
+
+    void add(const Rect r);
+    bool intersects(const Rect& r) const;
+
+    void clear() {
+        count_ = 0;
+    }
+
+    bool empty() const {
+        return count_ == 0;
+    }
+
+    const Rect* begin() const {
+        return rects_.data();
+    }
+
+    const Rect* end() const {
+        return rects_.data() + count_;
+    }
+
+   private:
+    std::array<Rect, capacity> rects_{};
+    size_t count_{0};
+};
+
 class Painter {
    public:
     Painter() {};
@@ -83,11 +115,19 @@ class Painter {
 
     void paint_widget_tree(Widget* w);
 
+    /* Pixels pushed to the LCD during the last paint pass. */
+    static uint32_t last_frame_pixels();
+
     void draw_hline(Point p, int width, Color c);
     void draw_vline(Point p, int height, Color c);
 
    private:
-    void paint_widget(Widget* w);
+    /* Set while a clean widget repaints an area a hidden widget uncovered. */
+    Rect clip_{};
+
+    Rect clipped(const Rect r) const;
+    void paint_widget(Widget* w, const bool force);
+    void paint_children(Widget* w, const bool force);
 };
 
 } /* namespace ui */
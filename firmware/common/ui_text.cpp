@@ -21,6 +21,8 @@
 
 #include "ui_text.hpp"
 
+#include <algorithm>
+
 namespace ui {
 
 Glyph Font::glyph(const char c) const {
@@ -71,4 +73,74 @@ Size Font::size_of(const std::string s) const {
     return size;
 }
 
+GlyphRun::GlyphRun(
+    const Font& font,
+    std::string_view text,
+    Color foreground,
+    Color background,
+    uint8_t zoom_level)
+    : font{font},
+      text{text},
+      foreground{foreground},
+      background{background},
+      zoom_level{std::max<int>(zoom_level, 1)} {
+    bool escape = false;
+    for (const auto c : text) {
+        if (escape) {
+            escape = false;
+        } else if (c == '\x1B') {
+            escape = true;
+        } else {
+            const auto glyph = font.glyph(c);
+            width += glyph.advance().x();
+            height = std::max(height, glyph.h());
+        }
+    }
+}
+
+void GlyphRun::render_scanline(int y, int x0, int count, Color* line) const {
+    const int sy = y / zoom_level;
+    const int x1 = x0 + count;
+    bool escape = false;
+    Color pen = foreground;
+    int gx = 0;
+
+    for (const auto c : text) {
+        if (gx >= x1) break;
+
+        if (escape) {
+            if ((uint8_t)c < std::size(term_colors))
+                pen = term_colors[(uint8_t)c];
+            else
+                pen = foreground;
+            escape = false;
+            continue;
+        }
+        if (c == '\x1B') {
+            escape = true;
+            continue;
+        }
+
+        const auto glyph = font.glyph(c);
+        const int glyph_width = glyph.w() * zoom_level;
+        const int start = std::max(gx, x0);
+        const int end = std::min(gx + glyph_width, x1);
+
+        if (start < end) {
+            if (sy < glyph.h()) {
+                const auto pixels = glyph.pixels();
+                const size_t row_bit = sy * glyph.w();
+                for (int x = start; x < end; x++) {
+                    const size_t bit_index = row_bit + (x - gx) / zoom_level;
+                    const auto pixel = pixels[bit_index >> 3] & (1U << (bit_index & 0x7));
+                    line[x - x0] = pixel ? pen : background;
+                }
+            } else {
+                std::fill(&line[start - x0], &line[end - x0], background);
+            }
+        }
+        gx += glyph_width;
+    }
+}
+
 } /* namespace ui */
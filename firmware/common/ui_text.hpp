@@ -25,6 +25,7 @@
 #include <cstdint>
 #include <cstddef>
 #include <string>
+#include <string_view>
 
 #include "ui.hpp"
 
@@ -107,6 +108,43 @@ class Font {
     const size_t data_stride;
 };
 
+/* A string laid out on one text row, with "\x1B<n>" colour escapes applied.
+ * It is rasterised a scanline at a time so a whole run can be streamed to
+ * the LCD through a single address window instead of one per glyph.
+ * Pixels match drawing each glyph with ILI9341::draw_glyph().
+ */
+class GlyphRun {
+   public:
+    GlyphRun(
+        const Font& font,
+        std::string_view text,
+        Color foreground,
+        Color background,
+        uint8_t zoom_level = 1);
+
+    /* Size on screen, including zoom. */
+    Size size() const {
+        return {width * zoom_level, height * zoom_level};
+    }
+
+    /* Unzoomed width, as returned by Painter::draw_string(). */
+    int advance() const {
+        return width;
+    }
+
+    /* Renders count pixels of scanline y (0 .. size().height() - 1), starting at column x0. */
+    void render_scanline(int y, int x0, int count, Color* line) const;
+
+   private:
+    const Font& font;
+    const std::string_view text;
+    const Color foreground;
+    const Color background;
+    const int zoom_level;
+    int width{0};
+    int height{0};
+};
+
 } /* namespace ui */
 
 #endif /*__UI_TEXT_H__*/
@@ -43,6 +43,7 @@ using namespace rtc_time;
 namespace ui {
 
 static bool ui_dirty = true;
+static DirtyRegion ui_dirty_region{};
 
 void dirty_set() {
     ui_dirty = true;
@@ -50,6 +51,16 @@ void dirty_set() {
 
 void dirty_clear() {
     ui_dirty = false;
+    ui_dirty_region.clear();
+}
+
+void dirty_rect(const Rect& r) {
+    ui_dirty_region.add(r);
+    ui_dirty = true;
+}
+
+const DirtyRegion& dirty_region() {
+    return ui_dirty_region;
 }
 
 bool is_dirty() {
@@ -77,6 +88,10 @@ Rect Widget::parent_rect() const {
 }
 
 void Widget::set_parent_rect(const Rect new_parent_rect) {
+    // Something may have been culled under the old position.
+    if (flags.visible && opaque())
+        dirty_rect(screen_rect());
+
     _parent_rect = new_parent_rect;
     set_dirty();
 }
@@ -126,10 +141,9 @@ void Widget::hidden(bool hide) {
 
         // If parent is hidden, either of these is a no-op.
         if (hide) {
-            // TODO: Instead of dirtying parent entirely, dirty only children
-            // that overlap with this widget.
-
-            // parent()->dirty_overlapping_children_in_rect(parent_rect());
+            // Repaint whatever this widget was covering, clipped to its area.
+            if (flags.visible && parent())
+                dirty_rect(screen_rect());
 
             /* TODO: Notify self and all non-hidden children that they're
              * now effectively hidden?
@@ -353,6 +367,10 @@ void Rectangle::set_outline(const bool outline) {
     set_dirty();
 }
 
+bool Rectangle::opaque() const {
+    return !_outline;
+}
+
 void Rectangle::paint(Painter& painter) {
     if (!_outline) {
         painter.fill_rectangle(
@@ -396,15 +414,24 @@ void Text::paint(Painter& painter) {
     auto max_len = (unsigned)rect.width() / s.font.char_width();
     auto text_view = std::string_view{text};
 
-    painter.fill_rectangle(rect, s.background);
-
     if (text_view.length() > max_len)
         text_view = text_view.substr(0, max_len);
 
-    painter.draw_string(
-        rect.location(),
-        s,
-        text_view);
+    if (s.background.v == Color::magenta().v) {
+        painter.fill_rectangle(rect, s.background);
+        painter.draw_string(rect.location(), s, text_view);
+        return;
+    }
+
+    // The string paints its own background, only fill what is left around it.
+    const int width = painter.draw_string(rect.location(), s, text_view);
+    const int height = s.font.line_height();
+    painter.fill_rectangle({rect.left() + width, rect.top(), rect.width() - width, rect.height()}, s.background);
+    painter.fill_rectangle({rect.left(), rect.top() + height, width, rect.height() - height}, s.background);
+}
+
+bool Text::opaque() const {
+    return style().background.v != Color::magenta().v;
 }
 
 /* Labels ****************************************************************/
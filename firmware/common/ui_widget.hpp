@@ -49,6 +49,12 @@ void dirty_set();
 void dirty_clear();
 bool is_dirty();
 
+/* Screen area left stale by a widget that went away; widgets underneath
+ * repaint just that part on the next paint pass.
+ */
+void dirty_rect(const Rect& r);
+const DirtyRegion& dirty_region();
+
 class Context {
    public:
     FocusManager& focus_manager() {
@@ -102,6 +108,11 @@ class Widget {
 
     virtual void paint(Painter& painter) = 0;
 
+    /* Widgets that paint every pixel of screen_rect() return true, so the
+     * painter can skip whatever they fully cover.
+     */
+    virtual bool opaque() const { return false; };
+
     virtual void on_show() { return; };
     virtual void on_hide() { return; };
 
@@ -198,6 +209,7 @@ class Rectangle : public Widget {
     }
 
     void paint(Painter& painter) override;
+    bool opaque() const override;
 
     void set_color(const Color c);
     void set_outline(const bool outline);
@@ -219,6 +231,7 @@ class Text : public Widget {
     void set(std::string_view value);
 
     void paint(Painter& painter) override;
+    bool opaque() const override;
     void getAccessibilityText(std::string& result) override;
     void getWidgetName(std::string& result) override;
 
@@ -72,9 +72,18 @@ FRESULT f_truncate(FIL*) {
 FRESULT f_unlink(const TCHAR*) {
     return FR_OK;
 }
+FRESULT f_utime(const TCHAR*, const FILINFO*) {
+    return FR_OK;
+}
 FRESULT f_write(FIL*, const void*, UINT, UINT*) {
     return FR_OK;
 }
 
 /* Debug */
 void __debug_log(const std::string&) {}
+
+/* Controls, pulled in by ui.cpp */
+#include "irq_controls.hpp"
+bool switch_is_long_pressed(Switch) {
+    return false;
+}
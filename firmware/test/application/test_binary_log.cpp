@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2026
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "doctest.h"
+#include "binary_log.hpp"
+#include "manchester.hpp"
+#include "string_format.hpp"
+
+#include <cstring>
+
+using namespace binlog;
+
+namespace {
+
+std::string hex_nibbles(const uint8_t* data, size_t symbols) {
+    std::string s;
+    for (size_t i = 0; i < symbols / 4; i++)
+        s += to_string_hex((data[i / 2] >> ((i & 1) ? 0 : 4)) & 0xf, 1);
+    return s;
+}
+
+}  // namespace
+
+TEST_SUITE("Binary decoder log") {
+    TEST_CASE("Records are laid out as header then payload.") {
+        RecordBuffer<64> buffer{};
+        const RecordHeader header{RecordType::ERT, 2, 0, 0x01020304, 915000000, -40, 12, 0, 0x123456789ULL, -1500, 0};
+        const uint8_t payload[] = {0xAA, 0xBB, 0xCC};
+
+        REQUIRE(buffer.push(header, payload, sizeof(payload)));
+        CHECK(buffer.size() == sizeof(RecordHeader) + sizeof(payload));
+
+        RecordHeader stored{};
+        std::memcpy(&stored, buffer.data(), sizeof(stored));
+        CHECK(stored.type == RecordType::ERT);
+        CHECK(stored.subtype == 2);
+        CHECK(stored.length == sizeof(payload));
+        CHECK(stored.timestamp == 0x01020304);
+        CHECK(stored.frequency == 915000000);
+        CHECK(stored.rssi == -40);
+        CHECK(stored.snr == 12);
+        CHECK(stored.sample_index == 0x123456789ULL);
+        CHECK(stored.frequency_offset == -1500);
+        CHECK(buffer.data()[sizeof(RecordHeader)] == 0xAA);
+        CHECK(buffer.data()[sizeof(RecordHeader) + 2] == 0xCC);
+    }
+
+    TEST_CASE("A record that does not fit leaves the buffer untouched.") {
+        RecordBuffer<80> buffer{};
+        const RecordHeader header{RecordType::Text, 0, 0, 0, 0, rssi_unknown, rssi_unknown, 0, 0, 0, 0};
+        const char text[] = "0123456789";
+
+        REQUIRE(buffer.push(header, text, 10));
+        CHECK_FALSE(buffer.push(header, text, 10));
+        CHECK(buffer.size() == 42);
+
+        buffer.clear();
+        CHECK(buffer.empty());
+        uint8_t big[RecordBuffer<80>::max_payload]{};
+        CHECK(buffer.push(header, big, sizeof(big)));
+        CHECK(buffer.size() == buffer.capacity);
+    }
+
+    TEST_CASE("Packed symbols match the formatted text log.") {
+        baseband::Packet packet{};
+        uint32_t lcg = 1;
+        for (size_t i = 0; i < 2 * 61; i++) {
+            lcg = lcg * 1103515245 + 12345;
+            packet.add((lcg >> 16) & 1);
+        }
+        const ManchesterDecoder decoder{packet, 0};
+
+        uint8_t data[16]{};
+        uint8_t errors[16]{};
+        const size_t symbols = pack_symbols(decoder, data, errors, sizeof(data));
+        CHECK(symbols == 64);
+
+        const auto formatted = format_symbols(decoder);
+        CHECK(hex_nibbles(data, symbols) == formatted.data);
+        CHECK(hex_nibbles(errors, symbols) == formatted.errors);
+    }
+
+    TEST_CASE("Packed symbols are clipped to the capacity.") {
+        baseband::Packet packet{};
+        for (size_t i = 0; i < 2 * 40; i++)
+            packet.add(i & 1);
+        const ManchesterDecoder decoder{packet, 0};
+
+        uint8_t data[2]{};
+        uint8_t errors[2]{};
+        CHECK(pack_symbols(decoder, data, errors, sizeof(data)) == 16);
+        CHECK(data[0] == 0x00);
+        CHECK(errors[0] == 0x00);
+    }
+}
@@ -0,0 +1,246 @@
+/*
+ * Copyright (C) 2026
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "doctest.h"
+#include "fatfs_cache.h"
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+constexpr uint32_t sector_size = FATFS_CACHE_SECTOR_SIZE;
+constexpr uint32_t image_sectors = 512;
+
+using Sector = std::vector<uint8_t>;
+
+/* A disk image file standing in for the card, with counters for every
+ * transfer the cache makes. */
+struct ImageDisk {
+    FILE* file = nullptr;
+    uint32_t reads = 0;
+    uint32_t writes = 0;
+    uint32_t sectors_written = 0;
+    bool fail_writes = false;
+};
+
+ImageDisk disk;
+
+bool image_read(uint32_t sector, uint8_t* buf, uint32_t count) {
+    disk.reads++;
+    if (sector + count > image_sectors)
+        return true;
+    fseek(disk.file, sector * sector_size, SEEK_SET);
+    return fread(buf, sector_size, count, disk.file) != count;
+}
+
+bool image_write(uint32_t sector, const uint8_t* buf, uint32_t count) {
+    if (disk.fail_writes)
+        return true;
+    disk.writes++;
+    disk.sectors_written += count;
+    fseek(disk.file, sector * sector_size, SEEK_SET);
+    return fwrite(buf, sector_size, count, disk.file) != count;
+}
+
+uint32_t image_sector_count() {
+    return image_sectors;
+}
+
+const fatfs_cache_ops_t image_ops = {image_read, image_write, image_sector_count};
+
+Sector pattern(uint32_t sector, uint8_t seed) {
+    Sector data(sector_size);
+    for (size_t i = 0; i < data.size(); i++)
+        data[i] = (uint8_t)(sector * 31 + i * 7 + seed);
+    return data;
+}
+
+Sector image_sector(uint32_t sector) {
+    Sector data(sector_size);
+    fflush(disk.file);
+    fseek(disk.file, sector * sector_size, SEEK_SET);
+    REQUIRE(fread(data.data(), sector_size, 1, disk.file) == 1);
+    return data;
+}
+
+Sector cached_sector(uint32_t sector) {
+    Sector data(sector_size);
+    REQUIRE_FALSE(fatfs_cache_read(data.data(), sector, 1));
+    return data;
+}
+
+struct CacheFixture {
+    CacheFixture() {
+        if (disk.file)
+            fclose(disk.file);
+        disk = {};
+        disk.file = tmpfile();
+        REQUIRE(disk.file != nullptr);
+        for (uint32_t s = 0; s < image_sectors; s++)
+            fwrite(pattern(s, 0).data(), sector_size, 1, disk.file);
+        fflush(disk.file);
+        fatfs_cache_init(&image_ops);
+        start = *fatfs_cache_stats();
+    }
+
+    fatfs_cache_stats_t delta() const {
+        const auto& now = *fatfs_cache_stats();
+        return {now.hits - start.hits, now.misses - start.misses,
+                now.readaheads - start.readaheads, now.readahead_hits - start.readahead_hits,
+                now.write_hits - start.write_hits, now.write_backs - start.write_backs,
+                now.flushes - start.flushes, now.coalesced - start.coalesced};
+    }
+
+    fatfs_cache_stats_t start;
+};
+
+}  // namespace
+
+TEST_SUITE_BEGIN("FatFs sector cache");
+
+TEST_CASE_FIXTURE(CacheFixture, "Re-reading FAT and directory sectors hits the cache") {
+    const uint32_t hot[] = {1, 40, 2, 41};
+    for (int pass = 0; pass < 10; pass++)
+        for (auto sector : hot)
+            CHECK(cached_sector(sector) == pattern(sector, 0));
+
+    CHECK(disk.reads == 4);
+    CHECK(delta().misses == 4);
+    CHECK(delta().hits == 36);
+}
+
+TEST_CASE_FIXTURE(CacheFixture, "Sequential single sector reads are upgraded to read-ahead") {
+    for (uint32_t sector = 100; sector < 164; sector++)
+        CHECK(cached_sector(sector) == pattern(sector, 0));
+
+    // One plain miss to start the run, then one multi-block read per window.
+    CHECK(disk.reads == 1 + (63 + FATFS_CACHE_READAHEAD - 1) / FATFS_CACHE_READAHEAD);
+    CHECK(delta().readahead_hits == 63 - delta().readaheads);
+}
+
+TEST_CASE_FIXTURE(CacheFixture, "Read-ahead stops at the end of the card") {
+    for (uint32_t sector = image_sectors - 3; sector < image_sectors; sector++)
+        CHECK(cached_sector(sector) == pattern(sector, 0));
+    CHECK(delta().readaheads == 1);
+}
+
+TEST_CASE_FIXTURE(CacheFixture, "Streams don't evict FAT sectors") {
+    cached_sector(1);
+    for (uint32_t sector = 200; sector < 300; sector++)
+        cached_sector(sector);
+    const auto reads = disk.reads;
+    CHECK(cached_sector(1) == pattern(1, 0));
+    CHECK(disk.reads == reads);
+}
+
+TEST_CASE_FIXTURE(CacheFixture, "Single sector writes are held until flushed and then coalesced") {
+    for (int pass = 0; pass < 3; pass++)
+        for (uint32_t sector = 20; sector < 20 + FATFS_CACHE_SLOTS; sector++)
+            REQUIRE_FALSE(fatfs_cache_write(pattern(sector, 1 + pass).data(), sector, 1));
+
+    CHECK(disk.writes == 0);
+    CHECK(image_sector(20) == pattern(20, 0));
+    CHECK(cached_sector(20) == pattern(20, 3));
+
+    REQUIRE_FALSE(fatfs_cache_flush());
+    CHECK(disk.writes == (FATFS_CACHE_SLOTS + FATFS_CACHE_READAHEAD - 1) / FATFS_CACHE_READAHEAD);
+    CHECK(delta().coalesced == disk.writes);
+    for (uint32_t sector = 20; sector < 20 + FATFS_CACHE_SLOTS; sector++)
+        CHECK(image_sector(sector) == pattern(sector, 3));
+
+    // Nothing left to write.
+    REQUIRE_FALSE(fatfs_cache_flush());
+    CHECK(delta().flushes == 1);
+}
+
+TEST_CASE_FIXTURE(CacheFixture, "Dirty sectors are written back on eviction") {
+    for (uint32_t i = 0; i <= FATFS_CACHE_SLOTS; i++)
+        REQUIRE_FALSE(fatfs_cache_write(pattern(i * 10, 5).data(), i * 10, 1));
+
+    CHECK(delta().write_backs == 1);
+    CHECK(image_sector(0) == pattern(0, 5));
+}
+
+TEST_CASE_FIXTURE(CacheFixture, "Failed flushes keep sectors dirty") {
+    REQUIRE_FALSE(fatfs_cache_write(pattern(7, 9).data(), 7, 1));
+    disk.fail_writes = true;
+    CHECK(fatfs_cache_flush());
+    disk.fail_writes = false;
+    REQUIRE_FALSE(fatfs_cache_flush());
+    CHECK(image_sector(7) == pattern(7, 9));
+}
+
+TEST_CASE_FIXTURE(CacheFixture, "Init drops cached sectors of a removed card") {
+    REQUIRE_FALSE(fatfs_cache_write(pattern(3, 4).data(), 3, 1));
+    fatfs_cache_init(&image_ops);
+    REQUIRE_FALSE(fatfs_cache_flush());
+    CHECK(cached_sector(3) == pattern(3, 0));
+}
+
+TEST_CASE_FIXTURE(CacheFixture, "Mixed transfers stay coherent with the image") {
+    constexpr uint32_t region = 48;
+    std::vector<Sector> shadow;
+    for (uint32_t s = 0; s < region; s++)
+        shadow.push_back(pattern(s, 0));
+
+    uint32_t lcg = 12345;
+    auto next = [&lcg](uint32_t range) {
+        lcg = lcg * 1103515245 + 12345;
+        return (lcg >> 16) % range;
+    };
+
+    for (int op = 0; op < 4000; op++) {
+        const uint32_t count = next(4) == 0 ? 1 + next(6) : 1;
+        const uint32_t sector = next(region - count + 1);
+        std::vector<uint8_t> buffer(count * sector_size);
+
+        switch (next(5)) {
+            case 0:
+            case 1:
+                REQUIRE_FALSE(fatfs_cache_read(buffer.data(), sector, count));
+                for (uint32_t i = 0; i < count; i++)
+                    REQUIRE(memcmp(&buffer[i * sector_size], shadow[sector + i].data(), sector_size) == 0);
+                break;
+            case 2:
+            case 3:
+                for (uint32_t i = 0; i < count; i++) {
+                    shadow[sector + i] = pattern(sector + i, (uint8_t)op);
+                    memcpy(&buffer[i * sector_size], shadow[sector + i].data(), sector_size);
+                }
+                REQUIRE_FALSE(fatfs_cache_write(buffer.data(), sector, count));
+                break;
+            default:
+                if (next(8) == 0)
+                    REQUIRE_FALSE(fatfs_cache_flush());
+                break;
+        }
+    }
+
+    REQUIRE_FALSE(fatfs_cache_flush());
+    for (uint32_t s = 0; s < region; s++)
+        REQUIRE(image_sector(s) == shadow[s]);
+    MESSAGE("hits " << delta().hits << ", misses " << delta().misses
+                    << ", device writes " << disk.writes << " for " << disk.sectors_written << " sectors");
+}
+
+TEST_SUITE_END();
@@ -0,0 +1,215 @@
+/*
+ * Copyright (C) 2026
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "doctest.h"
+#include "mock_file.hpp"
+#include "geomap_tiles.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace geomap;
+
+namespace {
+
+template <typename T>
+void append(std::string& s, T value) {
+    s.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+/* Two levels: level 0 is 2x2 tiles (bottom right has no data, top left and
+ * top right share one tile), level 1 is a single tile. Tile pixels hold the
+ * tile id in every pixel. */
+std::string make_tile_map() {
+    std::string s;
+    append(s, TileMapHeader{tile_map_magic, tile_size, 2, 2 * tile_size, 2 * tile_size});
+
+    const uint32_t index0 = sizeof(TileMapHeader) + 2 * sizeof(TileMapLevel);
+    const uint32_t index1 = index0 + 4 * sizeof(uint32_t);
+    const uint32_t data = index1 + sizeof(uint32_t);
+    const uint32_t tile_bytes = tile_pixels * sizeof(ui::Color);
+
+    append(s, TileMapLevel{2, 2, index0});
+    append(s, TileMapLevel{1, 1, index1});
+    for (uint32_t offset : {data, data, data + tile_bytes, 0u})
+        append(s, offset);
+    append(s, data + 2 * tile_bytes);
+
+    for (uint16_t id : {1, 2, 3})
+        for (size_t i = 0; i < tile_pixels; i++)
+            append(s, id);
+    return s;
+}
+
+/* Host heap that can be made to fail like the device heap running short. */
+struct TestHeap {
+    static bool fail;
+    static void* allocate(size_t size) { return fail ? nullptr : std::malloc(size); }
+    static void release(void* p) { std::free(p); }
+};
+bool TestHeap::fail = false;
+
+using TestCache = TileCache<MockFile, TestHeap>;
+
+}  // namespace
+
+TEST_SUITE_BEGIN("Test GeoMap tiles");
+
+TEST_CASE("It reads the header and level table.") {
+    MockFile f{make_tile_map()};
+    TestCache cache{f};
+    REQUIRE(cache.allocate(2));
+    REQUIRE(cache.open());
+    CHECK_EQ(cache.levels(), 2);
+    CHECK_EQ(cache.width(), 2 * tile_size);
+    CHECK_EQ(cache.height(), 2 * tile_size);
+    CHECK_EQ(cache.level(0).tiles_x, 2);
+    CHECK_EQ(cache.level(1).tiles_y, 1);
+}
+
+TEST_CASE("It rejects a file with a bad magic.") {
+    auto data = make_tile_map();
+    data[0] ^= 0xFF;
+    MockFile f{data};
+    TestCache cache{f};
+    REQUIRE(cache.allocate(2));
+    CHECK_FALSE(cache.open());
+    CHECK(cache.get(0, 0, 0) == nullptr);
+}
+
+TEST_CASE("It rejects a truncated file.") {
+    MockFile f{make_tile_map().substr(0, 10)};
+    TestCache cache{f};
+    REQUIRE(cache.allocate(2));
+    CHECK_FALSE(cache.open());
+}
+
+TEST_CASE("It returns tile pixels and nullptr outside the map.") {
+    MockFile f{make_tile_map()};
+    TestCache cache{f};
+    REQUIRE(cache.allocate(2));
+    REQUIRE(cache.open());
+
+    auto tile = cache.get(0, 0, 1);
+    REQUIRE(tile != nullptr);
+    CHECK_EQ(tile[0].v, 2);
+    CHECK_EQ(tile[tile_pixels - 1].v, 2);
+
+    tile = cache.get(1, 0, 0);
+    REQUIRE(tile != nullptr);
+    CHECK_EQ(tile[0].v, 3);
+
+    CHECK(cache.get(0, 1, 1) == nullptr);   // No data
+    CHECK(cache.get(0, 2, 0) == nullptr);   // Past the right edge
+    CHECK(cache.get(0, -1, 0) == nullptr);  // Before the left edge
+    CHECK(cache.get(2, 0, 0) == nullptr);   // No such level
+}
+
+TEST_CASE("It serves shared tiles from their common offset.") {
+    MockFile f{make_tile_map()};
+    TestCache cache{f};
+    REQUIRE(cache.allocate(2));
+    REQUIRE(cache.open());
+    CHECK_EQ(cache.get(0, 0, 0)[0].v, 1);
+    CHECK_EQ(cache.get(0, 1, 0)[0].v, 1);
+}
+
+TEST_CASE("It hits the cache and evicts the least recently used tile.") {
+    MockFile f{make_tile_map()};
+    TestCache cache{f};
+    REQUIRE(cache.allocate(2));
+    REQUIRE(cache.open());
+
+    cache.get(0, 0, 0);
+    cache.get(0, 0, 1);
+    CHECK_EQ(cache.misses(), 2);
+
+    cache.get(0, 0, 0);  // Hit, (0, 0, 1) is now least recently used
+    CHECK_EQ(cache.hits(), 1);
+
+    cache.get(1, 0, 0);  // Evicts (0, 0, 1)
+    CHECK_EQ(cache.misses(), 3);
+
+    cache.get(0, 0, 0);
+    CHECK_EQ(cache.hits(), 2);
+
+    cache.get(0, 0, 1);
+    CHECK_EQ(cache.misses(), 4);
+}
+
+TEST_CASE("It does not cache failed reads.") {
+    // Drop the last tile's data so level 1 cannot be read
+    auto data = make_tile_map();
+    data.resize(data.size() - tile_pixels * sizeof(ui::Color));
+    MockFile f{data};
+    TestCache cache{f};
+    REQUIRE(cache.allocate(2));
+    REQUIRE(cache.open());
+
+    CHECK(cache.get(1, 0, 0) == nullptr);
+    CHECK(cache.get(1, 0, 0) == nullptr);
+    CHECK_EQ(cache.hits(), 0);
+    CHECK_NE(cache.get(0, 0, 0), nullptr);
+}
+
+TEST_CASE("It counts the tiles a run of pixels can touch.") {
+    CHECK_EQ(tiles_spanned(1), 1);
+    CHECK_EQ(tiles_spanned(2), 2);
+    CHECK_EQ(tiles_spanned(tile_size + 1), 2);
+    CHECK_EQ(tiles_spanned(tile_size + 2), 3);
+    CHECK_EQ(tiles_spanned(240), 9);
+}
+
+TEST_CASE("It returns nullptr before slots are allocated.") {
+    MockFile f{make_tile_map()};
+    TestCache cache{f};
+    REQUIRE(cache.open());
+    CHECK(cache.get(0, 0, 0) == nullptr);
+    CHECK_EQ(cache.slot_count(), 0);
+}
+
+TEST_CASE("It reports a failed allocation so the caller can fall back.") {
+    MockFile f{make_tile_map()};
+    TestCache cache{f};
+    TestHeap::fail = true;
+    CHECK_FALSE(cache.allocate(2));
+    TestHeap::fail = false;
+    CHECK_EQ(cache.slot_count(), 0);
+    REQUIRE(cache.open());
+    CHECK(cache.get(0, 0, 0) == nullptr);
+}
+
+TEST_CASE("It releases the previous slots when reallocated.") {
+    MockFile f{make_tile_map()};
+    TestCache cache{f};
+    REQUIRE(cache.allocate(2));
+    REQUIRE(cache.open());
+    REQUIRE(cache.get(0, 0, 0) != nullptr);
+    TestHeap::fail = true;
+    CHECK_FALSE(cache.allocate(4));
+    TestHeap::fail = false;
+    CHECK_EQ(cache.slot_count(), 0);
+    CHECK(cache.get(0, 0, 0) == nullptr);
+}
+
+TEST_SUITE_END();
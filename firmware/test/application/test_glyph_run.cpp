@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2026
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "doctest.h"
+#include "ui_text.hpp"
+#include "ui_font_fixed_5x8.hpp"
+#include "ui_font_fixed_8x16.hpp"
+
+#include <array>
+#include <string_view>
+#include <vector>
+
+using namespace ui;
+
+namespace {
+
+constexpr int fb_width = 240;
+constexpr int fb_height = 48;
+const Color fill{0x1234};
+
+struct Framebuffer {
+    std::vector<Color> pixels = std::vector<Color>(fb_width * fb_height, fill);
+
+    void set(int x, int y, Color c) {
+        if (x >= 0 && y >= 0 && x < fb_width && y < fb_height)
+            pixels[y * fb_width + x] = c;
+    }
+};
+
+/* Same pixel walk as ILI9341::draw_bitmap() for an opaque background. */
+void reference_glyph(Framebuffer& fb, Point p, const Glyph& glyph, Color foreground, Color background, int zoom) {
+    const auto pixels = glyph.pixels();
+    for (int y = 0; y < glyph.h(); y++) {
+        for (int x = 0; x < glyph.w(); x++) {
+            const size_t bit_index = y * glyph.w() + x;
+            const auto pixel = pixels[bit_index >> 3] & (1U << (bit_index & 0x7));
+            for (int zy = 0; zy < zoom; zy++)
+                for (int zx = 0; zx < zoom; zx++)
+                    fb.set(p.x() + x * zoom + zx, p.y() + y * zoom + zy, pixel ? foreground : background);
+        }
+    }
+}
+
+/* The per-glyph Painter::draw_string() loop. */
+int reference_string(Framebuffer& fb, Point p, const Font& font, Color foreground, Color background, std::string_view text, int zoom = 1) {
+    bool escape = false;
+    int width = 0;
+    Color pen = foreground;
+
+    for (auto c : text) {
+        if (escape) {
+            if ((uint8_t)c < std::size(term_colors))
+                pen = term_colors[(uint8_t)c];
+            else
+                pen = foreground;
+            escape = false;
+        } else if (c == '\x1B') {
+            escape = true;
+        } else {
+            const auto glyph = font.glyph(c);
+            reference_glyph(fb, p, glyph, pen, background, zoom);
+            p += {glyph.advance().x() * zoom, 0};
+            width += glyph.advance().x();
+        }
+    }
+    return width;
+}
+
+/* Streams the run through one window the way ILI9341::draw_glyph_run() does. */
+int run_string(Framebuffer& fb, Point p, const Font& font, Color foreground, Color background, std::string_view text, int zoom = 1) {
+    const GlyphRun run{font, text, foreground, background, static_cast<uint8_t>(zoom)};
+    const auto r = Rect{p, run.size()}.intersect({0, 0, fb_width, fb_height});
+    std::array<Color, 64> line;
+    for (int y = r.top(); y < r.bottom(); y++) {
+        for (int x = r.left(); x < r.right(); x += line.size()) {
+            const int count = std::min<int>(line.size(), r.right() - x);
+            run.render_scanline(y - p.y(), x - p.x(), count, line.data());
+            for (int i = 0; i < count; i++)
+                fb.set(x + i, y, line[i]);
+        }
+    }
+    return run.advance();
+}
+
+void check_equivalent(Point p, const Font& font, std::string_view text, int zoom = 1) {
+    Framebuffer expected;
+    Framebuffer actual;
+    const auto expected_width = reference_string(expected, p, font, Color::white(), Color::black(), text, zoom);
+    const auto actual_width = run_string(actual, p, font, Color::white(), Color::black(), text, zoom);
+
+    CHECK(actual_width == expected_width);
+    size_t mismatches = 0;
+    for (size_t i = 0; i < expected.pixels.size(); i++)
+        mismatches += expected.pixels[i].v != actual.pixels[i].v;
+    CHECK(mismatches == 0);
+}
+
+}  // namespace
+
+TEST_SUITE_BEGIN("GlyphRun");
+
+TEST_CASE("Plain text matches per-glyph drawing.") {
+    check_equivalent({0, 0}, font::fixed_8x16, "Hello, World! 0123456789");
+    check_equivalent({3, 5}, font::fixed_5x8, "The quick brown fox jumps over the lazy dog");
+}
+
+TEST_CASE("Colour escapes match per-glyph drawing.") {
+    check_equivalent({0, 0}, font::fixed_8x16, "\x1B\x0C" "RED\x1B\x0A" "GRN\x1B\x7F" "DEF\x1B");
+    check_equivalent({1, 1}, font::fixed_5x8, STR_COLOR_YELLOW "warn " STR_COLOR_FOREGROUND "ok");
+}
+
+TEST_CASE("Control and Latin-1 characters match per-glyph drawing.") {
+    check_equivalent({0, 16}, font::fixed_8x16, "\x01\x7F\x85\xA0\xE9\xFF");
+}
+
+TEST_CASE("Zoomed text matches per-glyph drawing.") {
+    for (int zoom = 2; zoom <= 3; zoom++)
+        check_equivalent({2, 0}, font::fixed_8x16, "Zoom", zoom);
+}
+
+TEST_CASE("Text past the edge is clipped.") {
+    // 8x16 glyphs from x=200 run off the 240 pixel framebuffer, and the bottom rows too.
+    check_equivalent({200, 40}, font::fixed_8x16, "clipped text");
+}
+
+TEST_CASE("Empty and escape-only text draws nothing.") {
+    check_equivalent({0, 0}, font::fixed_8x16, "");
+    check_equivalent({0, 0}, font::fixed_8x16, "\x1B\x01");
+}
+
+TEST_SUITE_END();
@@ -0,0 +1,212 @@
+/*
+ * Copyright (C) 2026
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "doctest.h"
+#include "pcm_resampler.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+using namespace pcm;
+
+namespace {
+
+std::vector<int16_t> make_tone(uint32_t rate, float frequency, float amplitude, size_t count) {
+    std::vector<int16_t> samples(count);
+    for (size_t i = 0; i < count; i++)
+        samples[i] = (int16_t)std::lround(amplitude * std::sin(2.0 * M_PI * frequency * i / rate));
+    return samples;
+}
+
+std::vector<int16_t> resample(const std::vector<int16_t>& in, uint32_t in_rate, uint32_t out_rate) {
+    Resampler resampler;
+    resampler.configure(in_rate, out_rate);
+    std::vector<int16_t> out(resampler.output_count(in.size()) + Resampler::taps);
+    size_t in_count = in.size();
+    const size_t produced = resampler.process(in.data(), in_count, out.data(), out.size());
+    out.resize(produced);
+    return out;
+}
+
+struct ToneFit {
+    double amplitude;
+    double residual_db;  // Error power relative to the tone.
+};
+
+/* Least squares fit of a sinusoid at a known frequency, skipping the filter's edges. */
+ToneFit fit_tone(const std::vector<int16_t>& x, uint32_t rate, float frequency) {
+    const size_t skip = 64;
+    double ii = 0, qq = 0;
+    for (size_t n = skip; n < x.size() - skip; n++) {
+        const double w = 2.0 * M_PI * frequency * n / rate;
+        ii += x[n] * std::cos(w);
+        qq += x[n] * std::sin(w);
+    }
+    const double len = x.size() - 2 * skip;
+    ii *= 2.0 / len;
+    qq *= 2.0 / len;
+
+    double error = 0, power = 0;
+    for (size_t n = skip; n < x.size() - skip; n++) {
+        const double w = 2.0 * M_PI * frequency * n / rate;
+        const double fitted = ii * std::cos(w) + qq * std::sin(w);
+        error += (x[n] - fitted) * (x[n] - fitted);
+        power += fitted * fitted;
+    }
+    return {std::sqrt(ii * ii + qq * qq), 10.0 * std::log10(error / power)};
+}
+
+} /* namespace */
+
+TEST_SUITE_BEGIN("PCM resampler");
+
+TEST_CASE("to_mono_s16 normalises 8/16 bit mono and stereo.") {
+    int16_t out[2];
+
+    const uint8_t u8_mono[] = {0x00, 0xFF};
+    REQUIRE(to_mono_s16(u8_mono, 2, 8, 1, out) == 2);
+    CHECK(out[0] == -32768);
+    CHECK(out[1] == 32512);
+
+    const uint8_t u8_stereo[] = {0x80, 0xC0, 0x00, 0x00};
+    REQUIRE(to_mono_s16(u8_stereo, 2, 8, 2, out) == 2);
+    CHECK(out[0] == 0x40 * 128);
+    CHECK(out[1] == -32768);
+
+    const uint8_t s16_mono[] = {0x34, 0x12, 0x00, 0x80};
+    REQUIRE(to_mono_s16(s16_mono, 2, 16, 1, out) == 2);
+    CHECK(out[0] == 0x1234);
+    CHECK(out[1] == -32768);
+
+    const uint8_t s16_stereo[] = {0xFF, 0x7F, 0xFF, 0x7F, 0x00, 0x80, 0x00, 0x10};
+    REQUIRE(to_mono_s16(s16_stereo, 2, 16, 2, out) == 2);
+    CHECK(out[0] == 32767);
+    CHECK(out[1] == (-32768 + 0x1000) / 2);
+
+    CHECK(to_mono_s16(s16_mono, 1, 24, 1, out) == 0);
+    CHECK(to_mono_s16(s16_mono, 1, 16, 6, out) == 0);
+    CHECK_FALSE(is_supported_format(32, 1));
+}
+
+TEST_CASE("Equal rates pass samples through unchanged.") {
+    const auto in = make_tone(48000, 1000, 20000, 1000);
+    const auto out = resample(in, 48000, 48000);
+    CHECK(out == in);
+}
+
+TEST_CASE("Tones keep their frequency and level across common rates.") {
+    constexpr uint32_t out_rate = 48000;
+    for (const uint32_t in_rate : {8000u, 11025u, 22050u, 44100u, 96000u}) {
+        CAPTURE(in_rate);
+        const auto in = make_tone(in_rate, 1000, 16000, in_rate / 4);
+        const auto out = resample(in, in_rate, out_rate);
+
+        CHECK(std::abs((int64_t)out.size() - (int64_t)(in.size() * out_rate / in_rate)) <= (int64_t)Resampler::taps * 6);
+
+        const auto fit = fit_tone(out, out_rate, 1000);
+        CHECK(fit.amplitude == doctest::Approx(16000).epsilon(0.02));
+        CHECK(fit.residual_db < -40.0);
+    }
+}
+
+TEST_CASE("Downsampling rejects tones above the output Nyquist.") {
+    const auto in = make_tone(96000, 40000, 16000, 96000 / 4);
+    const auto out = resample(in, 96000, 48000);
+
+    double power = 0;
+    for (size_t n = 64; n < out.size() - 64; n++)
+        power += (double)out[n] * out[n];
+    const double rms = std::sqrt(power / (out.size() - 128));
+    const double rejection_db = 20.0 * std::log10(rms / (16000 / std::sqrt(2.0)));
+    MESSAGE("40 kHz alias at 96k->48k: " << rejection_db << " dB");
+    CHECK(rejection_db < -40.0);
+}
+
+TEST_CASE("Streaming in uneven blocks matches a single pass.") {
+    const auto in = make_tone(44100, 1234, 12000, 5000);
+    const auto expected = resample(in, 44100, 48000);
+
+    Resampler resampler;
+    resampler.configure(44100, 48000);
+    std::vector<int16_t> out;
+    size_t pos = 0;
+    size_t step = 0;
+    while (pos < in.size()) {
+        int16_t block[37];
+        size_t in_count = std::min<size_t>(1 + (step * 7) % 53, in.size() - pos);
+        const size_t produced = resampler.process(&in[pos], in_count, block, 1 + (step * 11) % 37);
+        out.insert(out.end(), block, block + produced);
+        pos += in_count;
+        step++;
+    }
+
+    CHECK(out == expected);
+}
+
+TEST_CASE("Output count follows the configured rates.") {
+    Resampler resampler;
+    CHECK_EQ(resampler.output_count(8000), 8000);
+
+    resampler.configure(8000, 48000);
+    CHECK_EQ(resampler.output_count(8000), 48000);
+
+    resampler.configure(96000, 48000);
+    CHECK_EQ(resampler.output_count(96000), 48000);
+
+    resampler.configure(44100, 48000);
+    CHECK_EQ(resampler.output_count(44100), 48000);
+    CHECK_EQ(resampler.output_count(1), 2);
+
+    // A single pass only trails the count by the filter delay.
+    const auto in = make_tone(8000, 440, 8000, 4000);
+    resampler.configure(8000, 48000);
+    const size_t expected = resampler.output_count(in.size());
+    const size_t produced = resample(in, 8000, 48000).size();
+    CHECK(produced <= expected);
+    CHECK(expected - produced <= Resampler::taps / 2 * 6);
+}
+
+TEST_CASE("Benchmark 44.1k to 48k.") {
+    const auto in = make_tone(44100, 1000, 16000, 44100);
+    Resampler resampler;
+    resampler.configure(44100, 48000);
+    std::vector<int16_t> out(256);
+
+    const size_t passes = 20;
+    size_t produced = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t p = 0; p < passes; p++) {
+        size_t pos = 0;
+        while (pos < in.size()) {
+            size_t in_count = std::min<size_t>(128, in.size() - pos);
+            produced += resampler.process(&in[pos], in_count, out.data(), out.size());
+            pos += in_count;
+        }
+    }
+    const auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    MESSAGE("host: " << elapsed / produced << " ns per output sample, "
+                     << produced / (elapsed / 1e9) / 48000 << "x real time");
+    CHECK(produced > 0);
+}
+
+TEST_SUITE_END();
@@ -0,0 +1,292 @@
+/*
+ * Copyright (C) 2026
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "doctest.h"
+#include "reed_solomon.hpp"
+#include "sonde_packet.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+namespace {
+
+using Codeword = std::array<uint8_t, reed_solomon::RS255::n>;
+
+/* Small LCG so runs are repeatable. */
+struct Lcg {
+    uint32_t state;
+    uint32_t next() {
+        state = state * 1664525u + 1013904223u;
+        return state >> 8;
+    }
+};
+
+Codeword random_codeword(const reed_solomon::RS255& rs, Lcg& lcg) {
+    Codeword cw{};
+    for (size_t i = rs.parity(); i < cw.size(); i++)
+        cw[i] = lcg.next();
+    rs.encode(cw.data());
+    return cw;
+}
+
+/* Flips `count` distinct bytes to a different value. */
+void inject_errors(Codeword& cw, const size_t count, Lcg& lcg) {
+    std::array<bool, reed_solomon::RS255::n> hit{};
+    for (size_t e = 0; e < count;) {
+        const size_t pos = lcg.next() % cw.size();
+        if (hit[pos]) continue;
+        hit[pos] = true;
+        cw[pos] ^= 1 + lcg.next() % 255;
+        e++;
+    }
+}
+
+}  // namespace
+
+TEST_SUITE_BEGIN("reed_solomon");
+
+TEST_CASE("Encoded codewords decode clean.") {
+    const reed_solomon::RS255 rs{24};
+    Lcg lcg{1};
+    auto cw = random_codeword(rs, lcg);
+    const auto original = cw;
+
+    CHECK_EQ(rs.decode(cw.data()), 0);
+    CHECK(cw == original);
+}
+
+TEST_CASE("Up to parity/2 byte errors are corrected.") {
+    const reed_solomon::RS255 rs{24};
+    Lcg lcg{2};
+
+    for (size_t errors = 1; errors <= 12; errors++) {
+        for (size_t trial = 0; trial < 20; trial++) {
+            auto cw = random_codeword(rs, lcg);
+            const auto original = cw;
+            inject_errors(cw, errors, lcg);
+
+            REQUIRE_EQ(rs.decode(cw.data()), (int)errors);
+            REQUIRE(cw == original);
+        }
+    }
+}
+
+TEST_CASE("Errors in the parity bytes are corrected.") {
+    const reed_solomon::RS255 rs{24};
+    Lcg lcg{3};
+    auto cw = random_codeword(rs, lcg);
+    const auto original = cw;
+    cw[0] ^= 0xFF;
+    cw[23] ^= 0x01;
+
+    CHECK_EQ(rs.decode(cw.data()), 2);
+    CHECK(cw == original);
+}
+
+TEST_CASE("Too many errors are reported and leave the codeword alone.") {
+    const reed_solomon::RS255 rs{24};
+    Lcg lcg{4};
+    size_t rejected = 0;
+
+    for (size_t trial = 0; trial < 50; trial++) {
+        auto cw = random_codeword(rs, lcg);
+        inject_errors(cw, 16, lcg);
+        const auto damaged = cw;
+
+        const int result = rs.decode(cw.data());
+        if (result < 0) {
+            rejected++;
+            CHECK(cw == damaged);
+        }
+    }
+    /* Miscorrection beyond t is possible but rare for RS(255,231). */
+    CHECK(rejected >= 48);
+}
+
+namespace {
+
+/* ISO/IEC 18004 (QR code) uses the same field and roots alpha^0 ..: version
+ * 1-M symbols are RS(255, 245) shortened to 16 data and 10 parity bytes.
+ * Data first, highest order coefficient first. */
+struct PublishedVector {
+    std::array<uint8_t, 16> data;
+    std::array<uint8_t, 10> parity;
+};
+
+constexpr PublishedVector qr_vectors[] = {
+    /* "01234567", ISO/IEC 18004 Annex I. */
+    {{0x10, 0x20, 0x0C, 0x56, 0x61, 0x80, 0xEC, 0x11, 0xEC, 0x11, 0xEC, 0x11, 0xEC, 0x11, 0xEC, 0x11},
+     {0xA5, 0x24, 0xD4, 0xC1, 0xED, 0x36, 0xC7, 0x87, 0x2C, 0x55}},
+    /* "HELLO WORLD", the worked example of the thonky.com QR code tutorial. */
+    {{0x20, 0x5B, 0x0B, 0x78, 0xD1, 0x72, 0xDC, 0x4D, 0x43, 0x40, 0xEC, 0x11, 0xEC, 0x11, 0xEC, 0x11},
+     {0xC4, 0x23, 0x27, 0x77, 0xEB, 0xD7, 0xE7, 0xE2, 0x5D, 0x17}},
+};
+
+Codeword to_codeword(const PublishedVector& v) {
+    Codeword cw{};
+    for (size_t i = 0; i < v.data.size(); i++)
+        cw[v.parity.size() + v.data.size() - 1 - i] = v.data[i];
+    for (size_t i = 0; i < v.parity.size(); i++)
+        cw[v.parity.size() - 1 - i] = v.parity[i];
+    return cw;
+}
+
+}  // namespace
+
+TEST_CASE("Encoding matches published QR code vectors.") {
+    const reed_solomon::RS255 rs{10};
+    for (const auto& v : qr_vectors) {
+        const auto expected = to_codeword(v);
+        auto cw = expected;
+        std::fill(cw.begin(), cw.begin() + 10, 0);
+        rs.encode(cw.data());
+        CHECK(cw == expected);
+    }
+}
+
+TEST_CASE("Published QR code vectors decode with errors.") {
+    const reed_solomon::RS255 rs{10};
+    for (const auto& v : qr_vectors) {
+        const auto expected = to_codeword(v);
+        auto cw = expected;
+        cw[2] ^= 0x5A;   // parity
+        cw[12] ^= 0x01;  // data
+        cw[25] ^= 0xFF;  // first data byte
+        CHECK_EQ(rs.decode(cw.data()), 3);
+        CHECK(cw == expected);
+    }
+}
+
+TEST_CASE("Other generator roots.") {
+    const reed_solomon::RS255 rs{16, 112};
+    Lcg lcg{5};
+    auto cw = random_codeword(rs, lcg);
+    const auto original = cw;
+    inject_errors(cw, 8, lcg);
+
+    CHECK_EQ(rs.decode(cw.data()), 8);
+    CHECK(cw == original);
+}
+
+TEST_SUITE_END();
+
+namespace {
+
+/* RS41 frame as sonde::Packet sees it: the 4 sync bytes are already gone. */
+constexpr size_t rs41_bytes = 320;
+constexpr size_t rs41_frame_len = 316;
+constexpr size_t pos_parity = 0x04;
+constexpr size_t pos_data = 0x34;
+
+constexpr uint8_t mask[64] = {
+    0x96, 0x83, 0x3E, 0x51, 0xB1, 0x49, 0x08, 0x98, 0x32, 0x05, 0x59, 0x0E, 0xF9, 0x44, 0xC6, 0x26,
+    0x21, 0x60, 0xC2, 0xEA, 0x79, 0x5D, 0x6D, 0xA1, 0x54, 0x69, 0x47, 0x0C, 0xDC, 0xE8, 0x5C, 0xF1,
+    0xF7, 0x76, 0x82, 0x7F, 0x07, 0x99, 0xA2, 0x2C, 0x93, 0x7C, 0x30, 0x63, 0xF5, 0x10, 0x2E, 0x61,
+    0xD0, 0xBC, 0xB4, 0xB6, 0x06, 0xAA, 0xF4, 0x23, 0x78, 0x6E, 0x3B, 0xAE, 0xBF, 0x7B, 0x4C, 0xC1};
+
+void add_block(std::array<uint8_t, rs41_bytes>& frame, const size_t start, const uint8_t id, const uint8_t length) {
+    frame[start] = id;
+    frame[start + 1] = length;
+    uint32_t crc = 0xFFFF;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= frame[start + 2 + i] << 8;
+        for (size_t j = 0; j < 8; j++)
+            crc = ((crc & 0x8000) ? (crc << 1) ^ 0x1021 : (crc << 1)) & 0xFFFF;
+    }
+    frame[start + 2 + length] = crc & 0xFF;
+    frame[start + 3 + length] = crc >> 8;
+}
+
+std::array<uint8_t, rs41_bytes> make_rs41_frame() {
+    std::array<uint8_t, rs41_bytes> frame{};
+    Lcg lcg{6};
+    for (size_t i = pos_data; i < rs41_frame_len; i++)
+        frame[i] = lcg.next();
+
+    frame[0x37] = 0x34;  // frame number 0x1234
+    frame[0x38] = 0x12;
+    std::memcpy(&frame[0x39], "T1234567", 8);
+    add_block(frame, 0x35, 0x79, 0x28);
+    add_block(frame, 0x61, 0x7A, 0x2A);
+    add_block(frame, 0x10E, 0x7B, 0x15);
+    for (size_t i = rs41_frame_len; i < rs41_bytes; i++)
+        frame[i] = 0;
+
+    const reed_solomon::RS255 rs{24};
+    for (size_t c = 0; c < 2; c++) {
+        Codeword cw{};
+        for (size_t i = 0; i < cw.size() - 24; i++) {
+            const size_t pos = pos_data + c + 2 * i;
+            if (pos < rs41_frame_len) cw[24 + i] = frame[pos];
+        }
+        rs.encode(cw.data());
+        std::memcpy(&frame[pos_parity + c * 24], cw.data(), 24);
+    }
+    return frame;
+}
+
+sonde::Packet to_packet(const std::array<uint8_t, rs41_bytes>& frame) {
+    baseband::Packet packet{};
+    for (size_t pos = 0; pos < frame.size(); pos++) {
+        const uint8_t scrambled = frame[pos] ^ mask[(pos + 4) % 64];
+        for (size_t bit = 0; bit < 8; bit++)
+            packet.add((scrambled >> bit) & 1);
+    }
+    return {packet, sonde::Packet::Type::Vaisala_RS41_SG};
+}
+
+}  // namespace
+
+TEST_SUITE_BEGIN("RS41 error correction");
+
+TEST_CASE("A clean frame passes through.") {
+    const auto packet = to_packet(make_rs41_frame());
+    CHECK_EQ(packet.ecc_errors(), 0);
+    CHECK(packet.crc_ok());
+    CHECK_EQ(packet.serial_number(), "T1234567");
+    CHECK_EQ(packet.frame(), 0x1234u);
+}
+
+TEST_CASE("Byte errors in both codewords are repaired before the CRC check.") {
+    auto frame = make_rs41_frame();
+    /* Serial, frame number, CRC and GPS bytes across both codewords, plus parity. */
+    for (const size_t pos : {0x05, 0x30, 0x37, 0x38, 0x3A, 0x3D, 0x5F, 0x6C, 0x110, 0x111, 0x115, 0x124})
+        frame[pos] ^= 0x5A;
+
+    const auto packet = to_packet(frame);
+    CHECK_EQ(packet.ecc_errors(), 12);
+    CHECK(packet.crc_ok());
+    CHECK_EQ(packet.serial_number(), "T1234567");
+    CHECK_EQ(packet.frame(), 0x1234u);
+}
+
+TEST_CASE("A frame beyond repair is left as received.") {
+    auto frame = make_rs41_frame();
+    for (size_t i = 0; i < 30; i++)
+        frame[0x40 + 2 * i] ^= 0xA5;
+
+    const auto packet = to_packet(frame);
+    CHECK_EQ(packet.ecc_errors(), -1);
+    CHECK_FALSE(packet.crc_ok());
+}
+
+TEST_SUITE_END();
@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2026
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "baseband_profiler.hpp"
+#include "doctest.h"
+
+using namespace baseband::profile;
+
+TEST_CASE("profile buckets are quarter octaves") {
+    CHECK(bucket_index(0) == 0);
+    CHECK(bucket_index(63) == 0);
+    CHECK(bucket_index(64) == 1);
+    CHECK(bucket_index(79) == 1);
+    CHECK(bucket_index(80) == 2);
+    CHECK(bucket_index(127) == 4);
+    CHECK(bucket_index(128) == 5);
+    CHECK(bucket_index(UINT32_MAX) == bucket_count - 1);
+
+    for (uint32_t cycles = 64; cycles < (1U << 20); cycles += 997) {
+        const auto index = bucket_index(cycles);
+        CHECK(cycles < bucket_upper(index));
+        CHECK(cycles >= bucket_upper(index - 1));
+    }
+}
+
+TEST_CASE("profile tracks min, mean, max and p99") {
+    StageStats stats{};
+    reset(stats);
+
+    for (uint32_t i = 0; i < 990; i++) {
+        record(stats, 1000);
+    }
+    for (uint32_t i = 0; i < 10; i++) {
+        record(stats, 100000);
+    }
+
+    CHECK(stats.count == 1000);
+    CHECK(stats.min == 1000);
+    CHECK(stats.max == 100000);
+    CHECK(mean(stats) == 1990);
+    CHECK(percentile(stats, 99) == bucket_upper(bucket_index(1000)));
+    CHECK(percentile(stats, 100) == 100000);
+}
+
+TEST_CASE("profile histogram halves instead of saturating") {
+    StageStats stats{};
+    reset(stats);
+
+    for (uint32_t i = 0; i < 70000; i++) {
+        record(stats, 200);
+    }
+    record(stats, 5000);
+
+    CHECK(stats.count == 70001);
+    CHECK(stats.histogram[bucket_index(200)] > 0);
+    CHECK(stats.histogram[bucket_index(200)] < UINT16_MAX);
+    CHECK(percentile(stats, 50) == bucket_upper(bucket_index(200)));
+}
+
+TEST_CASE("stage timer records each lap once") {
+    Profile profile{};
+    reset(profile);
+
+    {
+        StageTimer timer{profile, Stage::Decim0};
+        timer.lap(Stage::Demod);
+        timer.lap(Stage::AudioOutput);
+        timer.stop();
+    }
+
+    CHECK(profile.stages[static_cast<size_t>(Stage::Decim0)].count == 1);
+    CHECK(profile.stages[static_cast<size_t>(Stage::Demod)].count == 1);
+    CHECK(profile.stages[static_cast<size_t>(Stage::AudioOutput)].count == 1);
+    CHECK(profile.stages[static_cast<size_t>(Stage::Execute)].count == 0);
+}
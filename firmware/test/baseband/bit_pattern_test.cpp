@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2026
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "bit_pattern.hpp"
+#include "doctest.h"
+
+namespace {
+
+BitHistory history_of(const uint64_t bits, const size_t length) {
+    BitHistory history{};
+    for (size_t i = length; i > 0; i--) {
+        history.add((bits >> (i - 1)) & 1);
+    }
+    return history;
+}
+
+}  // namespace
+
+TEST_SUITE_BEGIN("BitPattern");
+
+TEST_CASE("Matches the sync word at the end of the history") {
+    const BitPattern pattern{0b0101010101111110, 16};
+
+    CHECK(pattern(history_of(0b1110101010101111110, 19), 0));
+    CHECK_FALSE(pattern(history_of(0b0101010101111110 << 1, 17), 0));
+}
+
+TEST_CASE("Hamming distance tolerance") {
+    const BitPattern pattern{0b0101010101111110, 16, 1};
+
+    CHECK(pattern(history_of(0b0101010101111110, 16), 0));
+    CHECK(pattern(history_of(0b0101011101111110, 16), 0));
+    CHECK_FALSE(pattern(history_of(0b0101011101111111, 16), 0));
+}
+
+TEST_CASE("Full 64 bit sync words") {
+    const uint64_t header = 0b0000100001101101010100111000100001000100011010010100100000011111;
+    const BitPattern pattern{header, 64, 2};
+
+    CHECK(pattern.matches(header));
+    CHECK(pattern.matches(header ^ 0x8000000000000001ULL));
+    CHECK_FALSE(pattern.matches(header ^ 0x8000000100000001ULL));
+}
+
+TEST_CASE("Empty pattern never constrains") {
+    const BitPattern pattern{};
+
+    CHECK(pattern.matches(0));
+    CHECK(pattern.matches(~0ULL));
+}
+
+TEST_SUITE_END();
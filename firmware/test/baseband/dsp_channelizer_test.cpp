@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2026
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "dsp_channelizer.hpp"
+#include "doctest.h"
+
+#include <vector>
+
+namespace {
+
+using Channelizer = dsp::channelize::PolyphaseChannelizer<32, 8>;
+
+/* Feeds a complex tone at `bin` channel spacings from DC, returns mean power per channel. */
+std::array<float, Channelizer::channel_count> channel_powers(const float bin) {
+    constexpr size_t M = Channelizer::channel_count;
+    constexpr size_t count = M * 64;
+    constexpr float pi = 3.14159265358979323846f;
+
+    std::vector<complex16_t> samples(count);
+    for (size_t n = 0; n < count; n++) {
+        const float phi = 2.0f * pi * bin * n / M;
+        samples[n] = {
+            static_cast<int16_t>(std::round(8192.0f * std::cos(phi))),
+            static_cast<int16_t>(std::round(8192.0f * std::sin(phi)))};
+    }
+
+    Channelizer channelizer{};
+    std::array<float, M> powers{};
+    size_t outputs = 0;
+    channelizer.execute(
+        buffer_c16_t{samples.data(), samples.size()},
+        [&](const Channelizer::output_t& channels) {
+            /* skip filter fill */
+            if (++outputs <= Channelizer::taps_count / M) return;
+            for (size_t c = 0; c < M; c++) {
+                powers[c] += std::norm(channels[c]);
+            }
+        });
+
+    for (auto& power : powers) {
+        power /= (outputs - Channelizer::taps_count / M);
+    }
+    return powers;
+}
+
+}  // namespace
+
+TEST_CASE("channelizer emits one output vector per M input samples") {
+    Channelizer channelizer{};
+    std::array<complex16_t, 100> samples{};
+    size_t outputs = 0;
+    channelizer.execute(
+        buffer_c16_t{samples.data(), samples.size()},
+        [&](const Channelizer::output_t&) { outputs++; });
+    CHECK(outputs == 100 / Channelizer::channel_count);
+}
+
+TEST_CASE("channelizer has unity gain at channel center") {
+    const auto powers = channel_powers(3.0f);
+    CHECK(std::sqrt(powers[3]) == doctest::Approx(8192.0f).epsilon(0.01));
+}
+
+TEST_CASE("channelizer maps positive and negative offsets to FFT bin order") {
+    for (const int bin : {0, 1, 7, 15, -1, -9, -16}) {
+        const auto powers = channel_powers(static_cast<float>(bin));
+        const size_t expected = (bin + Channelizer::channel_count) % Channelizer::channel_count;
+        for (size_t c = 0; c < Channelizer::channel_count; c++) {
+            if (c == expected) continue;
+            /* Neighbour channels see at least 50dB rejection. */
+            CHECK(10.0f * std::log10(powers[c] / powers[expected]) < -50.0f);
+        }
+    }
+}
@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2026
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "dsp_coded_squelch.hpp"
+#include "doctest.h"
+
+#include <cmath>
+#include <vector>
+
+namespace {
+
+using Detector = dsp::CodedSquelchDetector;
+using Result = Detector::Result;
+
+constexpr float pi = 3.14159265358979323846f;
+constexpr size_t fs = Detector::input_rate;
+
+/* Roughly gaussian noise with the given standard deviation (sum of 12 uniforms). */
+class Noise {
+   public:
+    Noise(const float sigma, const uint32_t seed)
+        : sigma{sigma}, state{seed} {}
+
+    float operator()() {
+        float sum = -6.0f;
+        for (size_t i = 0; i < 12; i++) {
+            state = state * 1664525U + 1013904223U;
+            sum += (state >> 8) * (1.0f / 16777216.0f);
+        }
+        return sum * sigma;
+    }
+
+   private:
+    const float sigma;
+    uint32_t state;
+};
+
+/* Encodes a DCS code as the 23 bit word, bit 0 sent first. */
+uint32_t dcs_word(const uint32_t code) {
+    const uint32_t data = (0b100 << 9) | code;
+    uint32_t remainder = data << 11;
+    for (int b = 22; b >= 11; b--) {
+        if (remainder & (1U << b)) remainder ^= 0xC75U << (b - 11);
+    }
+    return (remainder << 12) | data;
+}
+
+/* Runs the detector in 8 sample chunks (as proc_nfm_audio does), returns the
+ * last result and the time of the first one in ms, or -1 if none. */
+int run(Detector& detector, const std::vector<int16_t>& audio, Result& last) {
+    int first_ms = -1;
+    for (size_t i = 0; i + 8 <= audio.size(); i += 8) {
+        detector.execute({const_cast<int16_t*>(&audio[i]), 8, fs});
+        Result result;
+        while (detector.pop(result)) {
+            if (first_ms < 0) first_ms = (i + 8) * 1000 / fs;
+            last = result;
+        }
+    }
+    return first_ms;
+}
+
+std::vector<int16_t> tone(const float f, const float seconds, const float amplitude, const float noise, const uint32_t seed = 1) {
+    Noise gauss{noise, seed};
+    std::vector<int16_t> audio(seconds * fs);
+    for (size_t n = 0; n < audio.size(); n++) {
+        audio[n] = amplitude * std::sin(2.0f * pi * f * n / fs) + gauss();
+    }
+    return audio;
+}
+
+std::vector<int16_t> dcs(const uint32_t code, const bool inverted, const float seconds, const float amplitude, const float noise) {
+    Noise gauss{noise, 2};
+    const uint32_t word = dcs_word(code);
+    std::vector<int16_t> audio(seconds * fs);
+    for (size_t n = 0; n < audio.size(); n++) {
+        const size_t bit = static_cast<size_t>(n * 134.4f / fs) % 23;
+        const bool level = ((word >> bit) & 1) != inverted;
+        audio[n] = (level ? amplitude : -amplitude) + gauss();
+    }
+    return audio;
+}
+
+}  // namespace
+
+TEST_SUITE_BEGIN("CodedSquelchDetector");
+
+TEST_CASE("DCS word encoding is a codeword") {
+    CHECK(Detector::dcs_is_codeword(dcs_word(0023)));
+    CHECK(Detector::dcs_is_codeword(dcs_word(0754)));
+    CHECK(Detector::dcs_is_codeword(~dcs_word(0023) & 0x7FFFFF));
+    CHECK_FALSE(Detector::dcs_is_codeword(dcs_word(0023) ^ 0x10));
+    CHECK(Detector::dcs_is_standard_code(0023));
+    CHECK_FALSE(Detector::dcs_is_standard_code(0024));
+}
+
+TEST_CASE("CTCSS tone in noise is detected quickly") {
+    Detector detector;
+    Result result;
+    const auto first_ms = run(detector, tone(100.0f, 0.5f, 3000.0f, 1500.0f), result);
+
+    REQUIRE(first_ms >= 0);
+    CHECK(first_ms <= 160);
+    CHECK(result.type == Result::Type::CTCSS);
+    CHECK(result.value == 10000);
+    CHECK(result.confidence >= 40);
+}
+
+TEST_CASE("Adjacent CTCSS tones are told apart") {
+    for (const auto& expected : {15980, 16220, 6700, 25410}) {
+        Detector detector;
+        Result result;
+        REQUIRE(run(detector, tone(expected / 100.0f, 0.5f, 3000.0f, 1000.0f, expected), result) >= 0);
+        CHECK(result.value == expected);
+    }
+}
+
+TEST_CASE("Noise alone is not reported as a tone") {
+    Detector detector;
+    Result result;
+    CHECK(run(detector, tone(100.0f, 1.0f, 0.0f, 3000.0f), result) < 0);
+}
+
+TEST_CASE("DCS code is decoded") {
+    Detector detector;
+    Result result;
+    REQUIRE(run(detector, dcs(0023, false, 0.6f, 3000.0f, 600.0f), result) >= 0);
+    CHECK(result.type == Result::Type::DCS);
+    CHECK(result.value == 0023);
+    CHECK_FALSE(result.inverted);
+}
+
+TEST_CASE("Inverted DCS code decodes as its normal alias") {
+    /* 023I and 047N are the same bit stream. */
+    Detector detector;
+    Result result;
+    REQUIRE(run(detector, dcs(0023, true, 0.6f, 3000.0f, 600.0f), result) >= 0);
+    CHECK(result.type == Result::Type::DCS);
+    CHECK(result.value == 0047);
+    CHECK_FALSE(result.inverted);
+}
+
+TEST_SUITE_END();
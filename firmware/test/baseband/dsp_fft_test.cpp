@@ -22,6 +22,9 @@
 #include "dsp_fft.hpp"
 #include "doctest.h"
 
+#include <algorithm>
+#include <vector>
+
 TEST_CASE("ifft successfully calculates dc on zero frequency") {
     uint32_t fft_width = 8;
     complex16_t* v = new complex16_t[fft_width];
@@ -123,3 +126,127 @@ TEST_CASE("ifft successfully calculates pure sine of half the sample rate") {
     delete[] v;
     delete[] tmp;
 }
+
+TEST_CASE("ifft_q15 twiddles are Q15 unit vectors") {
+    complex16_t w[8];
+    ifft_q15_twiddles(w, 16);
+
+    CHECK(w[0] == complex16_t{32767, 0});
+    CHECK(w[4] == complex16_t{0, 32767});
+    CHECK(w[2] == complex16_t{23170, 23170});
+}
+
+TEST_CASE("ifft_q15 scales a DC bin down by n") {
+    constexpr size_t n = 8;
+    complex16_t w[n / 2];
+    complex16_t v[n]{};
+    ifft_q15_twiddles(w, n);
+
+    v[0] = {16384, 0};
+    ifft_q15(v, n, w);
+
+    for (size_t i = 0; i < n; i++)
+        CHECK(v[i] == complex16_t{2048, 0});
+}
+
+TEST_CASE("ifft_q15 calculates sine of quarter the sample rate") {
+    constexpr size_t n = 8;
+    complex16_t w[n / 2];
+    complex16_t v[n]{};
+    ifft_q15_twiddles(w, n);
+
+    v[2] = {8192, 0};
+    ifft_q15(v, n, w);
+
+    const complex16_t expected[n] = {{1024, 0}, {0, 1024}, {-1024, 0}, {0, -1024}, {1024, 0}, {0, 1024}, {-1024, 0}, {0, -1024}};
+    for (size_t i = 0; i < n; i++) {
+        CHECK(std::abs(v[i].real() - expected[i].real()) <= 1);
+        CHECK(std::abs(v[i].imag() - expected[i].imag()) <= 1);
+    }
+}
+
+TEST_CASE("ifft_q15 doesn't overflow on full scale input") {
+    constexpr size_t n = 256;
+    complex16_t w[n / 2];
+    complex16_t v[n];
+    ifft_q15_twiddles(w, n);
+
+    for (size_t i = 0; i < n; i++)
+        v[i] = {32767, 0};
+    ifft_q15(v, n, w);
+
+    // Each halving stage may round down by one count
+    CHECK(v[0].real() >= 32767 - (int)log_2(n));
+    for (size_t i = 1; i < n; i++)
+        CHECK(std::abs(v[i].real()) <= 8);
+}
+
+TEST_CASE("ifft_q15 matches a floating point inverse DFT") {
+    uint32_t lcg = 1;
+    auto next = [&lcg]() {
+        lcg = lcg * 1664525 + 1013904223;
+        return (int16_t)((int32_t)(lcg >> 16) % 23000);
+    };
+
+    for (size_t n : {16, 128, 1024}) {
+        std::vector<complex16_t> w(n / 2);
+        std::vector<complex16_t> v(n);
+        ifft_q15_twiddles(w.data(), n);
+        for (auto& x : v)
+            x = {next(), next()};
+        const auto input = v;
+
+        ifft_q15(v.data(), n, w.data());
+
+        // Rounding in each of the log2(n) stages adds up to about a count per stage
+        const double tolerance = log_2(n) + 1;
+        double worst = 0;
+        for (size_t k = 0; k < n; k++) {
+            double re = 0, im = 0;
+            for (size_t m = 0; m < n; m++) {
+                const double angle = 2 * 3.14159265358979323846 * ((k * m) % n) / n;
+                re += input[m].real() * std::cos(angle) - input[m].imag() * std::sin(angle);
+                im += input[m].real() * std::sin(angle) + input[m].imag() * std::cos(angle);
+            }
+            worst = std::max({worst, std::abs(re / n - v[k].real()), std::abs(im / n - v[k].imag())});
+        }
+        CHECK(worst <= tolerance);
+    }
+}
+
+TEST_CASE("fft_r_split_bin matches a floating point DFT of real input") {
+    constexpr size_t n = 64;
+    std::array<float, 2 * n> x{};
+    uint32_t lcg = 7;
+    for (auto& s : x) {
+        lcg = lcg * 1103515245 + 12345;
+        s = (int16_t)(lcg >> 16);
+    }
+
+    // Pack pairs of real samples into bit reversed complex points.
+    std::array<std::complex<float>, n> Z{};
+    for (size_t i = 0; i < n; i++) {
+        size_t i_rev = 0;
+        for (size_t b = 0; b < log_2(n); b++)
+            i_rev |= ((i >> b) & 1) << (log_2(n) - 1 - b);
+        Z[i_rev] = {x[2 * i], x[2 * i + 1]};
+    }
+    fft_c_preswapped(Z, 0, log_2(n));
+
+    double max_error = 0;
+    double peak = 0;
+    for (size_t k = 0; k < n; k++) {
+        const float angle = -pi * k / n;
+        const auto bin = fft_r_split_bin(Z, k, std::complex<float>{std::cos(angle), std::sin(angle)});
+
+        std::complex<double> ref{};
+        for (size_t i = 0; i < 2 * n; i++)
+            ref += (double)x[i] * std::polar(1.0, -2.0 * pi * k * i / (2 * n));
+
+        max_error = std::max(max_error, std::abs(std::complex<double>(bin.real(), bin.imag()) - ref));
+        peak = std::max(peak, std::abs(ref));
+    }
+
+    // Within single precision rounding of the largest bin.
+    CHECK(max_error < peak * 1e-5);
+}
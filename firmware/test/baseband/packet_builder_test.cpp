@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2026
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "packet_builder.hpp"
+#include "doctest.h"
+
+#include <vector>
+
+/* PacketBuilder::deliver() stamps packets with the RTC, which the host doesn't have. */
+Timestamp Timestamp::now() {
+    return {};
+}
+
+namespace {
+
+/* Deterministic pseudo random source for payloads, noise and batch sizes. */
+struct Lcg {
+    uint32_t state;
+
+    uint32_t next() {
+        state = state * 1664525 + 1013904223;
+        return state;
+    }
+
+    uint8_t bit() {
+        return next() >> 31;
+    }
+};
+
+using Bits = std::vector<uint8_t>;
+
+struct Collector {
+    std::vector<Bits> packets{};
+
+    void on_packet(const baseband::Packet& packet) {
+        Bits bits(packet.size());
+        for (size_t i = 0; i < packet.size(); i++)
+            bits[i] = packet[i];
+        packets.push_back(bits);
+    }
+};
+
+using Handler = PacketHandler<Collector, &Collector::on_packet>;
+
+void append(Bits& bits, const uint64_t value, const size_t length) {
+    for (size_t i = length; i > 0; i--)
+        bits.push_back((value >> (i - 1)) & 1);
+}
+
+void append_noise(Bits& bits, Lcg& lcg, const size_t length) {
+    for (size_t i = 0; i < length; i++)
+        bits.push_back(lcg.bit());
+}
+
+/* Feeds the same bits one at a time and in random sized batches. */
+template <typename Builder>
+void feed_both(Builder& bitwise, Builder& batched, const Bits& bits, Lcg& lcg) {
+    for (const auto bit : bits)
+        bitwise.execute(bit);
+
+    size_t i = 0;
+    while (i < bits.size()) {
+        const size_t n = std::min<size_t>(1 + lcg.next() % 200, bits.size() - i);
+        batched.execute(&bits[i], n);
+        i += n;
+    }
+}
+
+constexpr uint64_t sync_word = 0b1111100101010011000111;
+constexpr size_t sync_length = 22;
+
+}  // namespace
+
+TEST_SUITE_BEGIN("PacketBuilder");
+
+TEST_CASE("Batched fixed length payloads match the bitwise path") {
+    constexpr size_t payload_length = 96;
+    Collector bitwise_packets{};
+    Collector batched_packets{};
+    PacketBuilder<BitPattern, NeverMatch, FixedLength, Handler> bitwise{
+        {sync_word, sync_length, 1}, {}, {payload_length}, {&bitwise_packets}};
+    PacketBuilder<BitPattern, NeverMatch, FixedLength, Handler> batched{
+        {sync_word, sync_length, 1}, {}, {payload_length}, {&batched_packets}};
+
+    Lcg lcg{1};
+    Bits bits{};
+    for (size_t n = 0; n < 40; n++) {
+        append_noise(bits, lcg, lcg.next() % 300);
+        /* Every fourth sync word carries one bit error, within the tolerance. */
+        append(bits, (n % 4) ? sync_word : sync_word ^ (1ULL << (n % sync_length)), sync_length);
+        append_noise(bits, lcg, payload_length);
+    }
+    /* Cut off in the middle of a payload: neither path may deliver it. */
+    append(bits, sync_word, sync_length);
+    append_noise(bits, lcg, payload_length / 2);
+
+    feed_both(bitwise, batched, bits, lcg);
+
+    CHECK(bitwise_packets.packets.size() >= 40);
+    CHECK(batched_packets.packets == bitwise_packets.packets);
+}
+
+TEST_CASE("Batched stuffed payloads match the bitwise path") {
+    /* AIS framing: HDLC flag after the training sequence, bit stuffing, flag at the end. */
+    Collector bitwise_packets{};
+    Collector batched_packets{};
+    PacketBuilder<BitPattern, BitPattern, BitPattern, Handler> bitwise{
+        {0b0101010101111110, 16, 1}, {0b111110, 6}, {0b01111110, 8}, {&bitwise_packets}};
+    PacketBuilder<BitPattern, BitPattern, BitPattern, Handler> batched{
+        {0b0101010101111110, 16, 1}, {0b111110, 6}, {0b01111110, 8}, {&batched_packets}};
+
+    Lcg lcg{2};
+    Bits bits{};
+    for (size_t n = 0; n < 40; n++) {
+        append_noise(bits, lcg, lcg.next() % 300);
+        append(bits, 0b0101010101111110, 16);
+
+        size_t ones = 0;
+        for (size_t i = 0; i < 168; i++) {
+            const auto bit = lcg.bit();
+            bits.push_back(bit);
+            ones = bit ? ones + 1 : 0;
+            if (ones == 5) {
+                bits.push_back(0);
+                ones = 0;
+            }
+        }
+        append(bits, 0b01111110, 8);
+    }
+
+    feed_both(bitwise, batched, bits, lcg);
+
+    CHECK(bitwise_packets.packets.size() >= 40);
+    CHECK(batched_packets.packets == bitwise_packets.packets);
+}
+
+TEST_SUITE_END();
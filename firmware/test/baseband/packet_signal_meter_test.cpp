@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2026
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "packet_signal_meter.hpp"
+#include "doctest.h"
+
+#include <cmath>
+#include <vector>
+
+namespace {
+
+constexpr uint32_t sample_rate = 38400;
+constexpr size_t block_size = 32;
+
+/* Deterministic noise, uniform in [-1, 1). */
+struct Lcg {
+    uint32_t state;
+
+    float next() {
+        state = state * 1664525 + 1013904223;
+        return (state >> 8) * (2.0f / (1 << 24)) - 1.0f;
+    }
+};
+
+class SignalSource {
+   public:
+    /* Feeds samples blocks of a carrier at offset_hz with the given full
+     * scale amplitude, over noise of noise_amplitude. */
+    void feed(PacketSignalMeter& meter, size_t samples, float amplitude, float offset_hz, float noise_amplitude) {
+        std::array<complex16_t, block_size> block{};
+        while (samples > 0) {
+            const size_t n = std::min(samples, block_size);
+            for (size_t i = 0; i < n; i++) {
+                const float re = amplitude * std::cos(phase) + noise_amplitude * lcg.next();
+                const float im = amplitude * std::sin(phase) + noise_amplitude * lcg.next();
+                block[i] = {static_cast<int16_t>(re * 32767.0f), static_cast<int16_t>(im * 32767.0f)};
+                phase = std::fmod(phase + 2.0f * pi * offset_hz / sample_rate, 2.0f * pi);
+            }
+            meter.feed({block.data(), n, sample_rate});
+            samples -= n;
+        }
+    }
+
+   private:
+    Lcg lcg{1};
+    float phase{0.0f};
+};
+
+}  // namespace
+
+TEST_SUITE("Packet signal meter") {
+    TEST_CASE("Nothing fed measures as unknown.") {
+        const PacketSignalMeter meter{};
+        const auto metadata = meter.measure(1000, 42);
+        CHECK(metadata.sample_index == 42);
+        CHECK_FALSE(metadata.has_rssi());
+        CHECK_FALSE(metadata.has_snr());
+        CHECK_FALSE(metadata.has_frequency_offset());
+    }
+
+    TEST_CASE("A frame over noise reports power, SNR and carrier offset.") {
+        PacketSignalMeter meter{};
+        SignalSource source{};
+
+        // Quiet channel, then a 20 ms frame at half scale, 1.5 kHz high.
+        source.feed(meter, sample_rate / 10, 0.0f, 0.0f, 0.01f);
+        source.feed(meter, sample_rate / 50, 0.5f, 1500.0f, 0.01f);
+        const auto metadata = meter.measure(sample_rate / 50, 123456);
+
+        CHECK(metadata.sample_index == 123456);
+        CHECK(metadata.rssi == doctest::Approx(-6).epsilon(0.2));
+        // Uniform noise at 0.01 has 10*log10(2 * 0.01^2 / 3) = -42 dB.
+        CHECK(metadata.snr == doctest::Approx(36).epsilon(0.1));
+        CHECK(metadata.frequency_offset == doctest::Approx(1500).epsilon(0.02));
+    }
+
+    TEST_CASE("Negative offsets and quiet frames are measured.") {
+        PacketSignalMeter meter{};
+        SignalSource source{};
+
+        source.feed(meter, sample_rate / 10, 0.0f, 0.0f, 0.001f);
+        source.feed(meter, sample_rate / 25, 0.01f, -2400.0f, 0.001f);
+        const auto metadata = meter.measure(sample_rate / 25, 0);
+
+        CHECK(metadata.rssi == doctest::Approx(-40).epsilon(0.1));
+        CHECK(metadata.snr > 15);
+        CHECK(metadata.frequency_offset == doctest::Approx(-2400).epsilon(0.05));
+    }
+
+    TEST_CASE("Samples after the frame are skipped.") {
+        PacketSignalMeter meter{};
+        SignalSource source{};
+
+        source.feed(meter, sample_rate / 10, 0.0f, 0.0f, 0.01f);
+        source.feed(meter, sample_rate / 50, 0.5f, 1000.0f, 0.01f);
+        source.feed(meter, sample_rate / 50, 0.0f, 0.0f, 0.01f);
+
+        // Measurement is to 2 ms slots; stay clear of the one holding the frame end.
+        const auto tail = meter.measure(sample_rate / 100, 0);
+        CHECK(tail.snr < 3);
+
+        const auto frame = meter.measure(sample_rate / 50, 0, sample_rate / 50);
+        CHECK(frame.rssi == doctest::Approx(-6).epsilon(0.2));
+        CHECK(frame.frequency_offset == doctest::Approx(1000).epsilon(0.05));
+    }
+
+    TEST_CASE("Magnitude only decoders get power but no offset.") {
+        PacketSignalMeter meter{};
+
+        for (size_t i = 0; i < 50; i++)
+            meter.feed_power(2048 * 1e-4f, 2048, 4194304);
+        for (size_t i = 0; i < 10; i++)
+            meter.feed_power(2048 * 0.1f, 2048, 4194304);
+
+        const auto metadata = meter.measure(10 * 2048, 0);
+        CHECK(metadata.rssi == -10);
+        CHECK(metadata.snr == 30);
+        CHECK_FALSE(metadata.has_frequency_offset());
+    }
+}
@@ -0,0 +1,242 @@
+/*
+ * Copyright (C) 2026
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "pocsag_decoder.hpp"
+#include "doctest.h"
+
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+namespace {
+
+constexpr uint32_t sample_rate = 24000;
+constexpr uint32_t sync_codeword = 0x7cd215d8;
+
+/* Deterministic pseudo random source for payloads and noise. */
+struct Lcg {
+    uint32_t state;
+
+    uint32_t next() {
+        state = state * 1664525 + 1013904223;
+        return state;
+    }
+
+    /* Roughly gaussian, unit variance. */
+    float noise() {
+        float sum = 0.0f;
+        for (size_t i = 0; i < 12; i++)
+            sum += (next() >> 8) * (1.0f / (1 << 24));
+        return sum - 6.0f;
+    }
+};
+
+struct Transmission {
+    std::vector<bool> bits;
+    std::vector<pocsag::batch_t> batches;
+};
+
+Transmission make_transmission(Lcg& lcg, size_t preamble_bits, size_t batch_count) {
+    Transmission tx{};
+    for (size_t i = 0; i < preamble_bits; i++)
+        tx.bits.push_back((i & 1) == 0);
+
+    for (size_t b = 0; b < batch_count; b++) {
+        pocsag::batch_t batch{};
+        for (auto& word : batch)
+            word = lcg.next();
+        tx.batches.push_back(batch);
+
+        for (size_t i = 32; i > 0; i--)
+            tx.bits.push_back((sync_codeword >> (i - 1)) & 1);
+        for (auto word : batch)
+            for (size_t i = 32; i > 0; i--)
+                tx.bits.push_back((word >> (i - 1)) & 1);
+    }
+
+    return tx;
+}
+
+/* FSK demodulator output: '1' is negative. Band limited, with a DC offset,
+ * a baud rate error and additive noise, framed by 100ms of noise. */
+std::vector<float> modulate(Lcg& lcg, const std::vector<bool>& bits, float baud, float noise_rms) {
+    std::vector<float> audio{};
+    const size_t lead_in = sample_rate / 10;
+    for (size_t i = 0; i < lead_in; i++)
+        audio.push_back(0.1f + noise_rms * lcg.noise());
+
+    const float samples_per_bit = sample_rate / baud;
+    const float alpha = 1.0f - std::exp(-2.0f * 3.14159265f * 2000.0f / sample_rate);
+    const float start = (lcg.next() >> 8) * (1.0f / (1 << 24));
+    float level = 0.0f;
+    for (size_t n = 0;; n++) {
+        const size_t index = (n + start) / samples_per_bit;
+        if (index >= bits.size())
+            break;
+        level += alpha * ((bits[index] ? -1.0f : 1.0f) - level);
+        audio.push_back(0.1f + level + noise_rms * lcg.noise());
+    }
+
+    // Carrier hangs on briefly after the last bit, like the squelch.
+    for (size_t i = 0; i < lead_in; i++)
+        audio.push_back(0.1f + level + noise_rms * lcg.noise());
+
+    return audio;
+}
+
+struct Decoder {
+    BitQueue bits{};
+    AudioNormalizer normalizer{};
+    BitExtractor extractor{bits};
+    std::vector<pocsag::batch_t> batches{};
+    CodewordExtractor words{bits, [this](CodewordExtractor& w) {
+                                batches.push_back(w.batch());
+                            }};
+
+    Decoder(int8_t baud_config = -1) {
+        extractor.set_baud_config(baud_config);
+        extractor.configure(sample_rate);
+    }
+
+    /* Feeds audio in the processor's 16 sample blocks. */
+    void run(std::vector<float>& audio) {
+        for (size_t i = 0; i + 16 <= audio.size(); i += 16) {
+            const buffer_f32_t block{&audio[i], 16};
+            normalizer.execute_in_place(block);
+            extractor.extract_bits(block);
+            words.process_bits();
+        }
+    }
+
+    /* What the processor does when the squelch closes. */
+    void end_of_message() {
+        words.flush();
+        bits.reset();
+        extractor.reset();
+        words.reset();
+    }
+};
+
+size_t count_matches(const std::vector<pocsag::batch_t>& sent, const std::vector<pocsag::batch_t>& received) {
+    size_t matches = 0;
+    for (const auto& batch : received)
+        for (const auto& expected : sent)
+            if (batch == expected) {
+                matches++;
+                break;
+            }
+    return matches;
+}
+
+}  // namespace
+
+TEST_SUITE("POCSAG bit extractor") {
+    TEST_CASE("Each rate locks from the preamble and decodes all batches.") {
+        for (const float baud : {512.0f, 1200.0f, 2400.0f}) {
+            CAPTURE(baud);
+            Lcg lcg{static_cast<uint32_t>(baud)};
+            const auto tx = make_transmission(lcg, 576, 3);
+            auto audio = modulate(lcg, tx.bits, baud * 1.004f, 0.25f);
+
+            Decoder decoder{};
+            decoder.run(audio);
+            CHECK(decoder.extractor.baud_rate() == static_cast<uint16_t>(baud));
+            CHECK(decoder.batches.size() == 3);
+            CHECK(count_matches(tx.batches, decoder.batches) == 3);
+        }
+    }
+
+    TEST_CASE("A truncated preamble still yields the first batch.") {
+        for (const float baud : {512.0f, 1200.0f, 2400.0f}) {
+            CAPTURE(baud);
+            Lcg lcg{static_cast<uint32_t>(baud) + 1};
+            const auto tx = make_transmission(lcg, 16, 2);
+            auto audio = modulate(lcg, tx.bits, baud * 0.996f, 0.25f);
+
+            Decoder decoder{};
+            decoder.run(audio);
+            CHECK(decoder.extractor.baud_rate() == static_cast<uint16_t>(baud));
+            CHECK(count_matches(tx.batches, decoder.batches) == 2);
+        }
+    }
+
+    TEST_CASE("Messages at different rates decode back to back.") {
+        Lcg lcg{42};
+        Decoder decoder{};
+
+        for (const float baud : {2400.0f, 512.0f, 1200.0f, 2400.0f}) {
+            CAPTURE(baud);
+            const auto tx = make_transmission(lcg, 576, 2);
+            auto audio = modulate(lcg, tx.bits, baud, 0.25f);
+
+            decoder.batches.clear();
+            decoder.run(audio);
+            CHECK(decoder.extractor.baud_rate() == static_cast<uint16_t>(baud));
+            CHECK(count_matches(tx.batches, decoder.batches) == 2);
+            decoder.end_of_message();
+        }
+    }
+
+    TEST_CASE("A fixed baud config only decodes that rate.") {
+        Lcg lcg{7};
+        const auto tx = make_transmission(lcg, 576, 1);
+        auto audio_1200 = modulate(lcg, tx.bits, 1200.0f, 0.25f);
+        auto audio_512 = modulate(lcg, tx.bits, 512.0f, 0.25f);
+
+        Decoder decoder{1};
+        CHECK(decoder.extractor.baud_rate() == 1200);
+        decoder.run(audio_512);
+        CHECK(decoder.batches.empty());
+
+        decoder.end_of_message();
+        decoder.run(audio_1200);
+        CHECK(count_matches(tx.batches, decoder.batches) == 1);
+    }
+
+    TEST_CASE("Benchmark: throughput and batch success against noise.") {
+        for (const float noise : {0.25f, 0.5f, 0.7f}) {
+            size_t sent = 0;
+            size_t received = 0;
+            size_t samples = 0;
+            std::chrono::nanoseconds elapsed{0};
+
+            for (const float baud : {512.0f, 1200.0f, 2400.0f}) {
+                Lcg lcg{static_cast<uint32_t>(baud * 10 + noise * 100)};
+                const auto tx = make_transmission(lcg, 576, 8);
+                auto audio = modulate(lcg, tx.bits, baud * 1.002f, noise);
+
+                Decoder decoder{};
+                const auto start = std::chrono::steady_clock::now();
+                decoder.run(audio);
+                elapsed += std::chrono::steady_clock::now() - start;
+
+                sent += tx.batches.size();
+                received += count_matches(tx.batches, decoder.batches);
+                samples += audio.size();
+            }
+
+            MESSAGE("noise rms ", noise, ": ", received, "/", sent, " batches, ",
+                    static_cast<double>(elapsed.count()) / samples, " ns/sample");
+            if (noise <= 0.25f)
+                CHECK(received == sent);
+        }
+    }
+}
@@ -0,0 +1,200 @@
+/*
+ * Copyright (C) 2026
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "sd_over_usb/scsi_pipeline.h"
+#include "doctest.h"
+
+#include <cstring>
+#include <vector>
+
+namespace {
+
+constexpr uint32_t card_blocks = 256;
+constexpr uint32_t half_blocks = 8;
+
+/* A card and a host connected through a single bulk endpoint. The endpoint only
+ * moves data when usb_wait() is called, so anything the pipeline does to an
+ * in flight half before then shows up as corrupted data. */
+struct MockBus {
+    std::vector<uint8_t> card;
+    std::vector<uint8_t> buffer;
+    std::vector<uint8_t> host_in;   // What the host received.
+    std::vector<uint8_t> host_out;  // What the host sends.
+    size_t host_out_pos;
+
+    uint8_t* in_flight;
+    uint32_t in_flight_length;
+    bool in_flight_send;
+
+    std::vector<uint32_t> sd_transfers;
+    size_t overlapped;
+    size_t usb_transfers;
+    uint32_t fail_lba;
+    bool overlap_error;
+};
+
+MockBus bus;
+
+void reset_bus() {
+    bus = {};
+    bus.card.resize(card_blocks * SCSI_BLOCK_SIZE);
+    for (size_t i = 0; i < bus.card.size(); i++)
+        bus.card[i] = (uint8_t)(i * 7 + i / SCSI_BLOCK_SIZE);
+    bus.buffer.resize(2 * half_blocks * SCSI_BLOCK_SIZE);
+    bus.fail_lba = UINT32_MAX;
+}
+
+bool touches_in_flight(const uint8_t* buf, uint32_t n) {
+    return bus.in_flight &&
+           buf < bus.in_flight + bus.in_flight_length &&
+           bus.in_flight < buf + n * SCSI_BLOCK_SIZE;
+}
+
+bool mock_block_read(uint32_t lba, uint8_t* buf, uint32_t n) {
+    bus.overlap_error |= touches_in_flight(buf, n);
+    bus.overlapped += bus.in_flight != nullptr;
+    bus.sd_transfers.push_back(n);
+    memcpy(buf, &bus.card[lba * SCSI_BLOCK_SIZE], n * SCSI_BLOCK_SIZE);
+    return lba <= bus.fail_lba && bus.fail_lba < lba + n;
+}
+
+bool mock_block_write(uint32_t lba, uint8_t* buf, uint32_t n) {
+    bus.overlap_error |= touches_in_flight(buf, n);
+    bus.overlapped += bus.in_flight != nullptr;
+    bus.sd_transfers.push_back(n);
+    memcpy(&bus.card[lba * SCSI_BLOCK_SIZE], buf, n * SCSI_BLOCK_SIZE);
+    return lba <= bus.fail_lba && bus.fail_lba < lba + n;
+}
+
+void schedule(uint8_t* data, uint32_t length, bool send) {
+    REQUIRE(bus.in_flight == nullptr);
+    bus.in_flight = data;
+    bus.in_flight_length = length;
+    bus.in_flight_send = send;
+    bus.usb_transfers++;
+}
+
+void mock_usb_schedule_send(uint8_t* data, uint32_t length) {
+    schedule(data, length, true);
+}
+
+void mock_usb_schedule_receive(uint8_t* data, uint32_t length) {
+    schedule(data, length, false);
+}
+
+void mock_usb_wait() {
+    REQUIRE(bus.in_flight != nullptr);
+    if (bus.in_flight_send) {
+        bus.host_in.insert(bus.host_in.end(), bus.in_flight, bus.in_flight + bus.in_flight_length);
+    } else {
+        memcpy(bus.in_flight, &bus.host_out[bus.host_out_pos], bus.in_flight_length);
+        bus.host_out_pos += bus.in_flight_length;
+    }
+    bus.in_flight = nullptr;
+}
+
+const scsi_pipeline_ops_t mock_ops = {
+    mock_block_read,
+    mock_block_write,
+    mock_usb_schedule_send,
+    mock_usb_schedule_receive,
+    mock_usb_wait};
+
+scsi_pipeline_t mock_pipeline() {
+    return {&mock_ops, bus.buffer.data(), half_blocks};
+}
+
+}  // namespace
+
+TEST_SUITE_BEGIN("SCSI pipeline");
+
+TEST_CASE("READ10 streams multi-block reads through both halves") {
+    for (uint32_t count : {1u, 7u, 8u, 9u, 16u, 41u, 200u}) {
+        reset_bus();
+        const auto pipeline = mock_pipeline();
+        const uint32_t lba = 13;
+
+        CHECK(scsi_pipeline_read(&pipeline, lba, count) == 0);
+
+        REQUIRE(bus.host_in.size() == count * SCSI_BLOCK_SIZE);
+        CHECK(memcmp(bus.host_in.data(), &bus.card[lba * SCSI_BLOCK_SIZE], bus.host_in.size()) == 0);
+        CHECK_FALSE(bus.overlap_error);
+        CHECK(bus.in_flight == nullptr);
+        CHECK(bus.sd_transfers.size() == (count + half_blocks - 1) / half_blocks);
+        CHECK(bus.usb_transfers == bus.sd_transfers.size());
+        // Every read but the first runs while the previous half is being sent.
+        CHECK(bus.overlapped == bus.sd_transfers.size() - 1);
+    }
+}
+
+TEST_CASE("WRITE10 receives the next half while writing the current one") {
+    for (uint32_t count : {1u, 8u, 9u, 33u, 200u}) {
+        reset_bus();
+        const auto pipeline = mock_pipeline();
+        const uint32_t lba = 40;
+        bus.host_out.resize(count * SCSI_BLOCK_SIZE);
+        for (size_t i = 0; i < bus.host_out.size(); i++)
+            bus.host_out[i] = (uint8_t)(i * 13 + 5);
+        const auto before = bus.card;
+
+        CHECK(scsi_pipeline_write(&pipeline, lba, count) == 0);
+
+        CHECK(bus.host_out_pos == bus.host_out.size());
+        CHECK(memcmp(&bus.card[lba * SCSI_BLOCK_SIZE], bus.host_out.data(), bus.host_out.size()) == 0);
+        CHECK(memcmp(bus.card.data(), before.data(), lba * SCSI_BLOCK_SIZE) == 0);
+        const size_t end = (lba + count) * SCSI_BLOCK_SIZE;
+        CHECK(memcmp(&bus.card[end], &before[end], bus.card.size() - end) == 0);
+        CHECK_FALSE(bus.overlap_error);
+        CHECK(bus.in_flight == nullptr);
+        CHECK(bus.sd_transfers.size() == (count + half_blocks - 1) / half_blocks);
+        // Every write but the last runs while the next half is being received.
+        CHECK(bus.overlapped == bus.sd_transfers.size() - 1);
+    }
+}
+
+TEST_CASE("Zero length requests don't touch the bus") {
+    reset_bus();
+    const auto pipeline = mock_pipeline();
+
+    CHECK(scsi_pipeline_read(&pipeline, 0, 0) == 0);
+    CHECK(scsi_pipeline_write(&pipeline, 0, 0) == 0);
+    CHECK(bus.usb_transfers == 0);
+    CHECK(bus.sd_transfers.empty());
+}
+
+TEST_CASE("SD failures are reported after the data phase completes") {
+    reset_bus();
+    auto pipeline = mock_pipeline();
+    bus.fail_lba = 20;
+
+    CHECK(scsi_pipeline_read(&pipeline, 0, 32) == 1);
+    CHECK(bus.host_in.size() == 32 * SCSI_BLOCK_SIZE);
+
+    reset_bus();
+    pipeline = mock_pipeline();
+    bus.fail_lba = 3;
+    bus.host_out.resize(32 * SCSI_BLOCK_SIZE);
+
+    CHECK(scsi_pipeline_write(&pipeline, 0, 32) == 1);
+    CHECK(bus.host_out_pos == bus.host_out.size());
+}
+
+TEST_SUITE_END();
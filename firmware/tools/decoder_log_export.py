@@ -0,0 +1,205 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026
+#
+# This program is free software; you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation; either version 2, or (at your option)
+# any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program; see the file COPYING.  If not, write to
+# the Free Software Foundation, Inc., 51 Franklin Street,
+# Boston, MA 02110-1301, USA.
+#
+
+# Exports binary decoder logs (.BLG) written by the ADS-B, AIS, POCSAG,
+# ERT, TPMS and APRS apps to CSV or JSON. The format is described in
+# firmware/application/binary_log.hpp; the "text" column reproduces the
+# line the app would have written to its .TXT log.
+#
+#   decoder_log_export.py ADSB.BLG                 CSV on stdout
+#   decoder_log_export.py --json AIS.BLG out.json  JSON to a file
+
+import argparse
+import csv
+import datetime
+import json
+import struct
+import sys
+
+MAGIC = b'PPBL'
+FILE_HEADER = struct.Struct('<4sHH')
+RECORD_HEADER_V1 = struct.Struct('<BBHIIbBH')
+RECORD_HEADER = struct.Struct('<BBHIIbbHQiI')
+DB_UNKNOWN = -128
+FREQUENCY_OFFSET_UNKNOWN = -2**31
+ADSB_RECORD = struct.Struct('<14sBBiffHHiiBBBx8sI')
+
+TYPE_NAMES = ['TEXT', 'ADSB', 'AIS', 'POCSAG_RAW', 'POCSAG', 'ERT', 'TPMS', 'APRS']
+ADSB_SPEED_TYPES = [' Spd:', ' IAS:', ' TAS:']
+ERT_TYPES = {1: 'IDM', 2: 'SCM', 3: 'SCM+'}
+TPMS_SIGNAL_TYPES = {
+    1: 'FSK 38400 19200 Schrader',
+    2: 'OOK - 8192 Schrader',
+    3: 'OOK - 8400 Schrader',
+}
+
+
+def hex_symbols(data, symbols):
+    return data.hex().upper()[:(symbols + 3) // 4]
+
+
+def decode_adsb(payload):
+    (raw, raw_length, valid, altitude, latitude, longitude, squawk, heading,
+     speed, v_rate, speed_type, vel_type, sil, callsign, icao) = ADSB_RECORD.unpack_from(payload)
+    callsign = callsign.rstrip(b'\0').decode('ascii', 'replace')
+    fields = {'raw': raw[:raw_length].hex().upper(), 'icao': '%06X' % icao}
+
+    text = fields['raw'].ljust(28) + ' ICAO:' + fields['icao']
+    if squawk:
+        fields['squawk'] = squawk
+        text += ' Squawk:%04d' % squawk
+    if callsign:
+        fields['callsign'] = callsign
+        text += ' ' + callsign
+    if valid & 2:
+        fields['altitude'] = altitude
+        text += ' Alt:%d' % altitude
+    if valid & 1:
+        fields['latitude'] = latitude
+        fields['longitude'] = longitude
+        text += ' Lat:%.7f Lon:%.7f' % (latitude, longitude)
+    if valid & 4:
+        fields.update(heading=heading, speed=speed, v_rate=v_rate)
+        text += ' Type:%d Hdg:%d%s%d Vrate:%d' % (
+            vel_type, heading, ADSB_SPEED_TYPES[speed_type % 3], speed, v_rate)
+    if sil:
+        fields['sil'] = sil
+        text += ' Sil:%d' % sil
+    return text, fields
+
+
+def decode_ais(payload):
+    bits, = struct.unpack_from('<H', payload)
+    data = payload[2:2 + (bits + 7) // 8]
+    nibbles = data.hex()[:(bits + 3) // 4]
+    return nibbles, {'bits': bits, 'data': data.hex().upper()}
+
+
+def decode_pocsag_raw(payload, frequency):
+    bitrate, *codewords = struct.unpack_from('<17I', payload)
+    text = 'Raw: F:%dHz %d Codewords:' % (frequency, bitrate)
+    text += ''.join('%08X ' % c for c in codewords)
+    return text, {'bitrate': bitrate, 'codewords': ['%08X' % c for c in codewords]}
+
+
+def decode_symbols(payload):
+    symbols, = struct.unpack_from('<H', payload)
+    n = (symbols + 7) // 8
+    data = hex_symbols(payload[2:2 + n], symbols)
+    errors = hex_symbols(payload[2 + n:2 + 2 * n], symbols)
+    return data, errors
+
+
+def decode_ert(payload, subtype, frequency):
+    ert_id, = struct.unpack_from('<I', payload)
+    data, errors = decode_symbols(payload[4:])
+    kind = ERT_TYPES.get(subtype, '???')
+    text = '%10d %s %s/%s ID:%d' % (frequency, kind, data, errors, ert_id)
+    return text, {'ert_type': kind, 'id': ert_id, 'data': data, 'errors': errors}
+
+
+def decode_tpms(payload, subtype, frequency):
+    data, errors = decode_symbols(payload)
+    signal = TPMS_SIGNAL_TYPES.get(subtype, '- - - -')
+    text = '%10d %s %s/%s' % (frequency, signal, data, errors)
+    return text, {'signal_type': signal, 'data': data, 'errors': errors}
+
+
+def decode_record(kind, subtype, frequency, payload):
+    if kind == 1:
+        return decode_adsb(payload)
+    if kind == 2:
+        return decode_ais(payload)
+    if kind == 3:
+        return decode_pocsag_raw(payload, frequency)
+    if kind == 5:
+        return decode_ert(payload, subtype, frequency)
+    if kind == 6:
+        return decode_tpms(payload, subtype, frequency)
+    return payload.decode('latin-1'), {}
+
+
+def read_records(f):
+    magic, version, record_header_size = FILE_HEADER.unpack(f.read(FILE_HEADER.size))
+    if magic != MAGIC:
+        raise ValueError('not a binary decoder log')
+    if version not in (1, 2):
+        raise ValueError('unsupported log version %d' % version)
+
+    while True:
+        header = f.read(record_header_size)
+        if len(header) < record_header_size:
+            return
+        if version == 1:
+            kind, subtype, length, timestamp, frequency, rssi, _, _ = RECORD_HEADER_V1.unpack_from(header)
+            snr, sample_index, frequency_offset = DB_UNKNOWN, None, FREQUENCY_OFFSET_UNKNOWN
+        else:
+            (kind, subtype, length, timestamp, frequency, rssi, snr, _,
+             sample_index, frequency_offset, _) = RECORD_HEADER.unpack_from(header)
+        payload = f.read(length)
+        if len(payload) < length:
+            return  # Truncated by a power loss.
+
+        text, fields = decode_record(kind, subtype, frequency, payload)
+        record = {
+            # Records hold UTC seconds (rtcToUnixUTC).
+            'timestamp': datetime.datetime.fromtimestamp(timestamp, datetime.timezone.utc)
+                                          .strftime('%Y-%m-%d %H:%M:%S'),
+            'type': TYPE_NAMES[kind] if kind < len(TYPE_NAMES) else str(kind),
+            'frequency': frequency,
+            'rssi': None if rssi == DB_UNKNOWN else rssi,
+            'snr': None if snr == DB_UNKNOWN else snr,
+            'frequency_offset': None if frequency_offset == FREQUENCY_OFFSET_UNKNOWN else frequency_offset,
+            'sample_index': sample_index or None,
+            'text': text,
+        }
+        record.update(fields)
+        yield record
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Export PortaPack binary decoder logs.')
+    parser.add_argument('--json', action='store_true', help='write JSON instead of CSV')
+    parser.add_argument('input')
+    parser.add_argument('output', nargs='?', help='output file (default: stdout)')
+    args = parser.parse_args()
+
+    with open(args.input, 'rb') as f:
+        records = list(read_records(f))
+
+    out = open(args.output, 'w', newline='') if args.output else sys.stdout
+    try:
+        if args.json:
+            json.dump(records, out, indent=1)
+            out.write('\n')
+        else:
+            writer = csv.writer(out)
+            columns = ['timestamp', 'type', 'frequency', 'rssi', 'snr',
+                       'frequency_offset', 'sample_index', 'text']
+            writer.writerow(columns)
+            for r in records:
+                writer.writerow(['' if r[c] is None else r[c] for c in columns])
+    finally:
+        if out is not sys.stdout:
+            out.close()
+
+
+if __name__ == '__main__':
+    main()
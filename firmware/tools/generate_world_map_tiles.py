@@ -0,0 +1,103 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026
+#
+# This program is free software; you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation; either version 2, or (at your option)
+# any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program; see the file COPYING.  If not, write to
+# the Free Software Foundation, Inc., 51 Franklin Street,
+# Boston, MA 02110-1301, USA.
+#
+
+# Builds world_map_tiles.bin, the pre-tiled zoom pyramid read by GeoMap
+# (see firmware/application/geomap_tiles.hpp for the layout).
+# Level n is the source image downscaled by 2^n, enough levels are written
+# to cover MAX_MAP_ZOOM_OUT. Identical tiles (open ocean) are stored once.
+
+import struct
+from PIL import Image
+
+TILE_SIZE = 32  # Must match geomap_tiles.hpp
+MAGIC = 0x544D4750  # "PGMT"
+MAX_MAP_ZOOM_OUT = 10  # Must match ui_geomap.hpp
+
+outfile_name = '../../sdcard/ADSB/world_map_tiles.bin'
+
+# Allow for bigger images
+Image.MAX_IMAGE_PIXELS = None
+im = Image.open("../../sdcard/ADSB/world_map.jpg").convert('RGB')
+width, height = im.size
+if width > 0xFFFF or height > 0xFFFF:
+    raise SystemExit("image is too large for a 16-bit size header")
+
+levels = 1
+while (2 << (levels - 1)) <= MAX_MAP_ZOOM_OUT:
+    levels += 1
+
+print("image \t size=" + str(width) + "x" + str(height) + " pixels, " + str(levels) + " levels")
+print("Generating: \t" + outfile_name + "\n from\t\t" + im.filename + "\n please wait...")
+
+
+def rgb565_tile(img, tx, ty):
+    # Crop past the edge pads with black
+    tile = img.crop((tx * TILE_SIZE, ty * TILE_SIZE, (tx + 1) * TILE_SIZE, (ty + 1) * TILE_SIZE))
+    data = bytearray()
+    for r, g, b in tile.getdata():
+        # RRRRRGGGGGGBBBBB
+        data += struct.pack('<H', ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3))
+    return bytes(data)
+
+
+level_images = []
+for level in range(levels):
+    scale = 1 << level
+    size = (max(1, (width + scale - 1) // scale), max(1, (height + scale - 1) // scale))
+    level_images.append(im if level == 0 else im.resize(size, Image.BOX))
+
+header_size = 12
+level_table_size = 8 * levels
+level_tiles = [((img.size[0] + TILE_SIZE - 1) // TILE_SIZE, (img.size[1] + TILE_SIZE - 1) // TILE_SIZE) for img in level_images]
+index_size = sum(tx * ty * 4 for tx, ty in level_tiles)
+
+tile_offsets = {}
+tile_data = bytearray()
+data_start = header_size + level_table_size + index_size
+indexes = []
+for level, img in enumerate(level_images):
+    tiles_x, tiles_y = level_tiles[level]
+    index = []
+    for ty in range(tiles_y):
+        for tx in range(tiles_x):
+            tile = rgb565_tile(img, tx, ty)
+            offset = tile_offsets.get(tile)
+            if offset is None:
+                offset = data_start + len(tile_data)
+                tile_offsets[tile] = offset
+                tile_data += tile
+            index.append(offset)
+        print("level " + str(level) + " row " + str(ty + 1) + '/' + str(tiles_y) + '\r', end="")
+    indexes.append(index)
+print("")
+
+with open(outfile_name, 'wb') as outfile:
+    outfile.write(struct.pack('<IHHHH', MAGIC, TILE_SIZE, levels, width, height))
+    index_offset = header_size + level_table_size
+    for level in range(levels):
+        tiles_x, tiles_y = level_tiles[level]
+        outfile.write(struct.pack('<HHI', tiles_x, tiles_y, index_offset))
+        index_offset += tiles_x * tiles_y * 4
+    for index in indexes:
+        outfile.write(struct.pack('<' + str(len(index)) + 'I', *index))
+    outfile.write(tile_data)
+
+print(str(len(tile_offsets)) + " unique tiles written.")
+print("Ready.")
@@ -0,0 +1,183 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026
+#
+# This program is free software; you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation; either version 2, or (at your option)
+# any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program; see the file COPYING.  If not, write to
+# the Free Software Foundation, Inc., 51 Franklin Street,
+# Boston, MA 02110-1301, USA.
+#
+
+# Converts between block floating point captures (.C4/.C6) and C8/C16.
+# The format is described in firmware/application/io_convert.hpp.
+#
+#   iq_bfp_convert.py CAPTURE.C6 CAPTURE.C16      decode
+#   iq_bfp_convert.py CAPTURE.C16 CAPTURE.C4      encode
+#   iq_bfp_convert.py --info CAPTURE.C6           print the block exponents
+
+import argparse
+import array
+import os
+import struct
+import sys
+
+MAGIC = b'BFPQ'
+HEADER_SIZE = 8
+
+
+def block_bytes(bits, block_samples):
+    return 1 + (block_samples * 2 * bits) // 8
+
+
+def bits_from_path(path):
+    ext = os.path.splitext(path)[1].upper()
+    return {'.C4': 4, '.C6': 6}.get(ext, 0)
+
+
+def read_header(f, path):
+    header = f.read(HEADER_SIZE)
+    if len(header) != HEADER_SIZE or header[0:4] != MAGIC:
+        sys.exit(path + ": not a block floating point capture")
+    bits = header[4]
+    block_samples = struct.unpack('<H', header[6:8])[0]
+    if bits not in (4, 6):
+        sys.exit(path + ": unsupported bit depth " + str(bits))
+    return bits, block_samples
+
+
+def sign_extend(v, bits):
+    return v - (1 << bits) if v & (1 << (bits - 1)) else v
+
+
+def decode_block(block, bits, block_samples):
+    exponent = block[0] & 0x0F
+    values = []
+    if bits == 4:
+        for b in block[1:1 + block_samples]:
+            values.append(sign_extend(b & 0x0F, 4))
+            values.append(sign_extend(b >> 4, 4))
+    else:
+        for i in range(1, 1 + block_samples * 3 // 2, 3):
+            packed = block[i] | (block[i + 1] << 8) | (block[i + 2] << 16)
+            for shift in (0, 6, 12, 18):
+                values.append(sign_extend((packed >> shift) & 0x3F, 6))
+    return [max(-32768, min(32767, v << exponent)) for v in values]
+
+
+def encode_block(values, bits):
+    q_max = (1 << (bits - 1)) - 1
+    q_min = -q_max - 1
+    mask = (1 << bits) - 1
+    peak = max(abs(v) for v in values)
+    exponent = 0
+    while (peak >> exponent) > q_max:
+        exponent += 1
+    half = (1 << (exponent - 1)) if exponent else 0
+    q = [max(q_min, min(q_max, (v + half) >> exponent)) & mask for v in values]
+
+    out = bytearray([exponent])
+    if bits == 4:
+        for i in range(0, len(q), 2):
+            out.append(q[i] | (q[i + 1] << 4))
+    else:
+        for i in range(0, len(q), 4):
+            packed = q[i] | (q[i + 1] << 6) | (q[i + 2] << 12) | (q[i + 3] << 18)
+            out += bytes((packed & 0xFF, (packed >> 8) & 0xFF, packed >> 16))
+    return bytes(out)
+
+
+def read_samples(path):
+    # Returns interleaved I/Q values scaled to C16
+    data = array.array('b' if path.upper().endswith('.C8') else 'h')
+    with open(path, 'rb') as f:
+        data.frombytes(f.read())
+    if sys.byteorder != 'little' and data.typecode == 'h':
+        data.byteswap()
+    return [v * 256 for v in data] if data.typecode == 'b' else list(data)
+
+
+def write_samples(path, values):
+    if path.upper().endswith('.C8'):
+        # Same as file_convert::c16_to_c8(), rounds towards zero
+        data = array.array('b', [int(v / 256) for v in values])
+    else:
+        data = array.array('h', values)
+        if sys.byteorder != 'little':
+            data.byteswap()
+    with open(path, 'wb') as f:
+        f.write(data.tobytes())
+
+
+def decode(src, dst):
+    with open(src, 'rb') as f:
+        bits, block_samples = read_header(f, src)
+        size = block_bytes(bits, block_samples)
+        values = []
+        while True:
+            block = f.read(size)
+            if len(block) < size:
+                break
+            values += decode_block(block, bits, block_samples)
+    write_samples(dst, values)
+    print(src + ": " + str(len(values) // 2) + " samples decoded to " + dst)
+
+
+def encode(src, dst, block_samples=256):
+    bits = bits_from_path(dst)
+    values = read_samples(src)
+    block_values = block_samples * 2
+    # A trailing partial block is dropped, as on the device
+    blocks = len(values) // block_values
+    with open(dst, 'wb') as f:
+        f.write(MAGIC + struct.pack('<BBH', bits, 0, block_samples))
+        for b in range(blocks):
+            f.write(encode_block(values[b * block_values:(b + 1) * block_values], bits))
+    print(src + ": " + str(blocks * block_samples) + " samples encoded to " + dst)
+
+
+def info(path):
+    with open(path, 'rb') as f:
+        bits, block_samples = read_header(f, path)
+        size = block_bytes(bits, block_samples)
+        exponents = []
+        while True:
+            block = f.read(size)
+            if len(block) < size:
+                break
+            exponents.append(block[0])
+    print(path + ": " + str(bits) + " bit, " + str(block_samples) + " samples per block, " + str(len(exponents)) + " blocks")
+    for n, e in enumerate(exponents):
+        print("block " + str(n) + " @ " + str(HEADER_SIZE + n * size) + ": exponent " + str(e))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert block floating point IQ captures (.C4/.C6) to and from C8/C16.")
+    parser.add_argument('--info', action='store_true', help="list the blocks of a .C4/.C6 file")
+    parser.add_argument('src')
+    parser.add_argument('dst', nargs='?')
+    args = parser.parse_args()
+
+    if args.info:
+        info(args.src)
+    elif args.dst is None:
+        parser.error("a destination file is required")
+    elif bits_from_path(args.src):
+        decode(args.src, args.dst)
+    elif bits_from_path(args.dst):
+        encode(args.src, args.dst)
+    else:
+        parser.error("one of the files must be .C4 or .C6")
+
+
+if __name__ == '__main__':
+    main()